@@ -863,6 +863,11 @@ namespace Editor
 		return UIWidget::IsUnderPoint(point);
 	}
 
+	RectF UIAssetsIconsScrollArea::GetCursorAreaBounds() const
+	{
+		return UIWidget::GetUnderPointBounds();
+	}
+
 #undef CopyFile
 
 	void UIAssetsIconsScrollArea::OnContextCopyPressed()
@@ -1084,6 +1089,7 @@ CLASS_META(Editor::UIAssetsIconsScrollArea)
 	PUBLIC_FUNCTION(void, SetHightlightLayout, const Layout&);
 	PUBLIC_FUNCTION(Sprite*, GetSelectingDrawable);
 	PUBLIC_FUNCTION(bool, IsUnderPoint, const Vec2F&);
+	PUBLIC_FUNCTION(RectF, GetCursorAreaBounds);
 	PROTECTED_FUNCTION(void, OnAssetsSelected);
 	PROTECTED_FUNCTION(void, UpdateLayout, bool, bool);
 	PROTECTED_FUNCTION(void, UpdateCuttingAssets);
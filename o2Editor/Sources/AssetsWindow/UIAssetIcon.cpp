@@ -53,6 +53,11 @@ namespace Editor
 		return UIWidget::IsUnderPoint(point);
 	}
 
+	RectF UIAssetIcon::GetCursorAreaBounds() const
+	{
+		return UIWidget::GetUnderPointBounds();
+	}
+
 	void UIAssetIcon::SetSelected(bool selected)
 	{
 		SetState("selected", selected);
@@ -138,6 +143,7 @@ CLASS_META(Editor::UIAssetIcon)
 	PUBLIC_FUNCTION(void, SetAssetInfo, const AssetInfo&);
 	PUBLIC_FUNCTION(const AssetInfo&, GetAssetInfo);
 	PUBLIC_FUNCTION(bool, IsUnderPoint, const Vec2F&);
+	PUBLIC_FUNCTION(RectF, GetCursorAreaBounds);
 	PROTECTED_FUNCTION(void, SetSelected, bool);
 	PROTECTED_FUNCTION(void, OnCursorDblClicked, const Input::Cursor&);
 	PROTECTED_FUNCTION(void, OnCursorRightMouseReleased, const Input::Cursor&);
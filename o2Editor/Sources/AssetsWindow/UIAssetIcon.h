@@ -42,6 +42,9 @@ namespace Editor
 		// Returns true if point is in this object
 		bool IsUnderPoint(const Vec2F& point);
 
+		// Returns widget's rectangle, out of which point can't be under this
+		RectF GetCursorAreaBounds() const;
+
 		SERIALIZABLE(UIAssetIcon);
 
 	protected:
@@ -112,6 +112,11 @@ namespace Editor
 		return UIWidget::IsUnderPoint(point);
 	}
 
+	RectF UIScrollView::GetCursorAreaBounds() const
+	{
+		return UIWidget::GetUnderPointBounds();
+	}
+
 	bool UIScrollView::IsScrollable() const
 	{
 		return true;
@@ -344,6 +349,7 @@ CLASS_META(Editor::UIScrollView)
 	PUBLIC_FUNCTION(void, SetGridColor, const Color4&);
 	PUBLIC_FUNCTION(void, UpdateLayout, bool, bool);
 	PUBLIC_FUNCTION(bool, IsUnderPoint, const Vec2F&);
+	PUBLIC_FUNCTION(RectF, GetCursorAreaBounds);
 	PUBLIC_FUNCTION(bool, IsScrollable);
 	PUBLIC_FUNCTION(bool, IsFocusable);
 	PROTECTED_FUNCTION(void, UpdateTransparency);
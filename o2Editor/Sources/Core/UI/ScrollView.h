@@ -58,6 +58,9 @@ namespace Editor
 		// Returns true if point is in this object
 		bool IsUnderPoint(const Vec2F& point);
 
+		// Returns widget's rectangle, out of which point can't be under this
+		RectF GetCursorAreaBounds() const;
+
 		// Returns is listener scrollable
 		bool IsScrollable() const;
 
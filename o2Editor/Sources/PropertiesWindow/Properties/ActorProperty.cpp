@@ -184,6 +184,11 @@ namespace Editor
 		return mBox->IsUnderPoint(point);
 	}
 
+	RectF ActorProperty::GetCursorAreaBounds() const
+	{
+		return mBox->GetUnderPointBounds();
+	}
+
 	void ActorProperty::SetCommonValue(Actor* value)
 	{
 		mCommonValue = value;
@@ -413,6 +418,7 @@ CLASS_META(Editor::ActorProperty)
 	PUBLIC_FUNCTION(void, SetValue, Actor*);
 	PUBLIC_FUNCTION(void, SetUnknownValue);
 	PUBLIC_FUNCTION(bool, IsUnderPoint, const Vec2F&);
+	PUBLIC_FUNCTION(RectF, GetCursorAreaBounds);
 	PROTECTED_FUNCTION(void, SetCommonValue, Actor*);
 	PROTECTED_FUNCTION(void, CheckRevertableState);
 	PROTECTED_FUNCTION(void, RevertoToPrototype, void*, void*, IObject*);
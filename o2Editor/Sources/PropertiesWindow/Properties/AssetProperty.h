@@ -80,6 +80,9 @@ namespace Editor
 		// Returns true if point is in this object
 		bool IsUnderPoint(const Vec2F& point);
 
+		// Returns edit box rectangle, out of which point can't be under this
+		RectF GetCursorAreaBounds() const;
+
 		IOBJECT(AssetProperty);
 
 	protected:
@@ -350,6 +353,12 @@ namespace Editor
 		return mBox->IsUnderPoint(point);
 	}
 
+	template<typename _type>
+	RectF AssetProperty<_type>::GetCursorAreaBounds() const
+	{
+		return mBox->GetUnderPointBounds();
+	}
+
 	template<typename _type>
 	void AssetProperty<_type>::OnDragExit(ISelectableDragableObjectsGroup* group)
 	{
@@ -444,6 +453,7 @@ CLASS_TEMPLATE_META(Editor::AssetProperty<typename _type>)
 	PUBLIC_FUNCTION(void, SetAssetId, UID);
 	PUBLIC_FUNCTION(void, SetUnknownValue);
 	PUBLIC_FUNCTION(bool, IsUnderPoint, const Vec2F&);
+	PUBLIC_FUNCTION(RectF, GetCursorAreaBounds);
 	PROTECTED_FUNCTION(void, SetCommonAssetId, UID);
 	PROTECTED_FUNCTION(void, CheckRevertableState);
 	PROTECTED_FUNCTION(void, OnCursorEnter, const Input::Cursor&);
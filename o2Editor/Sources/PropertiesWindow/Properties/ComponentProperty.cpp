@@ -163,6 +163,11 @@ namespace Editor
 		return mBox->IsUnderPoint(point);
 	}
 
+	RectF ComponentProperty::GetCursorAreaBounds() const
+	{
+		return mBox->GetUnderPointBounds();
+	}
+
 	void ComponentProperty::RevertoToPrototype(void* target, void* source, IObject* targetOwner)
 	{
 		if (!source || !targetOwner || targetOwner->GetType().IsBasedOn(TypeOf(Component)))
@@ -433,6 +438,7 @@ CLASS_META(Editor::ComponentProperty)
 	PUBLIC_FUNCTION(void, SetValue, Component*);
 	PUBLIC_FUNCTION(void, SetUnknownValue);
 	PUBLIC_FUNCTION(bool, IsUnderPoint, const Vec2F&);
+	PUBLIC_FUNCTION(RectF, GetCursorAreaBounds);
 	PROTECTED_FUNCTION(void, RevertoToPrototype, void*, void*, IObject*);
 	PROTECTED_FUNCTION(void, SetCommonValue, Component*);
 	PROTECTED_FUNCTION(void, CheckRevertableState);
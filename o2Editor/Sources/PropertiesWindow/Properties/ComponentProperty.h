@@ -67,6 +67,9 @@ namespace Editor
 		// Returns true if point is in this object
 		bool IsUnderPoint(const Vec2F& point);
 
+		// Returns edit box rectangle, out of which point can't be under this
+		RectF GetCursorAreaBounds() const;
+
 		IOBJECT(ComponentProperty);
 
 	protected:
@@ -142,9 +142,19 @@ namespace Editor
 
 	void SceneEditScreen::DrawActors()
 	{
+		o2Scene.UpdateTransforms();
+
+		RectF viewRect = o2Render.GetCamera().GetAxisAlignedRect();
+		Scene::DrawCompsVec visibleDrawables;
+
 		for (auto layer : o2Scene.GetLayers())
-			for (auto drw : layer->GetEnabledDrawableComponents())
+		{
+			visibleDrawables.Clear();
+			layer->GetVisibleDrawableComponents(viewRect, visibleDrawables);
+
+			for (auto drw : visibleDrawables)
 				drw->Draw();
+		}
 	}
 
 	void SceneEditScreen::DrawSelection()
@@ -260,6 +270,11 @@ namespace Editor
 		return UIWidget::IsUnderPoint(point);
 	}
 
+	RectF SceneEditScreen::GetCursorAreaBounds() const
+	{
+		return UIWidget::GetUnderPointBounds();
+	}
+
 	void SceneEditScreen::BindActorsTree()
 	{
 		mActorsTree = o2EditorWindows.GetWindow<TreeWindow>()->GetActorsTree();
@@ -580,6 +595,7 @@ CLASS_META(Editor::SceneEditScreen)
 	PUBLIC_FUNCTION(const Color4&, GetManyActorsSelectionColor);
 	PUBLIC_FUNCTION(void, OnSceneChanged);
 	PUBLIC_FUNCTION(bool, IsUnderPoint, const Vec2F&);
+	PUBLIC_FUNCTION(RectF, GetCursorAreaBounds);
 	PROTECTED_FUNCTION(void, InitializeTools, const Type*);
 	PROTECTED_FUNCTION(bool, IsHandleWorking, const Input::Cursor&);
 	PROTECTED_FUNCTION(void, OnCursorPressed, const Input::Cursor&);
@@ -65,7 +65,7 @@ namespace o2
 	{
 		AnimationState* res = mnew AnimationState(name);
 		res->animation = animation;
-		res->mask = mask;
+		res->SetMask(mask);
 		res->weight = weight;
 		return AddState(res);
 	}
@@ -221,6 +221,12 @@ namespace o2
 		}
 	}
 
+	void Animatable::UpdateMaskWeights(AnimationState* state)
+	{
+		for (auto val : mValues)
+			val->UpdateMaskWeight(state);
+	}
+
 	void Animatable::BlendState::Update(float dt)
 	{
 		time -= dt;
@@ -261,5 +267,6 @@ CLASS_META(o2::Animatable)
 	PUBLIC_FUNCTION(void, Stop, const String&);
 	PUBLIC_FUNCTION(void, StopAll);
 	PROTECTED_FUNCTION(void, UnregAnimatedValue, IAnimatedValue*, const String&);
+	PROTECTED_FUNCTION(void, UpdateMaskWeights, AnimationState*);
 }
 END_META;
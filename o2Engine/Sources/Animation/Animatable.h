@@ -98,22 +98,29 @@ namespace o2
 
 			// Returns is agent hasn't no values
 			virtual bool IsEmpty() const = 0;
+
+			// Resolves state's mask weight for value path
+			virtual void UpdateMaskWeight(AnimationState* state) = 0;
 		};
 		typedef Vector<IValueAgent*> ValueAgentsVec;
 
-		// ------------------------------
-		// Template value assigning agent
-		// ------------------------------
+		// -----------------------------------------------------------------------------------
+		// Template value assigning agent. Animated values, their states and states mask weights
+		// for agent's path are stored in parallel arrays
+		// -----------------------------------------------------------------------------------
 		template<typename _type>
 		struct ValueAgent: public IValueAgent
 		{
-			typedef Dictionary<AnimationState*, AnimatedValue<_type>*> AnimatedValuesDict;
-
-			AnimatedValuesDict animValues; // Animated values associated with animation states
-			void*              targetPtr;  // Target value pointer (field or setter)
+			Vector<AnimationState*>       states;       // Animation states of animated values
+			Vector<AnimatedValue<_type>*> animValues;   // Animated values
+			Vector<float>                 masksWeights; // States masks weights for path
+			void*                         targetPtr;    // Target value pointer (field or setter)
 
 			void(ValueAgent<_type>::*assignFunc)(_type&); // Current assign function
 
+			// Adds animated value of state
+			void AddValue(AnimationState* state, AnimatedValue<_type>* value);
+
 			// Updates value and blend
 			void Update();
 
@@ -123,6 +130,9 @@ namespace o2
 			// Returns is agent hasn't no values
 			bool IsEmpty() const;
 
+			// Resolves state's mask weight for value path
+			void UpdateMaskWeight(AnimationState* state);
+
 			// Assigns value as field
 			void AssignField(_type& value);
 
@@ -156,11 +166,15 @@ namespace o2
 		// Removes animated value from agent by path
 		void UnregAnimatedValue(IAnimatedValue* value, const String& path);
 
+		// Resolves state's mask weights in values agents. It is called when state's mask changed
+		void UpdateMaskWeights(AnimationState* state);
+
 		// Registers value by path and state
 		template<typename _type>
 		void RegAnimatedValue(AnimatedValue< _type >* value, const String& path, AnimationState* state);
 
 		friend class Animation;
+		friend class AnimationState;
 		friend class IAnimatedValue;
 
 		template<typename _type>
@@ -182,7 +196,7 @@ namespace o2
 					return;
 				}
 
-				agent->animValues.Add(state, value);
+				agent->AddValue(state, value);
 				return;
 			}
 		}
@@ -190,7 +204,7 @@ namespace o2
 		ValueAgent<_type>* newAgent = mnew ValueAgent <_type>();
 		mValues.Add(newAgent);
 		newAgent->path = path;
-		newAgent->animValues.Add(state, value);
+		newAgent->AddValue(state, value);
 
 		FieldInfo* fieldInfo = nullptr;
 		_type* fieldPtr = (_type*)GetType().GetFieldPtr(this, path, fieldInfo);
@@ -215,28 +229,53 @@ namespace o2
 		return animValues.IsEmpty();
 	}
 
+	template<typename _type>
+	void Animatable::ValueAgent<_type>::AddValue(AnimationState* state, AnimatedValue<_type>* value)
+	{
+		states.Add(state);
+		animValues.Add(value);
+		masksWeights.Add(state->GetMask().GetNodeWeight(path));
+	}
+
 	template<typename _type>
 	void Animatable::ValueAgent<_type>::RemoveValue(IAnimatedValue* value)
 	{
-		animValues.RemoveAll([&](auto x) { return x.Value() == value; });
+		for (int i = animValues.Count() - 1; i >= 0; i--)
+		{
+			if (animValues[i] == value)
+			{
+				states.RemoveAt(i);
+				animValues.RemoveAt(i);
+				masksWeights.RemoveAt(i);
+			}
+		}
+	}
+
+	template<typename _type>
+	void Animatable::ValueAgent<_type>::UpdateMaskWeight(AnimationState* state)
+	{
+		for (int i = 0; i < states.Count(); i++)
+		{
+			if (states[i] == state)
+				masksWeights[i] = state->GetMask().GetNodeWeight(path);
+		}
 	}
 
 	template<typename _type>
 	void Animatable::ValueAgent<_type>::Update()
 	{
-		AnimationState* firstValueState = animValues.GetIdx(0).Key();
-		AnimatedValue<_type>* firstValue = animValues.GetIdx(0).Value();
+		AnimationState** statesData = states.Data();
+		AnimatedValue<_type>** valuesData = animValues.Data();
+		float* weightsData = masksWeights.Data();
+		int count = animValues.Count();
 
-		float weightsSum = firstValueState->weight*firstValueState->workWeight*firstValueState->mask.GetNodeWeight(path);
-		_type valueSum = firstValue->GetValue();
+		float weightsSum = statesData[0]->weight*statesData[0]->workWeight*weightsData[0];
+		_type valueSum = valuesData[0]->GetValue();
 
-		for (int i = 1; i < animValues.Count(); i++)
+		for (int i = 1; i < count; i++)
 		{
-			AnimationState* valueState = animValues.GetIdx(i).Key();
-			AnimatedValue<_type>* value = animValues.GetIdx(i).Value();
-
-			weightsSum += valueState->weight*valueState->workWeight*valueState->mask.GetNodeWeight(path);
-			valueSum += value->GetValue();
+			weightsSum += statesData[i]->weight*statesData[i]->workWeight*weightsData[i];
+			valueSum += valuesData[i]->GetValue();
 		}
 
 		_type resValue = valueSum / weightsSum;
@@ -507,36 +507,12 @@ namespace o2
 		else if (count == 0)
 			return _type();
 
-		int begi = -1, endi = -1;
-
-		for (int i = 1; i < count; i++)
-		{
-			begi = i - 1;
-			endi = i;
-
-			if (mKeys[i].position > position)
-				break;
-		}
-
-		if (begi < 0)
-			return _type();
-
-		Key& beginKey = mKeys[begi];
+		int endi = FindSegmentEndKey(mKeys.Data(), count, position);
+		Key& beginKey = mKeys[endi - 1];
 		Key& endKey = mKeys[endi];
 
-		int segBeg = 0;
-		int segEnd = 1;
-
-		for (int i = 1; i < Key::mApproxValuesCount; i++)
-		{
-			segBeg = i - 1;
-			segEnd = i;
-
-			if (endKey.mCurveApproxValues[i].x > position)
-				break;
-		}
-
-		Vec2F begs = endKey.mCurveApproxValues[segBeg];
+		int segEnd = FindApproxSegmentEnd(endKey.mCurveApproxValues, Key::mApproxValuesCount, position);
+		Vec2F begs = endKey.mCurveApproxValues[segEnd - 1];
 		Vec2F ends = endKey.mCurveApproxValues[segEnd];
 
 		float dist = ends.x - begs.x;
@@ -260,21 +260,8 @@ namespace o2
 		else if (count == 0)
 			return Vec2F();
 
-		int begi = -1, endi = -1;
-
-		for (int i = 1; i < count; i++)
-		{
-			begi = i - 1;
-			endi = i;
-
-			if (mKeys[i].position > position)
-				break;
-		}
-
-		if (begi < 0)
-			return Vec2F();
-
-		Key& beginKey = mKeys[begi];
+		int endi = FindSegmentEndKey(mKeys.Data(), count, position);
+		Key& beginKey = mKeys[endi - 1];
 		Key& endKey = mKeys[endi];
 
 		if (Math::Equals(endKey.mApproxTotalLength, 0.0f, 0.001f))
@@ -282,19 +269,8 @@ namespace o2
 
 		float curveCoef = 0.0f;
 		{
-			int segBeg = 0;
-			int segEnd = 1;
-
-			for (int i = 1; i < Key::mApproxValuesCount; i++)
-			{
-				segBeg = i - 1;
-				segEnd = i;
-
-				if (endKey.mCurveApproxValues[i].x > position)
-					break;
-			}
-
-			Vec2F begs = endKey.mCurveApproxValues[segBeg];
+			int segEnd = FindApproxSegmentEnd(endKey.mCurveApproxValues, Key::mApproxValuesCount, position);
+			Vec2F begs = endKey.mCurveApproxValues[segEnd - 1];
 			Vec2F ends = endKey.mCurveApproxValues[segEnd];
 
 			float dist = ends.x - begs.x;
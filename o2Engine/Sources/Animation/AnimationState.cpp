@@ -11,6 +11,25 @@ namespace o2
 	AnimationState::AnimationState(const String& name) :
 		name(name), weight(1.0f), workWeight(1.0f), mOwner(nullptr)
 	{}
+
+	void AnimationState::SetMask(const AnimationMask& mask)
+	{
+		mMask = mask;
+
+		if (mOwner)
+			mOwner->UpdateMaskWeights(this);
+	}
+
+	const AnimationMask& AnimationState::GetMask() const
+	{
+		return mMask;
+	}
+
+	void AnimationState::OnDeserialized(const DataNode& node)
+	{
+		if (mOwner)
+			mOwner->UpdateMaskWeights(this);
+	}
 }
 
 CLASS_META(o2::AnimationState)
@@ -19,9 +38,13 @@ CLASS_META(o2::AnimationState)
 
 	PUBLIC_FIELD(name).SERIALIZABLE_ATTRIBUTE();
 	PUBLIC_FIELD(animation).SERIALIZABLE_ATTRIBUTE();
-	PUBLIC_FIELD(mask).SERIALIZABLE_ATTRIBUTE();
 	PUBLIC_FIELD(weight).SERIALIZABLE_ATTRIBUTE();
 	PUBLIC_FIELD(workWeight);
+	PROTECTED_FIELD(mMask).SERIALIZABLE_ATTRIBUTE();
 	PROTECTED_FIELD(mOwner);
+
+	PUBLIC_FUNCTION(void, SetMask, const AnimationMask&);
+	PUBLIC_FUNCTION(const AnimationMask&, GetMask);
+	PROTECTED_FUNCTION(void, OnDeserialized, const DataNode&);
 }
 END_META;
@@ -15,11 +15,10 @@ namespace o2
 	class AnimationState: public ISerializable
 	{
 	public:
-		String        name;       // State name @SERIALIZABLE
-		Animation     animation;  // Animation @SERIALIZABLE
-		AnimationMask mask;       // Animation mask @SERIALIZABLE
-		float         weight;     // State weight @SERIALIZABLE
-		float         workWeight; // State working weight, using for blendings
+		String    name;       // State name @SERIALIZABLE
+		Animation animation;  // Animation @SERIALIZABLE
+		float     weight;     // State weight @SERIALIZABLE
+		float     workWeight; // State working weight, using for blendings
 
 		// Default constructor
 		AnimationState();
@@ -27,10 +26,21 @@ namespace o2
 		// Constructor with name
 		AnimationState(const String& name);
 
+		// Sets mask and updates owner's masks weights
+		void SetMask(const AnimationMask& mask);
+
+		// Returns mask
+		const AnimationMask& GetMask() const;
+
 		SERIALIZABLE(AnimationState);
 
 	protected:
-		Animatable* mOwner; // Animatable owner
+		AnimationMask mMask;  // Animation mask. Owner's values caches masks weights, so it's changed only by SetMask @SERIALIZABLE
+		Animatable*   mOwner; // Animatable owner
+
+	protected:
+		// It is called when object was deserialized; updates owner's masks weights
+		void OnDeserialized(const DataNode& node);
 
 		friend class Animatable;
 		friend class ANimation;
@@ -105,6 +105,7 @@ namespace o2
 	void ActorAsset::LoadData(const String& path)
 	{
 		DataNode data;
+		data.EnableArena();
 		data.LoadFromFile(path);
 		mActor->Deserialize(data);
 		mActor->mIsAsset = true;
@@ -26,6 +26,11 @@ namespace o2
 		return false;
 	}
 
+	RectF CursorAreaEventsListener::GetCursorAreaBounds() const
+	{
+		return mScissorRect;
+	}
+
 	bool CursorAreaEventsListener::IsScrollable() const
 	{
 		return false;
@@ -31,6 +31,9 @@ namespace o2
 		// Returns true if point is in this object
 		virtual bool IsUnderPoint(const Vec2F& point);
 
+		// Returns rectangle, out of which point can't be under this object. Returns scissor rect by default
+		virtual RectF GetCursorAreaBounds() const;
+
 		// Returns is listener scrollable
 		virtual bool IsScrollable() const;
 
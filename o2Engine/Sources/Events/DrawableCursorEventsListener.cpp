@@ -47,6 +47,11 @@ namespace o2
 		return mEventHandleDrawable ? mEventHandleDrawable->IsUnderPoint(point) : false;
 	}
 
+	RectF DrawableCursorEventsListener::GetCursorAreaBounds() const
+	{
+		return mEventHandleDrawable ? mEventHandleDrawable->GetUnderPointBounds() : RectF();
+	}
+
 	void DrawableCursorEventsListener::OnDrawn()
 	{
 		CursorAreaEventsListener::OnDrawn();
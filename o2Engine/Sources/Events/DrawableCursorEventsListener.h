@@ -30,6 +30,9 @@ namespace o2
 		// Returns true if point is in this object
 		bool IsUnderPoint(const Vec2F& point);
 
+		// Returns event handling drawable bounds
+		RectF GetCursorAreaBounds() const;
+
 	protected:
 		IDrawable* mEventHandleDrawable;
 
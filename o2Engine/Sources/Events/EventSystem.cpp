@@ -37,6 +37,7 @@ namespace o2
 	{
 		mAreaCursorListeners.Reverse();
 		mDragListeners.Reverse();
+		mAreaListenersGridDirty = true;
 
 		mLastUnderCursorListeners = mUnderCursorListeners;
 		mUnderCursorListeners.Clear();
@@ -117,6 +118,7 @@ namespace o2
 	{
 		mAreaCursorListeners.Clear();
 		mDragListeners.Clear();
+		mAreaListenersGridDirty = true;
 	}
 
 	void EventSystem::OnApplicationStarted()
@@ -149,11 +151,97 @@ namespace o2
 			listener->OnApplicationSized();
 	}
 
+	void EventSystem::UpdateAreaListenersGrid()
+	{
+		mAreaListenersGridDirty = false;
+
+		Vec2I resolution = o2Render.GetResolution();
+		mAreaListenersGridRect = RectF(-resolution.x*0.5f, resolution.y*0.5f, resolution.x*0.5f, -resolution.y*0.5f);
+
+		mAreaListenersGridSize.x = Math::Clamp(resolution.x/mAreaListenersGridMinCellSize, 1, mAreaListenersGridMaxSize);
+		mAreaListenersGridSize.y = Math::Clamp(resolution.y/mAreaListenersGridMinCellSize, 1, mAreaListenersGridMaxSize);
+
+		mAreaListenersGridCellSize.x = Math::Max(mAreaListenersGridRect.Width()/mAreaListenersGridSize.x, 1.0f);
+		mAreaListenersGridCellSize.y = Math::Max(mAreaListenersGridRect.Height()/mAreaListenersGridSize.y, 1.0f);
+
+		int cellsCount = mAreaListenersGridSize.x*mAreaListenersGridSize.y;
+		mAreaListenersGrid.Resize(cellsCount);
+		for (auto& cell : mAreaListenersGrid)
+			cell.Clear();
+
+		mWideAreaListeners.Clear();
+		mAreaCursorListenersBounds.Clear();
+
+		int wideListenerCellsCount = cellsCount/4;
+		for (int i = 0; i < mAreaCursorListeners.Count(); i++)
+		{
+			CursorAreaEventsListener* listener = mAreaCursorListeners[i];
+			RectF bounds = listener->GetCursorAreaBounds();
+
+			if (!bounds.IsIntersects(listener->mScissorRect))
+			{
+				mAreaCursorListenersBounds.Add(RectF());
+				continue;
+			}
+
+			bounds = bounds.GetIntersection(listener->mScissorRect);
+			mAreaCursorListenersBounds.Add(bounds);
+
+			Vec2I minCell = GetAreaListenersGridCell(bounds.LeftBottom());
+			Vec2I maxCell = GetAreaListenersGridCell(bounds.RightTop());
+
+			if ((maxCell.x - minCell.x + 1)*(maxCell.y - minCell.y + 1) > wideListenerCellsCount)
+			{
+				mWideAreaListeners.Add(i);
+				continue;
+			}
+
+			for (int y = minCell.y; y <= maxCell.y; y++)
+			{
+				for (int x = minCell.x; x <= maxCell.x; x++)
+					mAreaListenersGrid[y*mAreaListenersGridSize.x + x].Add(i);
+			}
+		}
+	}
+
+	Vec2I EventSystem::GetAreaListenersGridCell(const Vec2F& point) const
+	{
+		int x = Math::FloorToInt((point.x - mAreaListenersGridRect.left)/mAreaListenersGridCellSize.x);
+		int y = Math::FloorToInt((point.y - mAreaListenersGridRect.bottom)/mAreaListenersGridCellSize.y);
+
+		return Vec2I(Math::Clamp(x, 0, mAreaListenersGridSize.x - 1), Math::Clamp(y, 0, mAreaListenersGridSize.y - 1));
+	}
+
+	EventSystem::CursorAreaEventsListenersVec EventSystem::GetAreaListenersCandidates(const Vec2F& point)
+	{
+		if (mAreaListenersGridDirty)
+			UpdateAreaListenersGrid();
+
+		Vec2I cellIdx = GetAreaListenersGridCell(point);
+		const ListenersIndexesVec& cell = mAreaListenersGrid[cellIdx.y*mAreaListenersGridSize.x + cellIdx.x];
+
+		CursorAreaEventsListenersVec res;
+		int i = 0, j = 0;
+		while (i < cell.Count() || j < mWideAreaListeners.Count())
+		{
+			int listenerIdx;
+			if (j == mWideAreaListeners.Count() || (i < cell.Count() && cell[i] < mWideAreaListeners[j]))
+				listenerIdx = cell[i++];
+			else
+				listenerIdx = mWideAreaListeners[j++];
+
+			if (mAreaCursorListenersBounds[listenerIdx].IsInside(point))
+				res.Add(mAreaCursorListeners[listenerIdx]);
+		}
+
+		return res;
+	}
+
 	void EventSystem::ProcessCursorTracing(const Input::Cursor& cursor)
 	{
-		for (auto listener : mAreaCursorListeners)
+		for (auto listener : GetAreaListenersCandidates(cursor.position))
 		{
-			if (!listener->IsUnderPoint(cursor.position) || !listener->mScissorRect.IsInside(cursor.position))
+			if (!listener->IsUnderPoint(cursor.position))
 				continue;
 
 			auto drag = dynamic_cast<DragableObject*>(listener);
@@ -198,13 +286,17 @@ namespace o2
 		return nullptr;
 	}
 
-	EventSystem::CursorAreaEventsListenersVec EventSystem::GetAllCursorListenersUnderCursor(CursorId cursorId) const
+	EventSystem::CursorAreaEventsListenersVec EventSystem::GetAllCursorListenersUnderCursor(CursorId cursorId)
+	{
+		return GetAllCursorListenersUnderPoint(o2Input.GetCursorPos(cursorId));
+	}
+
+	EventSystem::CursorAreaEventsListenersVec EventSystem::GetAllCursorListenersUnderPoint(const Vec2F& point)
 	{
 		CursorAreaEventsListenersVec res;
-		Vec2F cursorPos = o2Input.GetCursorPos(cursorId);
-		for (auto listener : mAreaCursorListeners)
+		for (auto listener : GetAreaListenersCandidates(point))
 		{
-			if (!listener->IsUnderPoint(cursorPos) || !listener->mScissorRect.IsInside(cursorPos) || !listener->mInteractable)
+			if (!listener->IsUnderPoint(point) || !listener->mInteractable)
 				continue;
 
 			res.Add(listener);
@@ -408,11 +500,13 @@ namespace o2
 			return;
 
 		mInstance->mAreaCursorListeners.Add(listener);
+		mInstance->mAreaListenersGridDirty = true;
 	}
 
 	void EventSystem::UnregCursorAreaListener(CursorAreaEventsListener* listener)
 	{
 		mInstance->mAreaCursorListeners.Remove(listener);
+		mInstance->mAreaListenersGridDirty = true;
 		mInstance->mPressedListeners.RemoveAll([&](auto x) { return x.Value() == listener; });
 
 		if (mInstance->mRightButtonPressedListener == listener)
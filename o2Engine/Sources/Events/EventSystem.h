@@ -3,6 +3,7 @@
 #include "Application/Input.h"
 #include "Utils/Containers/Dictionary.h"
 #include "Utils/Containers/Vector.h"
+#include "Utils/Math/Rect.h"
 
 #include "Utils/Singleton.h"
 
@@ -30,13 +31,18 @@ namespace o2
 		typedef Vector<KeyboardEventsListener*>                 KeybEventsListenersVec;
 		typedef Vector<ApplicationEventsListener*>              AppEventsListenersVec;
 		typedef Dictionary<CursorId, CursorAreaEventsListener*> CursorListenerDict;
+		typedef Vector<int>                                     ListenersIndexesVec;
+		typedef Vector<ListenersIndexesVec>                     ListenersGridCellsVec;
 
 	public:
 		// Returns drag event listener under cursor
 		CursorAreaEventsListener* GetCursorListenerUnderCursor(CursorId cursorId) const;
 
 		// Returns all cursor listeners under cursor arranged by depth
-		CursorAreaEventsListenersVec GetAllCursorListenersUnderCursor(CursorId cursorId) const;
+		CursorAreaEventsListenersVec GetAllCursorListenersUnderCursor(CursorId cursorId);
+
+		// Returns all interactable cursor listeners under point arranged by depth
+		CursorAreaEventsListenersVec GetAllCursorListenersUnderPoint(const Vec2F& point);
 
 		// Breaks cursor event. All pressed listeners will be unpressed with specific event OnPressBreak
 		void BreakCursorEvent();
@@ -72,6 +78,15 @@ namespace o2
 		// It is called when application frame was sized
 		void OnApplicationSized();
 
+		// Rebuilds area listeners grid by listeners bounds
+		void UpdateAreaListenersGrid();
+
+		// Returns area listeners grid cell by point. Points out of grid are clamped to border cells
+		Vec2I GetAreaListenersGridCell(const Vec2F& point) const;
+
+		// Returns area listeners, which bounds contains point, arranged by depth. Rebuilds grid if needed
+		CursorAreaEventsListenersVec GetAreaListenersCandidates(const Vec2F& point);
+
 		// processes cursor tracing for cursor
 		void ProcessCursorTracing(const Input::Cursor& cursor);
 
@@ -121,10 +136,20 @@ namespace o2
 		void ProcessKeyReleased(const Input::Key& key);
 
 	protected:
+		static const int mAreaListenersGridMaxSize = 64;     // Maximum cells count by each axis in area listeners grid
+		static const int mAreaListenersGridMinCellSize = 32; // Minimum size of area listeners grid cell in pixels
+
 		float                        mDblClickTime = 0.3f;                   // Time between clicks for double click reaction
 
 		CursorEventsListenersVec     mCursorListeners;                       // All cursor non area listeners
 		CursorAreaEventsListenersVec mAreaCursorListeners;                   // All cursor area listeners
+		Vector<RectF>                mAreaCursorListenersBounds;             // Bounds of area listeners, limited by scissor rects
+		ListenersGridCellsVec        mAreaListenersGrid;                     // Grid cells with indexes of area listeners, which bounds intersects cell. Sorted by depth
+		ListenersIndexesVec          mWideAreaListeners;                     // Indexes of area listeners, which bounds covers big part of grid. Sorted by depth
+		RectF                        mAreaListenersGridRect;                 // Area listeners grid rectangle
+		Vec2I                        mAreaListenersGridSize;                 // Area listeners grid cells count by axes
+		Vec2F                        mAreaListenersGridCellSize;             // Area listeners grid cell size
+		bool                         mAreaListenersGridDirty = true;         // Is area listeners grid need to be rebuilt
 		CursorListenerDict           mPressedListeners;                      // Pressed listeners for all pressed cursors
 		CursorAreaEventsListener*    mRightButtonPressedListener = nullptr;  // Right mouse button pressed listener
 		CursorAreaEventsListener*    mMiddleButtonPressedListener = nullptr; // Middle mouse button pressed listener
@@ -37,7 +37,8 @@ namespace o2
 		{
 			String textureName = commonNode.attribute(L"texture").value();
 			ImageAssetRef image(textureName);
-			mTexture = image->GetAtlasTextureRef();
+			mTextures.Clear();
+			mTextures.Add(image->GetAtlasTextureRef());
 			mTextureSrcRect = image->GetAtlasRect();
 
 			mBaseHeight = commonNode.attribute(L"base").as_float();
@@ -69,6 +70,8 @@ namespace o2
 				newChar.mAdvance = charNode.attribute(L"xadvance").as_float();
 
 				newChar.mId = charNode.attribute(L"id").as_uint();
+				newChar.mHeight = 0;
+				newChar.mPage = 0;
 
 				mCharacters.Add(newChar);
 			}
@@ -79,7 +82,7 @@ namespace o2
 			return false;
 		}
 
-		Vec2F invTexSize(1.0f/mTexture->GetSize().x, 1.0f/mTexture->GetSize().y);
+		Vec2F invTexSize(1.0f/mTextures[0]->GetSize().x, 1.0f/mTextures[0]->GetSize().y);
 		for (auto& ch : mCharacters)
 		{
 			ch.mSize = ch.mTexSrc.Size().InvertedY();
@@ -89,6 +92,8 @@ namespace o2
 			ch.mTexSrc.bottom *= invTexSize.y;
 		}
 
+		UpdateCharactersIndexes();
+
 		mReady = true;
 		return true;
 	}
@@ -110,11 +115,11 @@ namespace o2
 
 	const Font::Character& BitmapFont::GetCharacter(UInt16 id, int height)
 	{
-		for (const Character& ch : mCharacters)
-			if (ch.mId == id)
-				return ch;
+		int idx = FindCharacterIdx(id, 0);
+		if (idx < 0)
+			return mCharacters.Get(0);
 
-		return mCharacters.Get(0);
+		return mCharacters[idx];
 	}
 
 }
\ No newline at end of file
@@ -11,7 +11,7 @@ namespace o2
 	}
 
 	Font::Font(const Font& font):
-		mCharacters(font.mCharacters), mTexture(font.mTexture), 
+		mCharacters(font.mCharacters), mCharactersIndexes(font.mCharactersIndexes), mTextures(font.mTextures),
 		mTextureSrcRect(font.mTextureSrcRect), mReady(font.mReady)
 	{
 		o2Render.mFonts.Add(this);
@@ -34,11 +34,11 @@ namespace o2
 
 	const Font::Character& Font::GetCharacter(UInt16 id, int height)
 	{
-		for (const Character& ch : mCharacters)
-			if (ch.mId == id && height == ch.mHeight)
-				return ch;
+		int idx = FindCharacterIdx(id, height);
+		if (idx < 0)
+			return mCharacters.Get(0);
 
-		return mCharacters.Get(0);
+		return mCharacters[idx];
 	}
 
 	void Font::CheckCharacters(const WString& needChararacters, int height)
@@ -49,6 +49,28 @@ namespace o2
 		return String();
 	}
 
+	int Font::FindCharacterIdx(UInt16 id, int height) const
+	{
+		if (const int* idx = mCharactersIndexes.TryGet(GetCharacterKey(id, height)))
+			return *idx;
+
+		return -1;
+	}
+
+	void Font::UpdateCharactersIndexes()
+	{
+		mCharactersIndexes.Clear();
+		mCharactersIndexes.Reserve(mCharacters.Count());
+
+		for (int i = 0; i < mCharacters.Count(); i++)
+			mCharactersIndexes.Add(GetCharacterKey(mCharacters[i].mId, mCharacters[i].mHeight), i);
+	}
+
+	UInt Font::GetCharacterKey(UInt16 id, int height)
+	{
+		return ((UInt)height << 16) | id;
+	}
+
 	bool Font::Character::operator==(const Character& other) const
 	{
 		return mId == other.mId && mHeight == other.mHeight;
@@ -5,6 +5,7 @@
 
 #include "Render/TextureRef.h"
 #include "Utils/CommonTypes.h"
+#include "Utils/Containers/HashDictionary.h"
 #include "Utils/Containers/Vector.h"
 #include "Utils/Delegates.h"
 #include "Utils/Math/Rect.h"
@@ -17,9 +18,9 @@ namespace o2
 	class Render;
 	class FontRef;
 
-	// -----------------------------------------------------------
-	// Font. Containing array of symbol glyphs, symbol index table
-	// -----------------------------------------------------------
+	// -----------------------------------------------------------------------------
+	// Font. Containing array of symbol glyphs, symbol index table and textures pages
+	// -----------------------------------------------------------------------------
 	class Font
 	{
 	protected:
@@ -64,19 +65,33 @@ namespace o2
 			float  mAdvance; // Symbol advance
 			UInt16 mId;      // Character id
 			int    mHeight;  // Character height
+			int    mPage;    // Index of texture page, -1 when glyph isn't placed on page
 
 			bool operator==(const Character& other) const;
 		};
 		typedef Vector<Character> CharactersVec;
+		typedef HashDictionary<UInt, int> CharactersIndexesDict;
 
 		typedef Vector<FontRef*> FontRefsVec;
+		typedef Vector<TextureRef> TexturesVec;
 
 	protected:
-		FontRefsVec   mRefs;           // Array of reference to this font
-		CharactersVec mCharacters;     // Characters array
-		TextureRef    mTexture;        // Texture
-		RectI         mTextureSrcRect; // Texture source rectangle
-		bool          mReady;          // True when font is ready to use
+		FontRefsVec           mRefs;              // Array of reference to this font
+		CharactersVec         mCharacters;        // Characters array
+		CharactersIndexesDict mCharactersIndexes; // Indexes of characters in array by id and height key
+		TexturesVec           mTextures;          // Textures of pages
+		RectI                 mTextureSrcRect;    // Texture source rectangle. Vector font keeps here first page rectangle
+		bool                  mReady;             // True when font is ready to use
+
+	protected:
+		// Returns index of character by id and height, or -1 when character isn't cached
+		int FindCharacterIdx(UInt16 id, int height) const;
+
+		// Rebuilds characters indexes. Must be called after changing characters array
+		void UpdateCharactersIndexes();
+
+		// Returns key of character in indexes dictionary
+		static UInt GetCharacterKey(UInt16 id, int height);
 
 		friend class Text;
 		friend class FontRef;
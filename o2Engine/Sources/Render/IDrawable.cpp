@@ -14,6 +14,11 @@ namespace o2
 		return false;
 	}
 
+	RectF IDrawable::GetUnderPointBounds() const
+	{
+		return mDrawingScissorRect;
+	}
+
 	void IDrawable::OnDrawn()
 	{
 		mDrawingScissorRect = o2Render.GetResScissorRect();
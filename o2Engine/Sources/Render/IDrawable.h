@@ -20,6 +20,9 @@ namespace o2
 		// Returns true if point is under drawable
 		virtual bool IsUnderPoint(const Vec2F& point);
 
+		// Returns rectangle, out of which point can't be under drawable. Returns scissor rect at last drawing by default
+		virtual RectF GetUnderPointBounds() const;
+
 	protected:
 		RectF mDrawingScissorRect; // Scissor rectangle at last drawing
 
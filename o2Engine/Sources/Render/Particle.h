@@ -15,13 +15,14 @@ namespace o2
 		Vec2F  size;       // Size of particle
 		Color4 color;      // Particle's color
 		float  time;       // Estimate life time
-		bool   alive;      // Is particle alive
+		float  lifetime;   // Full life time
 
 		bool operator==(const Particle& other) const
 		{
-			return position == position && velocity == velocity && Math::Equals(angle, other.angle) &&
-				Math::Equals(angleSpeed, other.angleSpeed) && Math::Equals(time, other.time) && size == other.size &&
-				color == other.color && alive == other.alive;
+			return position == other.position && velocity == other.velocity && Math::Equals(angle, other.angle) &&
+				Math::Equals(angleSpeed, other.angleSpeed) && Math::Equals(time, other.time) && Math::Equals(lifetime, other.lifetime) &&
+				size == other.size &&
+				color == other.color;
 		}
 	};
 }
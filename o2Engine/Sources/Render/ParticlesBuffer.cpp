@@ -0,0 +1,388 @@
+#include "ParticlesBuffer.h"
+
+#include <string.h>
+#include "Utils/Math/Math.h"
+#include "Utils/Memory/MemoryManager.h"
+
+#if defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PARTICLES_SSE
+#include <emmintrin.h>
+#endif
+
+namespace o2
+{
+	// Returns color channel in 0...255 range from 0...1 value
+	static inline ULong ColorChannelByte(float value)
+	{
+		return (ULong)(Math::Clamp01(value)*255.0f + 0.5f);
+	}
+
+#ifdef PARTICLES_SSE
+	// Returns a where mask is set, otherwise b
+	static inline __m128 SelectPS(__m128 mask, __m128 a, __m128 b)
+	{
+		return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+	}
+
+	// Returns four color channels in 0...255 range from 0...1 values, rounded same as ColorChannelByte
+	static inline __m128i ColorChannelBytePS(__m128 values)
+	{
+		__m128 clamped = _mm_min_ps(_mm_max_ps(values, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+		return _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(clamped, _mm_set1_ps(255.0f)), _mm_set1_ps(0.5f)));
+	}
+
+	// Returns sine of four angles in radians. Angle is reduced to [-pi/2, pi/2], then approximated by polynomial
+	static inline __m128 SinPS(__m128 x)
+	{
+		const __m128 pi = _mm_set1_ps(3.14159265f);
+		const __m128 halfPi = _mm_set1_ps(1.57079633f);
+		const __m128 twoPi = _mm_set1_ps(6.28318531f);
+		const __m128 invTwoPi = _mm_set1_ps(0.159154943f);
+
+		__m128 turns = _mm_cvtepi32_ps(_mm_cvtps_epi32(_mm_mul_ps(x, invTwoPi)));
+		x = _mm_sub_ps(x, _mm_mul_ps(turns, twoPi));
+
+		// sin(x) = sin(pi - x) = sin(-pi - x)
+		x = SelectPS(_mm_cmpgt_ps(x, halfPi), _mm_sub_ps(pi, x), x);
+		x = SelectPS(_mm_cmplt_ps(x, _mm_sub_ps(_mm_setzero_ps(), halfPi)), _mm_sub_ps(_mm_sub_ps(_mm_setzero_ps(), pi), x), x);
+
+		__m128 x2 = _mm_mul_ps(x, x);
+		__m128 res = _mm_set1_ps(2.75573192e-6f);
+		res = _mm_add_ps(_mm_mul_ps(res, x2), _mm_set1_ps(-1.98412698e-4f));
+		res = _mm_add_ps(_mm_mul_ps(res, x2), _mm_set1_ps(8.33333333e-3f));
+		res = _mm_add_ps(_mm_mul_ps(res, x2), _mm_set1_ps(-1.66666667e-1f));
+		res = _mm_add_ps(_mm_mul_ps(res, x2), _mm_set1_ps(1.0f));
+
+		return _mm_mul_ps(res, x);
+	}
+#endif
+
+	ParticlesBuffer::ParticlesBuffer():
+		mData(nullptr), mCount(0), mCapacity(0)
+	{
+		for (int i = 0; i < ChannelsCount; i++)
+			mChannels[i] = nullptr;
+	}
+
+	ParticlesBuffer::ParticlesBuffer(const ParticlesBuffer& other):
+		ParticlesBuffer()
+	{
+		*this = other;
+	}
+
+	ParticlesBuffer::~ParticlesBuffer()
+	{
+		if (mData)
+			mfree(mData);
+	}
+
+	ParticlesBuffer& ParticlesBuffer::operator=(const ParticlesBuffer& other)
+	{
+		if (&other == this)
+			return *this;
+
+		mCount = 0;
+		if (mCapacity < other.mCount)
+			Reallocate(other.mCount);
+
+		mCount = other.mCount;
+		if (mCount > 0)
+		{
+			for (int i = 0; i < ChannelsCount; i++)
+				memcpy(mChannels[i], other.mChannels[i], sizeof(float)*mCount);
+		}
+
+		return *this;
+	}
+
+	int ParticlesBuffer::Count() const
+	{
+		return mCount;
+	}
+
+	bool ParticlesBuffer::IsEmpty() const
+	{
+		return mCount == 0;
+	}
+
+	int ParticlesBuffer::GetCapacity() const
+	{
+		return mCapacity;
+	}
+
+	void ParticlesBuffer::Reserve(int capacity)
+	{
+		if (capacity > mCapacity)
+			Reallocate(capacity);
+	}
+
+	int ParticlesBuffer::Add(const Particle& particle)
+	{
+		if (mCount == mCapacity)
+			Reallocate(Math::Max(mCapacity*2, 16));
+
+		mCount++;
+		Set(mCount - 1, particle);
+
+		mChannels[BaseSizeX][mCount - 1] = particle.size.x;
+		mChannels[BaseSizeY][mCount - 1] = particle.size.y;
+
+		return mCount - 1;
+	}
+
+	void ParticlesBuffer::RemoveAt(int idx)
+	{
+		mCount--;
+
+		if (idx == mCount)
+			return;
+
+		for (int i = 0; i < ChannelsCount; i++)
+			mChannels[i][idx] = mChannels[i][mCount];
+	}
+
+	void ParticlesBuffer::Truncate(int count)
+	{
+		mCount = Math::Clamp(count, 0, mCount);
+	}
+
+	void ParticlesBuffer::Clear()
+	{
+		mCount = 0;
+	}
+
+	Particle ParticlesBuffer::Get(int idx) const
+	{
+		Particle res;
+		res.position.Set(mChannels[PositionX][idx], mChannels[PositionY][idx]);
+		res.velocity.Set(mChannels[VelocityX][idx], mChannels[VelocityY][idx]);
+		res.angle = mChannels[Angle][idx];
+		res.angleSpeed = mChannels[AngleSpeed][idx];
+		res.size.Set(mChannels[SizeX][idx], mChannels[SizeY][idx]);
+		res.color = Color4(mChannels[ColorR][idx], mChannels[ColorG][idx], mChannels[ColorB][idx], mChannels[ColorA][idx]);
+		res.time = mChannels[Time][idx];
+		res.lifetime = mChannels[Lifetime][idx];
+
+		return res;
+	}
+
+	void ParticlesBuffer::Set(int idx, const Particle& particle)
+	{
+		mChannels[PositionX][idx] = particle.position.x;
+		mChannels[PositionY][idx] = particle.position.y;
+		mChannels[VelocityX][idx] = particle.velocity.x;
+		mChannels[VelocityY][idx] = particle.velocity.y;
+		mChannels[Angle][idx] = particle.angle;
+		mChannels[AngleSpeed][idx] = particle.angleSpeed;
+		mChannels[SizeX][idx] = particle.size.x;
+		mChannels[SizeY][idx] = particle.size.y;
+		mChannels[ColorR][idx] = particle.color.RF();
+		mChannels[ColorG][idx] = particle.color.GF();
+		mChannels[ColorB][idx] = particle.color.BF();
+		mChannels[ColorA][idx] = particle.color.AF();
+		mChannels[Time][idx] = particle.time;
+		mChannels[Lifetime][idx] = particle.lifetime;
+	}
+
+	float* ParticlesBuffer::GetChannel(Channel channel)
+	{
+		return mChannels[channel];
+	}
+
+	const float* ParticlesBuffer::GetChannel(Channel channel) const
+	{
+		return mChannels[channel];
+	}
+
+	void ParticlesBuffer::Integrate(float dt)
+	{
+		float* px = mChannels[PositionX];
+		float* py = mChannels[PositionY];
+		float* vx = mChannels[VelocityX];
+		float* vy = mChannels[VelocityY];
+		float* angle = mChannels[Angle];
+		float* angleSpeed = mChannels[AngleSpeed];
+		float* time = mChannels[Time];
+
+		int i = 0;
+
+#ifdef PARTICLES_SSE
+		__m128 dt4 = _mm_set1_ps(dt);
+		for (; i + 4 <= mCount; i += 4)
+		{
+			_mm_storeu_ps(px + i, _mm_add_ps(_mm_loadu_ps(px + i), _mm_mul_ps(_mm_loadu_ps(vx + i), dt4)));
+			_mm_storeu_ps(py + i, _mm_add_ps(_mm_loadu_ps(py + i), _mm_mul_ps(_mm_loadu_ps(vy + i), dt4)));
+			_mm_storeu_ps(angle + i, _mm_add_ps(_mm_loadu_ps(angle + i), _mm_mul_ps(_mm_loadu_ps(angleSpeed + i), dt4)));
+			_mm_storeu_ps(time + i, _mm_sub_ps(_mm_loadu_ps(time + i), dt4));
+		}
+#endif
+
+		for (; i < mCount; i++)
+		{
+			px[i] += vx[i]*dt;
+			py[i] += vy[i]*dt;
+			angle[i] += angleSpeed[i]*dt;
+			time[i] -= dt;
+		}
+	}
+
+	int ParticlesBuffer::RemoveExpired()
+	{
+		const float* time = mChannels[Time];
+		int initialCount = mCount;
+
+		// Whole blocks of alive particles are skipped, particle moved on removed place is checked again
+		for (int i = 0; i < mCount; i += 4)
+		{
+#ifdef PARTICLES_SSE
+			if (i + 4 <= mCount && _mm_movemask_ps(_mm_cmplt_ps(_mm_loadu_ps(time + i), _mm_setzero_ps())) == 0)
+				continue;
+#endif
+
+			for (int j = i; j < i + 4 && j < mCount;)
+			{
+				if (time[j] < 0.0f)
+					RemoveAt(j);
+				else
+					j++;
+			}
+		}
+
+		return initialCount - mCount;
+	}
+
+	void ParticlesBuffer::Transform(const Basis& basis)
+	{
+		float* px = mChannels[PositionX];
+		float* py = mChannels[PositionY];
+
+		for (int i = 0; i < mCount; i++)
+		{
+			float x = px[i], y = py[i];
+			px[i] = basis.xv.x*x + basis.yv.x*y + basis.offs.x;
+			py[i] = basis.xv.y*x + basis.yv.y*y + basis.offs.y;
+		}
+	}
+
+	int ParticlesBuffer::BuildQuads(Vertex2* vertices, const RectF& uvRect) const
+	{
+		const float* px = mChannels[PositionX];
+		const float* py = mChannels[PositionY];
+		const float* angle = mChannels[Angle];
+		const float* sx = mChannels[SizeX];
+		const float* sy = mChannels[SizeY];
+		const float* cr = mChannels[ColorR];
+		const float* cg = mChannels[ColorG];
+		const float* cb = mChannels[ColorB];
+		const float* ca = mChannels[ColorA];
+
+		Vertex2* v = vertices;
+		int i = 0;
+
+#ifdef PARTICLES_SSE
+		const __m128 half = _mm_set1_ps(0.5f);
+		const __m128 halfPi = _mm_set1_ps(1.57079633f);
+		const __m128 zero = _mm_setzero_ps();
+
+		float corners[8][4];
+		UInt colors[4];
+
+		for (; i + 4 <= mCount; i += 4)
+		{
+			__m128 a = _mm_loadu_ps(angle + i);
+			__m128 sn = SinPS(a);
+			__m128 cs = SinPS(_mm_add_ps(a, halfPi));
+
+			__m128 hsx = _mm_mul_ps(_mm_loadu_ps(sx + i), half);
+			__m128 hsy = _mm_mul_ps(_mm_loadu_ps(sy + i), half);
+
+			__m128 xvx = _mm_mul_ps(cs, hsx), xvy = _mm_mul_ps(sn, hsx);
+			__m128 yvx = _mm_sub_ps(zero, _mm_mul_ps(sn, hsy)), yvy = _mm_mul_ps(cs, hsy);
+
+			__m128 ox = _mm_loadu_ps(px + i), oy = _mm_loadu_ps(py + i);
+
+			_mm_storeu_ps(corners[0], _mm_add_ps(_mm_sub_ps(ox, xvx), yvx));
+			_mm_storeu_ps(corners[1], _mm_add_ps(_mm_sub_ps(oy, xvy), yvy));
+			_mm_storeu_ps(corners[2], _mm_add_ps(_mm_add_ps(ox, xvx), yvx));
+			_mm_storeu_ps(corners[3], _mm_add_ps(_mm_add_ps(oy, xvy), yvy));
+			_mm_storeu_ps(corners[4], _mm_sub_ps(_mm_add_ps(ox, xvx), yvx));
+			_mm_storeu_ps(corners[5], _mm_sub_ps(_mm_add_ps(oy, xvy), yvy));
+			_mm_storeu_ps(corners[6], _mm_sub_ps(_mm_sub_ps(ox, xvx), yvx));
+			_mm_storeu_ps(corners[7], _mm_sub_ps(_mm_sub_ps(oy, xvy), yvy));
+
+			__m128i r = ColorChannelBytePS(_mm_loadu_ps(cr + i));
+			__m128i g = ColorChannelBytePS(_mm_loadu_ps(cg + i));
+			__m128i b = ColorChannelBytePS(_mm_loadu_ps(cb + i));
+			__m128i al = ColorChannelBytePS(_mm_loadu_ps(ca + i));
+
+			__m128i argb = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(al, 24), _mm_slli_epi32(r, 16)),
+										_mm_or_si128(_mm_slli_epi32(g, 8), b));
+			_mm_storeu_si128((__m128i*)colors, argb);
+
+			for (int j = 0; j < 4; j++)
+			{
+				ULong color = colors[j];
+				(v++)->Set(corners[0][j], corners[1][j], color, uvRect.left, uvRect.top);
+				(v++)->Set(corners[2][j], corners[3][j], color, uvRect.right, uvRect.top);
+				(v++)->Set(corners[4][j], corners[5][j], color, uvRect.right, uvRect.bottom);
+				(v++)->Set(corners[6][j], corners[7][j], color, uvRect.left, uvRect.bottom);
+			}
+		}
+#endif
+
+		for (; i < mCount; i++)
+		{
+			float sn = Math::Sin(angle[i]), cs = Math::Cos(angle[i]);
+			float hsx = sx[i]*0.5f, hsy = sy[i]*0.5f;
+			Vec2F xv(cs*hsx, sn*hsx);
+			Vec2F yv(-sn*hsy, cs*hsy);
+			Vec2F o(px[i], py[i]);
+			ULong color = (ColorChannelByte(ca[i]) << 24) | (ColorChannelByte(cr[i]) << 16) |
+				(ColorChannelByte(cg[i]) << 8) | ColorChannelByte(cb[i]);
+
+			(v++)->Set(o - xv + yv, color, uvRect.left, uvRect.top);
+			(v++)->Set(o + xv + yv, color, uvRect.right, uvRect.top);
+			(v++)->Set(o + xv - yv, color, uvRect.right, uvRect.bottom);
+			(v++)->Set(o - xv - yv, color, uvRect.left, uvRect.bottom);
+		}
+
+		return mCount*4;
+	}
+
+	void ParticlesBuffer::FillQuadsIndexes(UInt16* indexes, int quadsCount)
+	{
+		for (int i = 0; i < quadsCount; i++)
+		{
+			UInt16 first = (UInt16)(i*4);
+			*(indexes++) = first;
+			*(indexes++) = first + 1;
+			*(indexes++) = first + 2;
+
+			*(indexes++) = first;
+			*(indexes++) = first + 2;
+			*(indexes++) = first + 3;
+		}
+	}
+
+	void ParticlesBuffer::Reallocate(int capacity)
+	{
+		// Capacity is rounded to SIMD width
+		capacity = (capacity + 3) & ~3;
+
+		float* data = (float*)mmalloc(sizeof(float)*capacity*ChannelsCount);
+		for (int i = 0; i < ChannelsCount; i++)
+		{
+			float* channel = data + i*capacity;
+			if (mCount > 0)
+				memcpy(channel, mChannels[i], sizeof(float)*mCount);
+
+			mChannels[i] = channel;
+		}
+
+		if (mData)
+			mfree(mData);
+
+		mData = data;
+		mCapacity = capacity;
+	}
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "Render/Particle.h"
+#include "Utils/CommonTypes.h"
+#include "Utils/Math/Basis.h"
+#include "Utils/Math/Rect.h"
+#include "Utils/Math/Vertex2.h"
+
+namespace o2
+{
+	// -----------------------------------------------------------------------------------------
+	// Particles storage in structure of arrays layout. Stores only alive particles: removed
+	// particle is replaced by last one. Update and mesh building kernels processes four
+	// particles at once with SSE, or one by one when SSE isn't available. Base size channels
+	// keep emitted size for effects, which changes size
+	// -----------------------------------------------------------------------------------------
+	class ParticlesBuffer
+	{
+	public:
+		// Particles parameters channels
+		enum Channel
+		{
+			PositionX, PositionY, VelocityX, VelocityY, Angle, AngleSpeed, SizeX, SizeY,
+			ColorR, ColorG, ColorB, ColorA, Time, Lifetime, BaseSizeX, BaseSizeY, ChannelsCount
+		};
+
+	public:
+		// Default constructor
+		ParticlesBuffer();
+
+		// Copy-constructor
+		ParticlesBuffer(const ParticlesBuffer& other);
+
+		// Destructor
+		~ParticlesBuffer();
+
+		// Copy-operator
+		ParticlesBuffer& operator=(const ParticlesBuffer& other);
+
+		// Returns count of particles
+		int Count() const;
+
+		// Returns is buffer empty
+		bool IsEmpty() const;
+
+		// Returns count of particles, that can be stored without reallocation
+		int GetCapacity() const;
+
+		// Reserves memory for particles
+		void Reserve(int capacity);
+
+		// Adds particle to the end and returns it's index. Particle size is used as base size
+		int Add(const Particle& particle);
+
+		// Removes particle by index, last particle is moved on it's place
+		void RemoveAt(int idx);
+
+		// Removes last particles, leaves only first count particles
+		void Truncate(int count);
+
+		// Removes all particles
+		void Clear();
+
+		// Returns particle by index
+		Particle Get(int idx) const;
+
+		// Sets particle by index
+		void Set(int idx, const Particle& particle);
+
+		// Returns channel array. Array is valid until particles adding or reserving
+		float* GetChannel(Channel channel);
+
+		// Returns channel array. Array is valid until particles adding or reserving
+		const float* GetChannel(Channel channel) const;
+
+		// Moves and rotates particles by their speeds, decreases life time
+		void Integrate(float dt);
+
+		// Removes particles with expired life time. Returns count of removed particles
+		int RemoveExpired();
+
+		// Transforms particles positions by basis
+		void Transform(const Basis& basis);
+
+		// Writes four vertices for each particle, returns count of written vertices
+		int BuildQuads(Vertex2* vertices, const RectF& uvRect) const;
+
+		// Writes indexes of two triangles for each of quads
+		static void FillQuadsIndexes(UInt16* indexes, int quadsCount);
+
+	protected:
+		float* mData;                     // Channels data block, channel arrays are placed one by one
+		float* mChannels[ChannelsCount];  // Channels arrays in data block
+		int    mCount;                    // Count of particles
+		int    mCapacity;                 // Size of each channel array, multiple of 4
+
+	protected:
+		// Reallocates data block with new capacity and copies particles
+		void Reallocate(int capacity);
+	};
+}
@@ -4,13 +4,189 @@
 
 namespace o2
 {
+	// Returns particle's life coefficient in 0...1 range
+	static inline float GetLifeCoef(float time, float lifetime)
+	{
+		return lifetime > FLT_EPSILON ? Math::Clamp01(1.0f - time/lifetime) : 1.0f;
+	}
+
 	void ParticlesEffect::Update(float dt, ParticlesEmitter* emitter)
 	{}
 
-	Vector<Particle>& ParticlesEffect::GetParticlesDirect(ParticlesEmitter* emitter)
+	void ParticlesEffect::UpdateRange(float dt, ParticlesBuffer& particles, int begin, int end) const
+	{}
+
+	ParticlesBuffer& ParticlesEffect::GetParticlesDirect(ParticlesEmitter* emitter)
 	{
 		return emitter->mParticles;
 	}
+
+	void ParticlesEffect::SampleCurve(const Curve& curve, float* samples)
+	{
+		float positions[mCurveSamplesCount];
+		float step = 1.0f/(float)(mCurveSamplesCount - 1);
+		for (int i = 0; i < mCurveSamplesCount; i++)
+			positions[i] = (float)i*step;
+
+		curve.Evaluate(positions, samples, mCurveSamplesCount);
+	}
+
+	float ParticlesEffect::GetCurveSample(const float* samples, float coef)
+	{
+		float position = coef*(float)(mCurveSamplesCount - 1);
+		int idx = Math::Min((int)position, mCurveSamplesCount - 2);
+
+		return Math::Lerp(samples[idx], samples[idx + 1], position - (float)idx);
+	}
+
+	void ParticlesColorEffect::Update(float dt, ParticlesEmitter* emitter)
+	{
+		SampleCurve(curve, mSamples);
+
+		mColorA[0] = colorA.RF(); mColorA[1] = colorA.GF(); mColorA[2] = colorA.BF(); mColorA[3] = colorA.AF();
+		mColorB[0] = colorB.RF(); mColorB[1] = colorB.GF(); mColorB[2] = colorB.BF(); mColorB[3] = colorB.AF();
+	}
+
+	void ParticlesColorEffect::UpdateRange(float dt, ParticlesBuffer& particles, int begin, int end) const
+	{
+		const float* time = particles.GetChannel(ParticlesBuffer::Time);
+		const float* lifetime = particles.GetChannel(ParticlesBuffer::Lifetime);
+		float* colors[4] = { particles.GetChannel(ParticlesBuffer::ColorR), particles.GetChannel(ParticlesBuffer::ColorG),
+							 particles.GetChannel(ParticlesBuffer::ColorB), particles.GetChannel(ParticlesBuffer::ColorA) };
+
+		float colorDiff[4];
+		for (int j = 0; j < 4; j++)
+			colorDiff[j] = mColorB[j] - mColorA[j];
+
+		for (int i = begin; i < end; i++)
+		{
+			float coef = GetCurveSample(mSamples, GetLifeCoef(time[i], lifetime[i]));
+
+			for (int j = 0; j < 4; j++)
+				colors[j][i] = mColorA[j] + colorDiff[j]*coef;
+		}
+	}
+
+	void ParticlesSizeEffect::Update(float dt, ParticlesEmitter* emitter)
+	{
+		SampleCurve(curve, mSamples);
+	}
+
+	void ParticlesSizeEffect::UpdateRange(float dt, ParticlesBuffer& particles, int begin, int end) const
+	{
+		const float* time = particles.GetChannel(ParticlesBuffer::Time);
+		const float* lifetime = particles.GetChannel(ParticlesBuffer::Lifetime);
+		const float* baseSizeX = particles.GetChannel(ParticlesBuffer::BaseSizeX);
+		const float* baseSizeY = particles.GetChannel(ParticlesBuffer::BaseSizeY);
+		float* sizeX = particles.GetChannel(ParticlesBuffer::SizeX);
+		float* sizeY = particles.GetChannel(ParticlesBuffer::SizeY);
+
+		for (int i = begin; i < end; i++)
+		{
+			float coef = GetCurveSample(mSamples, GetLifeCoef(time[i], lifetime[i]));
+			sizeX[i] = baseSizeX[i]*coef;
+			sizeY[i] = baseSizeY[i]*coef;
+		}
+	}
+
+	void ParticlesGravityEffect::UpdateRange(float dt, ParticlesBuffer& particles, int begin, int end) const
+	{
+		float* velocityX = particles.GetChannel(ParticlesBuffer::VelocityX);
+		float* velocityY = particles.GetChannel(ParticlesBuffer::VelocityY);
+
+		float dvx = gravity.x*dt, dvy = gravity.y*dt;
+		for (int i = begin; i < end; i++)
+		{
+			velocityX[i] += dvx;
+			velocityY[i] += dvy;
+		}
+	}
+
+	void ParticlesForceFieldEffect::UpdateRange(float dt, ParticlesBuffer& particles, int begin, int end) const
+	{
+		const float* positionX = particles.GetChannel(ParticlesBuffer::PositionX);
+		const float* positionY = particles.GetChannel(ParticlesBuffer::PositionY);
+		float* velocityX = particles.GetChannel(ParticlesBuffer::VelocityX);
+		float* velocityY = particles.GetChannel(ParticlesBuffer::VelocityY);
+
+		if (radius < FLT_EPSILON)
+			return;
+
+		float invRadius = 1.0f/radius;
+		float strengthDt = strength*dt;
+
+		for (int i = begin; i < end; i++)
+		{
+			float dx = position.x - positionX[i], dy = position.y - positionY[i];
+			float distance = sqrtf(dx*dx + dy*dy);
+			if (distance >= radius || distance < FLT_EPSILON)
+				continue;
+
+			float coef = strengthDt*(1.0f - distance*invRadius)/distance;
+			velocityX[i] += dx*coef;
+			velocityY[i] += dy*coef;
+		}
+	}
+
+	void ParticlesDragEffect::UpdateRange(float dt, ParticlesBuffer& particles, int begin, int end) const
+	{
+		float* velocityX = particles.GetChannel(ParticlesBuffer::VelocityX);
+		float* velocityY = particles.GetChannel(ParticlesBuffer::VelocityY);
+
+		float coef = Math::Max(1.0f - drag*dt, 0.0f);
+		for (int i = begin; i < end; i++)
+		{
+			velocityX[i] *= coef;
+			velocityY[i] *= coef;
+		}
+	}
+
+	void ParticlesNoiseEffect::Update(float dt, ParticlesEmitter* emitter)
+	{
+		mTime += dt*scrollSpeed;
+	}
+
+	void ParticlesNoiseEffect::UpdateRange(float dt, ParticlesBuffer& particles, int begin, int end) const
+	{
+		const float* positionX = particles.GetChannel(ParticlesBuffer::PositionX);
+		const float* positionY = particles.GetChannel(ParticlesBuffer::PositionY);
+		float* velocityX = particles.GetChannel(ParticlesBuffer::VelocityX);
+		float* velocityY = particles.GetChannel(ParticlesBuffer::VelocityY);
+
+		float strengthDt = strength*dt;
+
+		// Second axis noise is sampled with offset to make it independent from first
+		for (int i = begin; i < end; i++)
+		{
+			float x = positionX[i]*frequency, y = positionY[i]*frequency;
+			velocityX[i] += GetNoise(x + mTime, y)*strengthDt;
+			velocityY[i] += GetNoise(x + 71.3f, y + mTime)*strengthDt;
+		}
+	}
+
+	float ParticlesNoiseEffect::GetNoise(float x, float y)
+	{
+		float fx = floorf(x), fy = floorf(y);
+		int ix = (int)fx, iy = (int)fy;
+		float tx = x - fx, ty = y - fy;
+
+		tx = tx*tx*(3.0f - 2.0f*tx);
+		ty = ty*ty*(3.0f - 2.0f*ty);
+
+		float bottom = Math::Lerp(GetHash(ix, iy), GetHash(ix + 1, iy), tx);
+		float top = Math::Lerp(GetHash(ix, iy + 1), GetHash(ix + 1, iy + 1), tx);
+
+		return Math::Lerp(bottom, top, ty);
+	}
+
+	float ParticlesNoiseEffect::GetHash(int x, int y)
+	{
+		UInt hash = (UInt)x*374761393u + (UInt)y*668265263u;
+		hash = (hash ^ (hash >> 13))*1274126177u;
+		hash = hash ^ (hash >> 16);
+
+		return (float)(hash & 0xffffff)/(float)0x7fffff - 1.0f;
+	}
 }
 
 CLASS_META(o2::ParticlesEffect)
@@ -19,6 +195,77 @@ CLASS_META(o2::ParticlesEffect)
 
 
 	PUBLIC_FUNCTION(void, Update, float, ParticlesEmitter*);
-	PUBLIC_FUNCTION(Vector<Particle>&, GetParticlesDirect, ParticlesEmitter*);
+	PUBLIC_FUNCTION(void, UpdateRange, float, ParticlesBuffer&, int, int);
+	PUBLIC_FUNCTION(ParticlesBuffer&, GetParticlesDirect, ParticlesEmitter*);
+}
+END_META;
+
+CLASS_META(o2::ParticlesColorEffect)
+{
+	BASE_CLASS(o2::ParticlesEffect);
+
+	PUBLIC_FIELD(colorA).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(colorB).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(curve).SERIALIZABLE_ATTRIBUTE();
+
+	PUBLIC_FUNCTION(void, Update, float, ParticlesEmitter*);
+	PUBLIC_FUNCTION(void, UpdateRange, float, ParticlesBuffer&, int, int);
+}
+END_META;
+
+CLASS_META(o2::ParticlesSizeEffect)
+{
+	BASE_CLASS(o2::ParticlesEffect);
+
+	PUBLIC_FIELD(curve).SERIALIZABLE_ATTRIBUTE();
+
+	PUBLIC_FUNCTION(void, Update, float, ParticlesEmitter*);
+	PUBLIC_FUNCTION(void, UpdateRange, float, ParticlesBuffer&, int, int);
+}
+END_META;
+
+CLASS_META(o2::ParticlesGravityEffect)
+{
+	BASE_CLASS(o2::ParticlesEffect);
+
+	PUBLIC_FIELD(gravity).SERIALIZABLE_ATTRIBUTE();
+
+	PUBLIC_FUNCTION(void, UpdateRange, float, ParticlesBuffer&, int, int);
+}
+END_META;
+
+CLASS_META(o2::ParticlesForceFieldEffect)
+{
+	BASE_CLASS(o2::ParticlesEffect);
+
+	PUBLIC_FIELD(position).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(radius).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(strength).SERIALIZABLE_ATTRIBUTE();
+
+	PUBLIC_FUNCTION(void, UpdateRange, float, ParticlesBuffer&, int, int);
+}
+END_META;
+
+CLASS_META(o2::ParticlesDragEffect)
+{
+	BASE_CLASS(o2::ParticlesEffect);
+
+	PUBLIC_FIELD(drag).SERIALIZABLE_ATTRIBUTE();
+
+	PUBLIC_FUNCTION(void, UpdateRange, float, ParticlesBuffer&, int, int);
+}
+END_META;
+
+CLASS_META(o2::ParticlesNoiseEffect)
+{
+	BASE_CLASS(o2::ParticlesEffect);
+
+	PUBLIC_FIELD(strength).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(frequency).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(scrollSpeed).SERIALIZABLE_ATTRIBUTE();
+	PROTECTED_FIELD(mTime);
+
+	PUBLIC_FUNCTION(void, Update, float, ParticlesEmitter*);
+	PUBLIC_FUNCTION(void, UpdateRange, float, ParticlesBuffer&, int, int);
 }
 END_META;
@@ -1,21 +1,166 @@
 #pragma once
 
 #include "Utils/Serializable.h"
-#include "Render/Particle.h"
+#include "Render/ParticlesBuffer.h"
+#include "Utils/Math/Curve.h"
 
 namespace o2
 {
 	class ParticlesEmitter;
 
-	// -------------------------------
-	// Particles effect base interface
-	// -------------------------------
+	// -----------------------------------------------------------------------------------------
+	// Particles effect base interface. Update is called once per frame on emitter's thread and
+	// prepares effect, UpdateRange processes contiguous range of particles. Ranges of large
+	// emitters are processed on workers, so UpdateRange must not change effect
+	// -----------------------------------------------------------------------------------------
 	class ParticlesEffect: public ISerializable
 	{
 		SERIALIZABLE(ParticlesEffect);
 
 	public:
+		// Prepares effect before particles ranges updating
 		virtual void Update(float dt, ParticlesEmitter* emitter);
-		Vector<Particle>& GetParticlesDirect(ParticlesEmitter* emitter);
+
+		// Updates particles in range [begin, end)
+		virtual void UpdateRange(float dt, ParticlesBuffer& particles, int begin, int end) const;
+
+		// Returns emitter's particles
+		ParticlesBuffer& GetParticlesDirect(ParticlesEmitter* emitter);
+
+	protected:
+		static const int mCurveSamplesCount = 64; // Count of curve samples by particles life
+
+	protected:
+		// Samples curve in 0...1 positions range
+		static void SampleCurve(const Curve& curve, float* samples);
+
+		// Returns interpolated curve sample by particles life coefficient in 0...1
+		static float GetCurveSample(const float* samples, float coef);
+	};
+
+	// -----------------------------------------------------------------
+	// Changes particles color from color A to color B by curve value,
+	// sampled by particles life coefficient
+	// -----------------------------------------------------------------
+	class ParticlesColorEffect: public ParticlesEffect
+	{
+		SERIALIZABLE(ParticlesColorEffect);
+
+	public:
+		Color4 colorA = Color4::White();          // Color at curve value 0 @SERIALIZABLE
+		Color4 colorB = Color4(255, 255, 255, 0); // Color at curve value 1 @SERIALIZABLE
+		Curve  curve = Curve::Linear();           // Color coefficient by life @SERIALIZABLE
+
+	public:
+		// Samples curve and colors
+		void Update(float dt, ParticlesEmitter* emitter);
+
+		// Updates particles colors in range
+		void UpdateRange(float dt, ParticlesBuffer& particles, int begin, int end) const;
+
+	protected:
+		float mSamples[mCurveSamplesCount]; // Sampled curve
+		float mColorA[4];                   // Color A channels in 0...1
+		float mColorB[4];                   // Color B channels in 0...1
+	};
+
+	// -------------------------------------------------------------------------
+	// Scales particles emitted size by curve value, sampled by life coefficient
+	// -------------------------------------------------------------------------
+	class ParticlesSizeEffect: public ParticlesEffect
+	{
+		SERIALIZABLE(ParticlesSizeEffect);
+
+	public:
+		Curve curve = Curve(Vector<Vec2F>({ Vec2F(0.0f, 1.0f), Vec2F(1.0f, 1.0f) })); // Size coefficient by life @SERIALIZABLE
+
+	public:
+		// Samples curve
+		void Update(float dt, ParticlesEmitter* emitter);
+
+		// Updates particles sizes in range
+		void UpdateRange(float dt, ParticlesBuffer& particles, int begin, int end) const;
+
+	protected:
+		float mSamples[mCurveSamplesCount]; // Sampled curve
+	};
+
+	// ----------------------------------------------------
+	// Accelerates particles with constant gravity vector
+	// ----------------------------------------------------
+	class ParticlesGravityEffect: public ParticlesEffect
+	{
+		SERIALIZABLE(ParticlesGravityEffect);
+
+	public:
+		Vec2F gravity = Vec2F(0, -100); // Acceleration in units/sec^2 @SERIALIZABLE
+
+	public:
+		// Updates particles velocities in range
+		void UpdateRange(float dt, ParticlesBuffer& particles, int begin, int end) const;
+	};
+
+	// -------------------------------------------------------------------------------------
+	// Attracts particles to point in world space, or repulses with negative strength.
+	// Force decreases linearly to zero at radius
+	// -------------------------------------------------------------------------------------
+	class ParticlesForceFieldEffect: public ParticlesEffect
+	{
+		SERIALIZABLE(ParticlesForceFieldEffect);
+
+	public:
+		Vec2F position;          // Field center in world space @SERIALIZABLE
+		float radius = 100.0f;   // Field radius @SERIALIZABLE
+		float strength = 100.0f; // Acceleration at center in units/sec^2 @SERIALIZABLE
+
+	public:
+		// Updates particles velocities in range
+		void UpdateRange(float dt, ParticlesBuffer& particles, int begin, int end) const;
+	};
+
+	// ----------------------------------------------------
+	// Slows down particles proportionally to their speed
+	// ----------------------------------------------------
+	class ParticlesDragEffect: public ParticlesEffect
+	{
+		SERIALIZABLE(ParticlesDragEffect);
+
+	public:
+		float drag = 1.0f; // Part of velocity lost per second @SERIALIZABLE
+
+	public:
+		// Updates particles velocities in range
+		void UpdateRange(float dt, ParticlesBuffer& particles, int begin, int end) const;
+	};
+
+	// -------------------------------------------------------------------------------------
+	// Changes particles velocities by smooth noise field, scrolling in time. Noise depends
+	// only on particle position and time, so result doesn't depend on particles order
+	// -------------------------------------------------------------------------------------
+	class ParticlesNoiseEffect: public ParticlesEffect
+	{
+		SERIALIZABLE(ParticlesNoiseEffect);
+
+	public:
+		float strength = 50.0f;   // Acceleration amplitude in units/sec^2 @SERIALIZABLE
+		float frequency = 0.01f;  // Noise field frequency by position @SERIALIZABLE
+		float scrollSpeed = 1.0f; // Noise field scroll speed @SERIALIZABLE
+
+	public:
+		// Updates noise time
+		void Update(float dt, ParticlesEmitter* emitter);
+
+		// Updates particles velocities in range
+		void UpdateRange(float dt, ParticlesBuffer& particles, int begin, int end) const;
+
+	protected:
+		float mTime = 0.0f; // Noise time
+
+	protected:
+		// Returns smooth value noise in -1...1 range
+		static float GetNoise(float x, float y);
+
+		// Returns hash value in -1...1 range for integer coordinates
+		static float GetHash(int x, int y);
 	};
 }
@@ -3,6 +3,7 @@
 #include "Render/Mesh.h"
 #include "Render/ParticlesEffects.h"
 #include "Render/ParticlesEmitterShapes.h"
+#include "Utils/TaskManager.h"
 
 namespace o2
 {
@@ -11,7 +12,9 @@ namespace o2
 	{
 		mShape = mnew CircleParticlesEmitterShape();
 		mParticlesMesh = mnew Mesh(NoTexture(), mParticlesNumLimit*4, mParticlesNumLimit*2);
+		ParticlesBuffer::FillQuadsIndexes(mParticlesMesh->indexes, mParticlesNumLimit);
 		mLastTransform = mTransform;
+		mRandom.SetSeed((UInt)Math::Random());
 
 		InitializeProperties();
 	}
@@ -36,11 +39,14 @@ namespace o2
 		mEmitParticlesColorA(other.mEmitParticlesColorA), mEmitParticlesColorB(other.mEmitParticlesColorB)
 	{
 		mParticlesMesh = mnew Mesh(NoTexture(), mParticlesNumLimit*4, mParticlesNumLimit*2);
+		ParticlesBuffer::FillQuadsIndexes(mParticlesMesh->indexes, mParticlesNumLimit);
+		SetImage(mImageAsset);
 
 		for (auto effect : other.mEffects)
 			AddEffect(effect->Clone());
 
 		mLastTransform = mTransform;
+		mRandom.SetSeed((UInt)Math::Random());
 
 		InitializeProperties();
 	}
@@ -50,25 +56,14 @@ namespace o2
 		RemoveAllEffects();
 		delete mShape;
 
-		int idx = 0;
-		for (auto& particle : mParticles)
-		{
-			if (particle.alive)
-			{
-				mDeadParticles.Add(idx);
-				particle.alive = false;
-			}
-
-			idx++;
-		}
-		mNumAliveParticles = 0;
+		mParticles.Clear();
 
 		IRectDrawable::operator=(other);
 
 		for (auto effect : other.mEffects)
 			AddEffect(effect->Clone());
 
-		mImageAsset = other.mImageAsset;
+		SetImage(other.mImageAsset);
 		mShape = other.mShape->Clone();
 
 		for (auto effect : other.mEffects)
@@ -101,9 +96,7 @@ namespace o2
 		mEmitParticlesColorA = other.mEmitParticlesColorA;
 		mEmitParticlesColorB = other.mEmitParticlesColorB;
 
-		mParticlesMesh->vertexCount = 0;
-		mParticlesMesh->polyCount = 0;
-		mParticlesMesh->Resize(mParticlesNumLimit*4, mParticlesNumLimit*2);
+		ResizeMesh();
 
 		mLastTransform = mTransform;
 
@@ -157,36 +150,29 @@ namespace o2
 		float halfAngleSpeedRange = mEmitParticlesAngleSpeedRange*0.5f;
 		while (mEmitTimeBuffer > particlesDelay)
 		{
-			if (mNumAliveParticles < mParticlesNumLimit)
+			if (mParticles.Count() < mParticlesNumLimit)
 			{
-				Particle* p;
-
-				if (mDeadParticles.IsEmpty())
-				{
-					mParticles.Add(Particle());
-					p = &mParticles.Last();
-				}
-				else p = &mParticles[mDeadParticles.PopBack()];
+				Particle p;
 
-				p->position = Local2WorldPoint(mShape->GetEmittinPoint());
-				p->angle = mEmitParticlesAngle + Math::Random(-halfAngleRange, halfAngleRange);
+				p.position = Local2WorldPoint(mShape->GetEmittinPoint(mRandom));
+				p.angle = mEmitParticlesAngle + mRandom.Range(-halfAngleRange, halfAngleRange);
 
-				p->size.Set(mEmitParticlesSize.x + Math::Random(-halfSizeRange.x, halfSizeRange.x),
-							mEmitParticlesSize.y + Math::Random(-halfSizeRange.y, halfSizeRange.y));
+				p.size.Set(mEmitParticlesSize.x + mRandom.Range(-halfSizeRange.x, halfSizeRange.x),
+							mEmitParticlesSize.y + mRandom.Range(-halfSizeRange.y, halfSizeRange.y));
 
-				p->velocity = Vec2F::Rotated(mEmitParticlesMoveDirection + Math::Random(-halfDirRange, halfDirRange))*
-					(mEmitParticlesSpeed + Math::Random(-halfSpeedRange, halfSpeedRange));
+				p.velocity = Vec2F::Rotated(mEmitParticlesMoveDirection + mRandom.Range(-halfDirRange, halfDirRange))*
+					(mEmitParticlesSpeed + mRandom.Range(-halfSpeedRange, halfSpeedRange));
 
-				p->angleSpeed = mEmitParticlesAngleSpeed + Math::Random(-halfAngleSpeedRange, halfAngleSpeedRange);
+				p.angleSpeed = mEmitParticlesAngleSpeed + mRandom.Range(-halfAngleSpeedRange, halfAngleSpeedRange);
 
-				p->color.r = Math::Random(mEmitParticlesColorA.r, mEmitParticlesColorB.r);
-				p->color.g = Math::Random(mEmitParticlesColorA.g, mEmitParticlesColorB.g);
-				p->color.b = Math::Random(mEmitParticlesColorA.b, mEmitParticlesColorB.b);
-				p->color.a = Math::Random(mEmitParticlesColorA.a, mEmitParticlesColorB.a);
-				p->time = mParticlesLifetime;
-				p->alive = true;
+				p.color.r = mRandom.Range(mEmitParticlesColorA.r, mEmitParticlesColorB.r);
+				p.color.g = mRandom.Range(mEmitParticlesColorA.g, mEmitParticlesColorB.g);
+				p.color.b = mRandom.Range(mEmitParticlesColorA.b, mEmitParticlesColorB.b);
+				p.color.a = mRandom.Range(mEmitParticlesColorA.a, mEmitParticlesColorB.a);
+				p.time = mParticlesLifetime;
+				p.lifetime = mParticlesLifetime;
 
-				mNumAliveParticles++;
+				mParticles.Add(p);
 			}
 
 			mEmitTimeBuffer -= particlesDelay;
@@ -197,43 +183,32 @@ namespace o2
 	{
 		for (auto effect : mEffects)
 			effect->Update(dt, this);
-	}
 
-	void ParticlesEmitter::UpdateParticles(float dt)
-	{
-		int idx = 0;
-		for (auto& particle : mParticles)
-		{
-			if (!particle.alive)
-			{
-				idx++;
-				continue;
-			}
+		int count = mParticles.Count();
+		if (mEffects.IsEmpty() || count == 0)
+			return;
 
-			particle.position += particle.velocity*dt;
-			particle.angle += particle.angleSpeed*dt;
-			particle.time -= dt;
+		// All effects are applied to range while it's data is in cache
+		auto updateRange = [&](int begin, int end)
+		{
+			for (auto effect : mEffects)
+				effect->UpdateRange(dt, mParticles, begin, end);
+		};
 
-			if (particle.time < 0)
-			{
-				particle.alive = false;
-				mDeadParticles.Add(idx);
-				mNumAliveParticles--;
-			}
+		if (count >= mParallelEffectsMinParticles && TaskManager::IsSingletonInitialzed())
+			o2Tasks.ParallelFor(count, mEffectsRangeSize, updateRange);
+		else
+			updateRange(0, count);
+	}
 
-			idx++;
-		}
+	void ParticlesEmitter::UpdateParticles(float dt)
+	{
+		mParticles.Integrate(dt);
+		mParticles.RemoveExpired();
 	}
 
 	void ParticlesEmitter::UpdateMesh()
 	{
-		if (mParticlesMesh->GetMaxVertexCount() < mParticlesNumLimit*4)
-			mParticlesMesh->Resize(mParticlesNumLimit*4, mParticlesNumLimit*2);
-
-		mParticlesMesh->vertexCount = 0;
-		mParticlesMesh->polyCount = 0;
-		int polyIndex = 0;
-
 		Vec2F invTexSize(1.0f, 1.0f);
 		if (mParticlesMesh->GetTexture())
 		{
@@ -241,41 +216,31 @@ namespace o2
 						   1.0f/mParticlesMesh->GetTexture()->GetSize().y);
 		}
 
-		RectF textureSrcRect;
-		if (mImageAsset)
-			textureSrcRect = mImageAsset->GetAtlasRect();
+		float uvLeft = mTextureSrcRect.left*invTexSize.x;
+		float uvRight = mTextureSrcRect.right*invTexSize.x;
+		float uvUp = 1.0f - mTextureSrcRect.bottom*invTexSize.y;
+		float uvDown = 1.0f - mTextureSrcRect.top*invTexSize.y;
 
-		float uvLeft = textureSrcRect.left*invTexSize.x;
-		float uvRight = textureSrcRect.right*invTexSize.x;
-		float uvUp = 1.0f - textureSrcRect.bottom*invTexSize.y;
-		float uvDown = 1.0f - textureSrcRect.top*invTexSize.y;
+		// Indexes are constant for quads, they are filled when mesh is resized
+		mParticlesMesh->vertexCount = mParticles.BuildQuads(mParticlesMesh->vertices, RectF(uvLeft, uvUp, uvRight, uvDown));
+		mParticlesMesh->polyCount = mParticles.Count()*2;
+	}
 
-		for (auto& particle : mParticles)
-		{
-			if (!particle.alive)
-				continue;
-
-			float sn = Math::Sin(particle.angle), cs = Math::Cos(particle.angle);
-			Vec2F hs = particle.size*0.5f;
-			Vec2F xv(cs*hs.x, sn*hs.x);
-			Vec2F yv(-sn*hs.y, cs*hs.y);
-			Vec2F o(particle.position);
-			ULong colr = particle.color.ARGB();
-
-			mParticlesMesh->vertices[mParticlesMesh->vertexCount++].Set(o - xv + yv, colr, uvLeft, uvUp);
-			mParticlesMesh->vertices[mParticlesMesh->vertexCount++].Set(o + xv + yv, colr, uvRight, uvUp);
-			mParticlesMesh->vertices[mParticlesMesh->vertexCount++].Set(o + xv - yv, colr, uvRight, uvDown);
-			mParticlesMesh->vertices[mParticlesMesh->vertexCount++].Set(o - xv - yv, colr, uvLeft, uvDown);
-
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 4;
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 3;
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 2;
-
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 4;
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 2;
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 1;
-			mParticlesMesh->polyCount += 2;
-		}
+	void ParticlesEmitter::ResizeMesh()
+	{
+		mParticlesMesh->Resize(mParticlesNumLimit*4, mParticlesNumLimit*2);
+		ParticlesBuffer::FillQuadsIndexes(mParticlesMesh->indexes, mParticlesNumLimit);
+
+		mParticlesMesh->vertexCount = 0;
+		mParticlesMesh->polyCount = 0;
+	}
+
+	void ParticlesEmitter::OnDeserialized(const DataNode& node)
+	{
+		SetImage(mImageAsset);
+
+		if (mParticlesMesh->GetMaxVertexCount() < (UInt)mParticlesNumLimit*4)
+			ResizeMesh();
 	}
 
 	void ParticlesEmitter::BasisChanged()
@@ -284,8 +249,7 @@ namespace o2
 			return;
 
 		Basis change = mLastTransform.Inverted()*mTransform;
-		for (auto& particle : mParticles)
-			particle.position = change.Transform(particle.position);
+		mParticles.Transform(change);
 
 		mLastTransform = mTransform;
 	}
@@ -325,9 +289,15 @@ namespace o2
 		mImageAsset = image;
 
 		if (mImageAsset)
+		{
 			mParticlesMesh->SetTexture(TextureRef(mImageAsset->GetAtlasId(), mImageAsset->GetAtlasPage()));
+			mTextureSrcRect = mImageAsset->GetAtlasRect();
+		}
 		else
+		{
 			mParticlesMesh->SetTexture(NoTexture());
+			mTextureSrcRect = RectF();
+		}
 	}
 
 	ImageAssetRef ParticlesEmitter::GetImage() const
@@ -376,18 +346,10 @@ namespace o2
 	{
 		mParticlesNumLimit = count;
 
-		int idx = 0;
-		while (mNumAliveParticles > mParticlesNumLimit)
-		{
-			if (mParticles[idx].alive)
-			{
-				mParticles[idx].alive = false;
-				mDeadParticles.Add(idx);
-				mNumAliveParticles--;
-			}
+		mParticles.Truncate(mParticlesNumLimit);
 
-			idx++;
-		}
+		if (mParticlesMesh->GetMaxVertexCount() < (UInt)mParticlesNumLimit*4)
+			ResizeMesh();
 	}
 
 	int ParticlesEmitter::GetMaxParticles() const
@@ -397,15 +359,15 @@ namespace o2
 
 	int ParticlesEmitter::GetParticlesCount() const
 	{
-		return mNumAliveParticles;
+		return mParticles.Count();
 	}
 
 	bool ParticlesEmitter::IsAliveParticles() const
 	{
-		return mNumAliveParticles > 0;
+		return !mParticles.IsEmpty();
 	}
 
-	const ParticlesEmitter::ParticlesVec& ParticlesEmitter::GetParticles() const
+	const ParticlesBuffer& ParticlesEmitter::GetParticles() const
 	{
 		return mParticles;
 	}
@@ -673,9 +635,7 @@ CLASS_META(o2::ParticlesEmitter)
 	PROTECTED_FIELD(mCurrentTime);
 	PROTECTED_FIELD(mEmitTimeBuffer);
 	PROTECTED_FIELD(mParticlesMesh);
-	PROTECTED_FIELD(mParticles);
-	PROTECTED_FIELD(mDeadParticles);
-	PROTECTED_FIELD(mNumAliveParticles);
+	PROTECTED_FIELD(mTextureSrcRect);
 	PROTECTED_FIELD(mLastTransform);
 
 	PUBLIC_FUNCTION(void, Draw);
@@ -698,7 +658,7 @@ CLASS_META(o2::ParticlesEmitter)
 	PUBLIC_FUNCTION(int, GetMaxParticles);
 	PUBLIC_FUNCTION(int, GetParticlesCount);
 	PUBLIC_FUNCTION(bool, IsAliveParticles);
-	PUBLIC_FUNCTION(const ParticlesVec&, GetParticles);
+	PUBLIC_FUNCTION(const ParticlesBuffer&, GetParticles);
 	PUBLIC_FUNCTION(void, SetParticlesRelativity, bool);
 	PUBLIC_FUNCTION(bool, IsParticlesRelative);
 	PUBLIC_FUNCTION(void, SetLoop, bool);
@@ -739,6 +699,8 @@ CLASS_META(o2::ParticlesEmitter)
 	PROTECTED_FUNCTION(void, UpdateEffects, float);
 	PROTECTED_FUNCTION(void, UpdateParticles, float);
 	PROTECTED_FUNCTION(void, UpdateMesh);
+	PROTECTED_FUNCTION(void, ResizeMesh);
+	PROTECTED_FUNCTION(void, OnDeserialized, const DataNode&);
 	PROTECTED_FUNCTION(void, BasisChanged);
 	PROTECTED_FUNCTION(void, InitializeProperties);
 }
@@ -1,7 +1,8 @@
 #pragma once
 
 #include "Assets/ImageAsset.h"
-#include "Render/Particle.h"
+#include "Render/ParticlesBuffer.h"
+#include "Render/ParticlesEmitterShapes.h"
 #include "Render/RectDrawable.h"
 #include "Utils/Math/Curve.h"
 
@@ -9,7 +10,6 @@ namespace o2
 {
 	class Mesh;
 	class ParticlesEffect;
-	class ParticlesEmitterShape;
 
 	// ------------------------------------------------------
 	// Particles emitter. Emits, updates and manage particles
@@ -19,7 +19,6 @@ namespace o2
 		SERIALIZABLE(ParticlesEmitter);
 
 	public:
-		typedef Vector<Particle> ParticlesVec;
 		typedef Vector<ParticlesEffect*> ParticleEffectsVec;
 
 	public:
@@ -124,7 +123,7 @@ namespace o2
 		bool IsAliveParticles() const;
 
 		// Returns particles list
-		const ParticlesVec& GetParticles() const;
+		const ParticlesBuffer& GetParticles() const;
 
 		// Sets particles relativity
 		void SetParticlesRelativity(bool relative);
@@ -272,11 +271,14 @@ namespace o2
 		float        mCurrentTime = 0;                         // Current working time in seconds
 		float        mEmitTimeBuffer = 0;                      // Emitting next particle time buffer
 		Mesh*        mParticlesMesh = nullptr;                 // Particles mesh
-		ParticlesVec mParticles;                               // Working particles
-		Vector<int>  mDeadParticles;                           // Dead particles indexes
-		int          mNumAliveParticles = 0;                   // Count of current alive particles
+		RectF        mTextureSrcRect;                          // Particle image atlas rect. Cached when image is set, update doesn't access asset
+		ParticlesRandom mRandom;                               // Own random generator, update doesn't use global rand() state
+		ParticlesBuffer mParticles;                            // Alive particles
 		Basis        mLastTransform;                           // Last transformation
 
+		static const int mParallelEffectsMinParticles = 4096;  // Minimal particles count for effects processing on workers
+		static const int mEffectsRangeSize = 1024;             // Count of particles in effects range, processed by worker
+
 	protected:
 		// Emits particles hen updating
 		void UpdateEmitting(float dt);
@@ -289,6 +291,12 @@ namespace o2
 
 		// Updates mesh geometry
 		void UpdateMesh(); 
+
+		// Resizes mesh by particles limit and fills quads indexes
+		void ResizeMesh();
+
+		// It is called when object was deserialized; updates image texture and mesh size
+		void OnDeserialized(const DataNode& node);
 		
 		// It is called when basis was changed, updates particles positions from last transform
 		void BasisChanged();
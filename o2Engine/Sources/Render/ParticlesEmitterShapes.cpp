@@ -2,20 +2,41 @@
 
 namespace o2
 {
-	Vec2F ParticlesEmitterShape::GetEmittinPoint()
+	ParticlesRandom::ParticlesRandom(UInt seed /*= 1*/)
+	{
+		SetSeed(seed);
+	}
+
+	void ParticlesRandom::SetSeed(UInt seed)
+	{
+		mState = seed != 0 ? seed : 1;
+	}
+
+	float ParticlesRandom::Range(float minValue, float maxValue)
+	{
+		mState ^= mState << 13;
+		mState ^= mState >> 17;
+		mState ^= mState << 5;
+
+		// Top 24 bits are converted to float without precision loss
+		float coef = (float)(mState >> 8)/(float)0xFFFFFF;
+		return minValue + (maxValue - minValue)*coef;
+	}
+
+	Vec2F ParticlesEmitterShape::GetEmittinPoint(ParticlesRandom& random)
 	{
 		return Vec2F();
 	}
 
-	Vec2F CircleParticlesEmitterShape::GetEmittinPoint()
+	Vec2F CircleParticlesEmitterShape::GetEmittinPoint(ParticlesRandom& random)
 	{
-		return Vec2F::Rotated(Math::Random(0.0f, Math::PI()*2.0f))*radius;
+		return Vec2F::Rotated(random.Range(0.0f, Math::PI()*2.0f))*radius;
 	}
 
-	Vec2F SquareParticlesEmitterShape::GetEmittinPoint()
+	Vec2F SquareParticlesEmitterShape::GetEmittinPoint(ParticlesRandom& random)
 	{
 		Vec2F hs = size*0.5f;
-		return Vec2F(Math::Random(-hs.x, hs.x), Math::Random(-hs.y, hs.y));
+		return Vec2F(random.Range(-hs.x, hs.x), random.Range(-hs.y, hs.y));
 	}
 }
 
@@ -24,7 +45,7 @@ CLASS_META(o2::ParticlesEmitterShape)
 	BASE_CLASS(o2::ISerializable);
 
 
-	PUBLIC_FUNCTION(Vec2F, GetEmittinPoint);
+	PUBLIC_FUNCTION(Vec2F, GetEmittinPoint, ParticlesRandom&);
 }
 END_META;
 
@@ -34,7 +55,7 @@ CLASS_META(o2::CircleParticlesEmitterShape)
 
 	PUBLIC_FIELD(radius);
 
-	PUBLIC_FUNCTION(Vec2F, GetEmittinPoint);
+	PUBLIC_FUNCTION(Vec2F, GetEmittinPoint, ParticlesRandom&);
 }
 END_META;
 
@@ -44,6 +65,6 @@ CLASS_META(o2::SquareParticlesEmitterShape)
 
 	PUBLIC_FIELD(size);
 
-	PUBLIC_FUNCTION(Vec2F, GetEmittinPoint);
+	PUBLIC_FUNCTION(Vec2F, GetEmittinPoint, ParticlesRandom&);
 }
 END_META;
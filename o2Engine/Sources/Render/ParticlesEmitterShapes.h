@@ -4,6 +4,26 @@
 
 namespace o2
 {
+	// ------------------------------------------------------------------------
+	// Particles random numbers generator (xorshift). Each emitter has it's own
+	// generator, so emitters doesn't share global rand() state between threads
+	// ------------------------------------------------------------------------
+	class ParticlesRandom
+	{
+	public:
+		// Constructor with seed
+		ParticlesRandom(UInt seed = 1);
+
+		// Sets seed. Zero seed is replaced with one, xorshift doesn't work with zero state
+		void SetSeed(UInt seed);
+
+		// Returns random value in range from minValue to maxValue
+		float Range(float minValue, float maxValue);
+
+	protected:
+		UInt mState; // Generator state
+	};
+
 	// --------------------------------------
 	// Particles emitter shape base interface
 	// --------------------------------------
@@ -13,7 +33,7 @@ namespace o2
 
 	public:
 		virtual ~ParticlesEmitterShape() {}
-		virtual Vec2F GetEmittinPoint();
+		virtual Vec2F GetEmittinPoint(ParticlesRandom& random);
 	};
 
 	// ---------------------------------
@@ -26,7 +46,7 @@ namespace o2
 	public:
 		float radius = 0;
 
-		Vec2F GetEmittinPoint();
+		Vec2F GetEmittinPoint(ParticlesRandom& random);
 	};
 
 	// ---------------------------------
@@ -39,6 +59,6 @@ namespace o2
 	public:
 		Vec2F size;
 
-		Vec2F GetEmittinPoint();
+		Vec2F GetEmittinPoint(ParticlesRandom& random);
 	};
 }
@@ -68,6 +68,11 @@ namespace o2
 		return mDrawingScissorRect.IsInside(point) && Transform::IsPointInside(point);
 	}
 
+	RectF IRectDrawable::GetUnderPointBounds() const
+	{
+		return GetAxisAlignedRect();
+	}
+
 	void IRectDrawable::InitializeProperties()
 	{
 		INITIALIZE_PROPERTY(IRectDrawable, color, SetColor, GetColor);
@@ -95,6 +100,7 @@ CLASS_META(o2::IRectDrawable)
 	PUBLIC_FUNCTION(void, SetEnabled, bool);
 	PUBLIC_FUNCTION(bool, IsEnabled);
 	PUBLIC_FUNCTION(bool, IsUnderPoint, const Vec2F&);
+	PUBLIC_FUNCTION(RectF, GetUnderPointBounds);
 	PROTECTED_FUNCTION(void, ColorChanged);
 	PROTECTED_FUNCTION(void, EnableChanged);
 	PROTECTED_FUNCTION(void, InitializeProperties);
@@ -55,6 +55,9 @@ namespace o2
 		// Returns true if point is under drawable
 		bool IsUnderPoint(const Vec2F& point);
 
+		// Returns axis aligned rectangle of drawable
+		RectF GetUnderPointBounds() const;
+
 		SERIALIZABLE(IRectDrawable);
 
 	protected:
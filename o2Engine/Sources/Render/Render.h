@@ -4,6 +4,7 @@
 #include FT_FREETYPE_H
 
 #include "Render/Camera.h"
+#include "Render/RenderCommandList.h"
 #include "Render/TextureRef.h"
 #include "Render/Windows/RenderBase.h"
 #include "Utils/Math/Vertex2.h"
@@ -200,6 +201,16 @@ namespace o2
 		// Returns scissor infos at current frame
 		const ScissorInfosVec& GetScissorInfos() const;
 
+		// Enables or disables draw commands recording. Recorded commands are merged into batches by state
+		// and submitted on flush: camera, stencil or render target change, clearing and frame end
+		void SetCommandsRecording(bool enabled);
+
+		// Returns true, if draw commands are recorded
+		bool IsCommandsRecording() const;
+
+		// Returns recorded draw commands list
+		const RenderCommandList& GetCommandList() const;
+
 	protected:
 		typedef Vector<Texture*> TexturesVec;
 		typedef Vector<Font*> FontsVec;
@@ -228,6 +239,9 @@ namespace o2
 		TextureRef        mCurrentRenderTarget;    // Current render target. NULL if rendering in back buffer
 						  
 		float             mDrawingDepth;           // Current drawing depth, increments after each drawing drawables
+
+		RenderCommandList mCommandList;            // Recorded draw commands
+		bool              mCommandsRecording;      // True, if draw commands are recorded instead of immediate drawing
 						  
 		FT_Library        mFreeTypeLib;            // FreeType library, for rendering fonts
 
@@ -254,6 +268,40 @@ namespace o2
 		// Send buffers to draw
 		void DrawPrimitives();
 
+		// Submits recorded draw commands by batches and sends buffers to draw
+		void FlushCommands();
+
+		// Puts mesh data into buffers, sends buffers to draw when texture changes or buffers are full
+		void DrawMeshData(Texture* texture, const Vertex2* vertices, UInt vertexCount, const UInt16* indexes,
+						  UInt indexCount);
+
+		// Puts lines data into buffers, sends buffers to draw when primitive type changes or buffers are full
+		void DrawLinesData(const Vertex2* vertices, UInt count);
+
+		// Returns recording state for drawing with texture and primitive type at current scissor
+		RenderCommandList::State GetCommandState(Texture* texture, RenderCommandList::PrimitiveType primitiveType) const;
+
+		// Applies scissor test from top of scissors stack to OpenGL state
+		void UpdateScissorTest();
+
+		// Sets OpenGL scissor test state
+		void SetScissorTest(bool enabled, const RectI& rect);
+
+		// Creates streaming vertex and index buffer objects. Falls back to client side arrays when not supported
+		void InitializeStreamingBuffers();
+
+		// Deletes streaming buffer objects
+		void DeinitializeStreamingBuffers();
+
+		// Uses client side vertex and index arrays instead of streaming buffers
+		void InitializeClientBuffers();
+
+		// Maps next ring ranges of streaming buffers for current batch. Orphans buffers when ring is over
+		void MapStreamingBuffers();
+
+		// Flushes written part of current batch, unmaps streaming buffers and moves ring offsets
+		void UnmapStreamingBuffers();
+
 		// Sets orthographic view matrix by view size
 		void SetupViewMatrix(const Vec2I& viewSize);
 
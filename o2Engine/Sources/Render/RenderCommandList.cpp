@@ -0,0 +1,205 @@
+#include "RenderCommandList.h"
+
+#include <algorithm>
+
+namespace o2
+{
+	RenderCommandList::RenderCommandList():
+		mBatchesLookback(32)
+	{}
+
+	void RenderCommandList::AddMesh(const State& state, float depth, const Vertex2* vertices, UInt vertexCount,
+									const UInt16* indexes, UInt indexCount)
+	{
+		Command& command = AddCommand(state, depth, vertices, vertexCount);
+
+		command.indexBegin = mIndexes.Count();
+		command.indexCount = indexCount;
+
+		mIndexes.Resize(mIndexes.Count() + indexCount);
+		memcpy(mIndexes.Data() + command.indexBegin, indexes, sizeof(UInt16)*indexCount);
+	}
+
+	void RenderCommandList::AddLines(const State& state, float depth, const Vertex2* vertices, UInt linesCount)
+	{
+		Command& command = AddCommand(state, depth, vertices, linesCount*2);
+
+		// Lines are rasterized wider than their geometry
+		command.bounds.left -= 1.0f; command.bounds.right += 1.0f;
+		command.bounds.bottom -= 1.0f; command.bounds.top += 1.0f;
+
+		command.indexBegin = mIndexes.Count();
+		command.indexCount = linesCount*2;
+
+		mIndexes.Resize(mIndexes.Count() + command.indexCount);
+		UInt16* indexes = mIndexes.Data() + command.indexBegin;
+		for (UInt i = 0; i < command.indexCount; i++)
+			indexes[i] = i;
+	}
+
+	void RenderCommandList::Clear()
+	{
+		mCommands.Clear();
+		mBatches.Clear();
+		mCommandsOrder.Clear();
+		mVertices.Clear();
+		mIndexes.Clear();
+	}
+
+	void RenderCommandList::BuildBatches(UInt maxVertexCount, UInt maxIndexCount)
+	{
+		mBatches.Clear();
+
+		// Commands are usually recorded by increasing depth, stable sort keeps recording order for equal depths
+		mCommandsOrder.Clear();
+		for (int i = 0; i < mCommands.Count(); i++)
+			mCommandsOrder.Add(i);
+
+		int* order = mCommandsOrder.Data();
+		std::stable_sort(order, order + mCommandsOrder.Count(),
+						 [&](int a, int b) { return mCommands[a].depth < mCommands[b].depth; });
+
+		for (int orderIdx = 0; orderIdx < mCommandsOrder.Count(); orderIdx++)
+		{
+			int i = mCommandsOrder[orderIdx];
+			Command& command = mCommands[i];
+			command.nextInBatch = -1;
+
+			// Looking for batch with same state, command can't be moved over overlapping batches
+			int targetBatch = -1;
+			int lookbackEnd = Math::Max(0, mBatches.Count() - mBatchesLookback);
+			for (int j = mBatches.Count() - 1; j >= lookbackEnd; j--)
+			{
+				Batch& batch = mBatches[j];
+
+				if (batch.state == command.state &&
+					batch.vertexCount + command.vertexCount <= maxVertexCount &&
+					batch.indexCount + command.indexCount <= maxIndexCount)
+				{
+					targetBatch = j;
+					break;
+				}
+
+				if (IsOverlaps(batch.bounds, command.bounds))
+					break;
+			}
+
+			if (targetBatch < 0)
+			{
+				Batch batch;
+				batch.state = command.state;
+				batch.bounds = command.bounds;
+				batch.firstCommand = i;
+				batch.lastCommand = i;
+				batch.vertexCount = command.vertexCount;
+				batch.indexCount = command.indexCount;
+
+				mBatches.Add(batch);
+				continue;
+			}
+
+			Batch& batch = mBatches[targetBatch];
+			mCommands[batch.lastCommand].nextInBatch = i;
+			batch.lastCommand = i;
+			batch.bounds = batch.bounds.Expand(command.bounds);
+			batch.vertexCount += command.vertexCount;
+			batch.indexCount += command.indexCount;
+		}
+	}
+
+	const RenderCommandList::CommandsVec& RenderCommandList::GetCommands() const
+	{
+		return mCommands;
+	}
+
+	const RenderCommandList::BatchesVec& RenderCommandList::GetBatches() const
+	{
+		return mBatches;
+	}
+
+	const Vertex2* RenderCommandList::GetVertices() const
+	{
+		return mVertices.Data();
+	}
+
+	const UInt16* RenderCommandList::GetIndexes() const
+	{
+		return mIndexes.Data();
+	}
+
+	int RenderCommandList::GetCommandsCount() const
+	{
+		return mCommands.Count();
+	}
+
+	int RenderCommandList::GetBatchesCount() const
+	{
+		return mBatches.Count();
+	}
+
+	void RenderCommandList::SetBatchesLookback(int count)
+	{
+		mBatchesLookback = Math::Max(count, 1);
+	}
+
+	int RenderCommandList::GetBatchesLookback() const
+	{
+		return mBatchesLookback;
+	}
+
+	RenderCommandList::Command& RenderCommandList::AddCommand(const State& state, float depth, const Vertex2* vertices,
+															  UInt vertexCount)
+	{
+		Command command;
+		command.state = state;
+		command.depth = depth;
+		command.vertexBegin = mVertices.Count();
+		command.vertexCount = vertexCount;
+		command.indexBegin = 0;
+		command.indexCount = 0;
+		command.nextInBatch = -1;
+
+		if (vertexCount > 0)
+		{
+			command.bounds = RectF(vertices[0].x, vertices[0].y, vertices[0].x, vertices[0].y);
+			for (UInt i = 1; i < vertexCount; i++)
+			{
+				const Vertex2& v = vertices[i];
+				command.bounds.left = Math::Min(command.bounds.left, v.x);
+				command.bounds.right = Math::Max(command.bounds.right, v.x);
+				command.bounds.bottom = Math::Min(command.bounds.bottom, v.y);
+				command.bounds.top = Math::Max(command.bounds.top, v.y);
+			}
+		}
+
+		mVertices.Resize(mVertices.Count() + vertexCount);
+		memcpy(mVertices.Data() + command.vertexBegin, vertices, sizeof(Vertex2)*vertexCount);
+
+		return mCommands.Add(command);
+	}
+
+	bool RenderCommandList::IsOverlaps(const RectF& a, const RectF& b)
+	{
+		return a.left < b.right && a.right > b.left && a.bottom < b.top && a.top > b.bottom;
+	}
+
+	RenderCommandList::State::State():
+		texture(nullptr), primitiveType(PrimitiveType::Triangles), scissorTest(false)
+	{}
+
+	RenderCommandList::State::State(Texture* texture, PrimitiveType primitiveType, bool scissorTest,
+									const RectI& scissorRect):
+		texture(texture), primitiveType(primitiveType), scissorTest(scissorTest), scissorRect(scissorRect)
+	{}
+
+	bool RenderCommandList::State::operator==(const State& other) const
+	{
+		return texture == other.texture && primitiveType == other.primitiveType && scissorTest == other.scissorTest &&
+			(!scissorTest || scissorRect == other.scissorRect);
+	}
+
+	bool RenderCommandList::State::operator!=(const State& other) const
+	{
+		return !(*this == other);
+	}
+}
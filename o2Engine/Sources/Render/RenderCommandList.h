@@ -0,0 +1,130 @@
+#pragma once
+
+#include "Utils/CommonTypes.h"
+#include "Utils/Containers/Vector.h"
+#include "Utils/Math/Rect.h"
+#include "Utils/Math/Vertex2.h"
+
+namespace o2
+{
+	class Texture;
+
+	// -----------------------------------------------------------------------------------------
+	// Recorded draw commands list. Collects meshes and lines with render state and depth,
+	// then groups them into batches in depth order: command can be moved back to earlier batch
+	// with same state, when it doesn't overlap any batch between them, so overlapping geometry
+	// is drawn by increasing depth. Doesn't use any graphics API and can be used without render device
+	// -----------------------------------------------------------------------------------------
+	class RenderCommandList
+	{
+	public:
+		enum class PrimitiveType { Triangles, Lines };
+
+		// ---------------------------------------------
+		// Render state of command. Batched commands
+		// must have equal states
+		// ---------------------------------------------
+		struct State
+		{
+			Texture*      texture;        // Drawing texture, NULL when drawing without texture
+			PrimitiveType primitiveType;  // Type of drawing primitives
+			bool          scissorTest;    // Is scissor test enabled
+			RectI         scissorRect;    // Scissor rectangle, used when scissor test enabled
+
+			State();
+			State(Texture* texture, PrimitiveType primitiveType, bool scissorTest, const RectI& scissorRect);
+
+			bool operator==(const State& other) const;
+			bool operator!=(const State& other) const;
+		};
+
+		// ----------------------------------------------
+		// Recorded drawing command. Vertices and indexes
+		// are stored in list's buffers
+		// ----------------------------------------------
+		struct Command
+		{
+			State state;        // Render state
+			float depth;        // Drawing depth at recording. Overlapping commands are drawn by increasing depth
+			RectF bounds;       // Geometry bounds
+			UInt  vertexBegin;  // First vertex in list vertices buffer
+			UInt  vertexCount;  // Count of vertices
+			UInt  indexBegin;   // First index in list indexes buffer
+			UInt  indexCount;   // Count of indexes. Indexes are relative to first vertex
+			int   nextInBatch;  // Next command index in same batch, -1 when last
+		};
+
+		// -------------------------------------------
+		// Batch of commands drawing with single call
+		// -------------------------------------------
+		struct Batch
+		{
+			State state;        // Render state of all commands
+			RectF bounds;       // Summary bounds of commands
+			int   firstCommand; // First command index
+			int   lastCommand;  // Last command index
+			UInt  vertexCount;  // Summary vertices count
+			UInt  indexCount;   // Summary indexes count
+		};
+
+		typedef Vector<Command> CommandsVec;
+		typedef Vector<Batch> BatchesVec;
+
+	public:
+		// Default constructor
+		RenderCommandList();
+
+		// Records mesh drawing. Indexes are relative to first vertex
+		void AddMesh(const State& state, float depth, const Vertex2* vertices, UInt vertexCount,
+					 const UInt16* indexes, UInt indexCount);
+
+		// Records lines drawing, each pair of vertices is line
+		void AddLines(const State& state, float depth, const Vertex2* vertices, UInt linesCount);
+
+		// Removes all recorded commands and batches
+		void Clear();
+
+		// Groups recorded commands into batches by increasing depth, commands with equal depth keep recording order.
+		// Batch can't contain more than maxVertexCount vertices and maxIndexCount indexes
+		void BuildBatches(UInt maxVertexCount, UInt maxIndexCount);
+
+		// Returns recorded commands
+		const CommandsVec& GetCommands() const;
+
+		// Returns batches, built by last BuildBatches call
+		const BatchesVec& GetBatches() const;
+
+		// Returns recorded vertices buffer
+		const Vertex2* GetVertices() const;
+
+		// Returns recorded indexes buffer
+		const UInt16* GetIndexes() const;
+
+		// Returns count of recorded commands
+		int GetCommandsCount() const;
+
+		// Returns count of batches, built by last BuildBatches call
+		int GetBatchesCount() const;
+
+		// Sets count of last batches, that are checked for merging command
+		void SetBatchesLookback(int count);
+
+		// Returns count of last batches, that are checked for merging command
+		int GetBatchesLookback() const;
+
+	protected:
+		CommandsVec     mCommands;         // Recorded commands
+		BatchesVec      mBatches;          // Built batches
+		Vector<Vertex2> mVertices;         // Recorded vertices
+		Vector<UInt16>  mIndexes;          // Recorded indexes
+		Vector<int>     mCommandsOrder;    // Commands indexes sorted by depth, used in batches building
+		int             mBatchesLookback;  // Count of last batches, that are checked for merging command
+
+	protected:
+		// Adds command and calculates it's bounds by vertices
+		Command& AddCommand(const State& state, float depth, const Vertex2* vertices, UInt vertexCount);
+
+		// Returns true when rectangles have common area
+		static bool IsOverlaps(const RectF& a, const RectF& b);
+	};
+}
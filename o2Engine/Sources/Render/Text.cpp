@@ -10,7 +10,7 @@ namespace o2
 	Text::Text():
 		mFont(nullptr), mSymbolsDistCoef(1), mLinesDistanceCoef(1), mVerAlign(VerAlign::Top),
 		mHorAlign(HorAlign::Left), mWordWrap(false), IRectDrawable(), mUpdatingMesh(false), mFontAssetId(0),
-		mDotsEndings(false), mHeight(11)
+		mDotsEndings(false), mHeight(11), mSymbolsSetDirty(true)
 	{
 		InitializeProperties();
 	}
@@ -18,18 +18,18 @@ namespace o2
 	Text::Text(FontRef font):
 		mFont(font), mSymbolsDistCoef(1), mLinesDistanceCoef(1), mVerAlign(VerAlign::Top),
 		mHorAlign(HorAlign::Left), mWordWrap(false), IRectDrawable(), mUpdatingMesh(false),
-		mFontAssetId(0), mDotsEndings(false), mHeight(11)
+		mFontAssetId(0), mDotsEndings(false), mHeight(11), mSymbolsSetDirty(true)
 	{
 		InitializeProperties();
 
 		if (mFont)
-			mFont->onCharactersRebuild += ObjFunctionPtr<Text, void>(this, &Text::UpdateMesh);
+			mFont->onCharactersRebuild += ObjFunctionPtr<Text, void>(this, &Text::OnFontCharactersRebuild);
 
 		mFont->CheckCharacters(mBasicSymbolsPreset, mHeight);
 	}
 
 	Text::Text(const Text& text):
-		IRectDrawable(text), mUpdatingMesh(false)
+		IRectDrawable(text), mUpdatingMesh(false), mSymbolsSetDirty(true)
 	{
 		InitializeProperties();
 
@@ -45,7 +45,7 @@ namespace o2
 		mHeight = text.mHeight;
 
 		if (mFont)
-			mFont->onCharactersRebuild += ObjFunctionPtr<Text, void>(this, &Text::UpdateMesh);
+			mFont->onCharactersRebuild += ObjFunctionPtr<Text, void>(this, &Text::OnFontCharactersRebuild);
 
 		mFont->CheckCharacters(mBasicSymbolsPreset, mHeight);
 	}
@@ -69,7 +69,7 @@ namespace o2
 	Text::Text(UID fontAssetId):
 		mSymbolsDistCoef(1), mLinesDistanceCoef(1), mVerAlign(VerAlign::Top),
 		mHorAlign(HorAlign::Left), mWordWrap(false), IRectDrawable(), mDotsEndings(false), mHeight(11),
-		mUpdatingMesh(false)
+		mUpdatingMesh(false), mSymbolsSetDirty(true)
 	{
 		InitializeProperties();
 		SetFontAsset(fontAssetId);
@@ -81,7 +81,7 @@ namespace o2
 			delete mesh;
 
 		if (mFont)
-			mFont->onCharactersRebuild -= ObjFunctionPtr<Text, void>(this, &Text::UpdateMesh);
+			mFont->onCharactersRebuild -= ObjFunctionPtr<Text, void>(this, &Text::OnFontCharactersRebuild);
 	}
 
 	Text& Text::operator=(const Text& other)
@@ -89,7 +89,7 @@ namespace o2
 		IRectDrawable::operator=(other);
 
 		if (mFont)
-			mFont->onCharactersRebuild -= ObjFunctionPtr<Text, void>(this, &Text::UpdateMesh);
+			mFont->onCharactersRebuild -= ObjFunctionPtr<Text, void>(this, &Text::OnFontCharactersRebuild);
 
 		mText = other.mText;
 		mFontAssetId = other.mFontAssetId;
@@ -101,9 +101,10 @@ namespace o2
 		mWordWrap = other.mWordWrap;
 		mDotsEndings = other.mDotsEndings;
 		mHeight = other.mHeight;
+		mSymbolsSetDirty = true;
 
 		if (mFont)
-			mFont->onCharactersRebuild += ObjFunctionPtr<Text, void>(this, &Text::UpdateMesh);
+			mFont->onCharactersRebuild += ObjFunctionPtr<Text, void>(this, &Text::OnFontCharactersRebuild);
 
 		mFont->CheckCharacters(mBasicSymbolsPreset, mHeight);
 
@@ -129,12 +130,12 @@ namespace o2
 	void Text::SetFont(FontRef font)
 	{
 		if (mFont)
-			mFont->onCharactersRebuild -= ObjFunctionPtr<Text, void>(this, &Text::UpdateMesh);
+			mFont->onCharactersRebuild -= ObjFunctionPtr<Text, void>(this, &Text::OnFontCharactersRebuild);
 
 		mFont = font;
 
 		if (mFont)
-			mFont->onCharactersRebuild += ObjFunctionPtr<Text, void>(this, &Text::UpdateMesh);
+			mFont->onCharactersRebuild += ObjFunctionPtr<Text, void>(this, &Text::OnFontCharactersRebuild);
 
 		mFont->CheckCharacters(mBasicSymbolsPreset, mHeight);
 
@@ -149,13 +150,13 @@ namespace o2
 	void Text::SetFontAsset(const BitmapFontAssetRef& asset)
 	{
 		if (mFont)
-			mFont->onCharactersRebuild -= ObjFunctionPtr<Text, void>(this, &Text::UpdateMesh);
+			mFont->onCharactersRebuild -= ObjFunctionPtr<Text, void>(this, &Text::OnFontCharactersRebuild);
 
 		mFont = asset->GetFont();
 		mFontAssetId = asset->GetAssetId();
 
 		if (mFont)
-			mFont->onCharactersRebuild += ObjFunctionPtr<Text, void>(this, &Text::UpdateMesh);
+			mFont->onCharactersRebuild += ObjFunctionPtr<Text, void>(this, &Text::OnFontCharactersRebuild);
 
 		mFont->CheckCharacters(mBasicSymbolsPreset, mHeight);
 	}
@@ -163,13 +164,13 @@ namespace o2
 	void Text::SetFontAsset(const VectorFontAssetRef& asset)
 	{
 		if (mFont)
-			mFont->onCharactersRebuild -= ObjFunctionPtr<Text, void>(this, &Text::UpdateMesh);
+			mFont->onCharactersRebuild -= ObjFunctionPtr<Text, void>(this, &Text::OnFontCharactersRebuild);
 
 		mFont = asset->GetFont();
 		mFontAssetId = asset->GetAssetId();
 
 		if (mFont)
-			mFont->onCharactersRebuild += ObjFunctionPtr<Text, void>(this, &Text::UpdateMesh);
+			mFont->onCharactersRebuild += ObjFunctionPtr<Text, void>(this, &Text::OnFontCharactersRebuild);
 
 		mFont->CheckCharacters(mBasicSymbolsPreset, mHeight);
 	}
@@ -183,7 +184,7 @@ namespace o2
 		}
 
 		if (mFont)
-			mFont->onCharactersRebuild -= ObjFunctionPtr<Text, void>(this, &Text::UpdateMesh);
+			mFont->onCharactersRebuild -= ObjFunctionPtr<Text, void>(this, &Text::OnFontCharactersRebuild);
 
 		mFontAssetId = assetId;
 		AssetInfo fontAssetInfo = o2Assets.GetAssetInfo(mFontAssetId);
@@ -199,7 +200,7 @@ namespace o2
 		}
 
 		if (mFont)
-			mFont->onCharactersRebuild += ObjFunctionPtr<Text, void>(this, &Text::UpdateMesh);
+			mFont->onCharactersRebuild += ObjFunctionPtr<Text, void>(this, &Text::OnFontCharactersRebuild);
 
 		mFont->CheckCharacters(mBasicSymbolsPreset, mHeight);
 
@@ -215,7 +216,7 @@ namespace o2
 		}
 
 		if (mFont)
-			mFont->onCharactersRebuild -= ObjFunctionPtr<Text, void>(this, &Text::UpdateMesh);
+			mFont->onCharactersRebuild -= ObjFunctionPtr<Text, void>(this, &Text::OnFontCharactersRebuild);
 		
 		AssetInfo fontAssetInfo = o2Assets.GetAssetInfo(fileName);
 		mFontAssetId = fontAssetInfo.id;
@@ -232,7 +233,7 @@ namespace o2
 		}
 
 		if (mFont)
-			mFont->onCharactersRebuild += ObjFunctionPtr<Text, void>(this, &Text::UpdateMesh);
+			mFont->onCharactersRebuild += ObjFunctionPtr<Text, void>(this, &Text::OnFontCharactersRebuild);
 
 		mFont->CheckCharacters(mBasicSymbolsPreset, mHeight);
 	}
@@ -424,49 +425,77 @@ namespace o2
 		int currentMeshIdx = 0;
 		Mesh* currentMesh = mMeshes[0];
 
-		mSymbolsSet.Initialize(mFont, mText, mHeight, mTransform.offs, mSize, mHorAlign, mVerAlign, mWordWrap, mDotsEndings,
-							   mSymbolsDistCoef, mLinesDistanceCoef);
+		if (IsSymbolsSetActual())
+		{
+			Vec2F position(Math::Round(mTransform.offs.x), Math::Round(mTransform.offs.y));
+			if (position != mSymbolsSet.mPosition)
+			{
+				mSymbolsSet.Move(position - mSymbolsSet.mPosition);
+				mSymbolsSet.mPosition = position;
+			}
+		}
+		else
+		{
+			mSymbolsSet.Initialize(mFont, mText, mHeight, mTransform.offs, mSize, mHorAlign, mVerAlign, mWordWrap, mDotsEndings,
+								   mSymbolsDistCoef, mLinesDistanceCoef);
+
+			mSymbolsSetDirty = false;
+		}
 
 		Basis transf = CalculateTextBasis();
-		mLastTransform = transf;
 
-		for (auto& line : mSymbolsSet.mLines)
+		// Symbols are grouped by font texture pages, each mesh contains symbols from one page
+		unsigned long color = mColor.ABGR();
+		int restPolyCount = textLen*2 + 5;
+		for (int page = 0; page < mFont->mTextures.Count(); page++)
 		{
-			for (auto& symb : line.mSymbols)
+			bool pageStarted = false;
+			for (auto& line : mSymbolsSet.mLines)
 			{
-				if (currentMesh->polyCount + 2 >= currentMesh->GetMaxPolyCount())
-					currentMesh = mMeshes[currentMeshIdx++];
-
-				unsigned long color = mColor.ABGR();
-				Vec2F points[4] =
+				for (auto& symb : line.mSymbols)
 				{
-					transf.Transform(symb.mFrame.LeftTop() - mSymbolsSet.mPosition),
-					transf.Transform(symb.mFrame.RightTop() - mSymbolsSet.mPosition),
-					transf.Transform(symb.mFrame.RightBottom() - mSymbolsSet.mPosition),
-					transf.Transform(symb.mFrame.LeftBottom() - mSymbolsSet.mPosition)
-				};
-				
-				currentMesh->vertices[currentMesh->vertexCount++] = Vertex2(points[0], color, symb.mTexSrc.left, 1.0f - symb.mTexSrc.top);
-				currentMesh->vertices[currentMesh->vertexCount++] = Vertex2(points[1], color, symb.mTexSrc.right, 1.0f - symb.mTexSrc.top);
-				currentMesh->vertices[currentMesh->vertexCount++] = Vertex2(points[2], color, symb.mTexSrc.right, 1.0f - symb.mTexSrc.bottom);
-				currentMesh->vertices[currentMesh->vertexCount++] = Vertex2(points[3], color, symb.mTexSrc.left, 1.0f - symb.mTexSrc.bottom);
-
-				int pp = currentMesh->polyCount*3;
-				currentMesh->indexes[pp] = currentMesh->vertexCount - 4;
-				currentMesh->indexes[pp + 1] = currentMesh->vertexCount - 3;
-				currentMesh->indexes[pp + 2] = currentMesh->vertexCount - 2;
-				currentMesh->polyCount++;
-
-				pp += 3;
-				currentMesh->indexes[pp] = currentMesh->vertexCount - 4;
-				currentMesh->indexes[pp + 1] = currentMesh->vertexCount - 2;
-				currentMesh->indexes[pp + 2] = currentMesh->vertexCount - 1;
-				currentMesh->polyCount++;
+					if (symb.mPage != page)
+						continue;
+
+					if (!pageStarted || currentMesh->polyCount + 2 > currentMesh->GetMaxPolyCount())
+					{
+						if (currentMesh->polyCount > 0)
+							currentMesh = GetNextMesh(currentMeshIdx, Math::Max(restPolyCount, 2));
+
+						currentMesh->SetTexture(mFont->mTextures[page]);
+						pageStarted = true;
+					}
+
+					Vec2F points[4] =
+					{
+						transf.Transform(symb.mFrame.LeftTop() - mSymbolsSet.mPosition),
+						transf.Transform(symb.mFrame.RightTop() - mSymbolsSet.mPosition),
+						transf.Transform(symb.mFrame.RightBottom() - mSymbolsSet.mPosition),
+						transf.Transform(symb.mFrame.LeftBottom() - mSymbolsSet.mPosition)
+					};
+
+					currentMesh->vertices[currentMesh->vertexCount++] = Vertex2(points[0], color, symb.mTexSrc.left, 1.0f - symb.mTexSrc.top);
+					currentMesh->vertices[currentMesh->vertexCount++] = Vertex2(points[1], color, symb.mTexSrc.right, 1.0f - symb.mTexSrc.top);
+					currentMesh->vertices[currentMesh->vertexCount++] = Vertex2(points[2], color, symb.mTexSrc.right, 1.0f - symb.mTexSrc.bottom);
+					currentMesh->vertices[currentMesh->vertexCount++] = Vertex2(points[3], color, symb.mTexSrc.left, 1.0f - symb.mTexSrc.bottom);
+
+					int pp = currentMesh->polyCount*3;
+					currentMesh->indexes[pp] = currentMesh->vertexCount - 4;
+					currentMesh->indexes[pp + 1] = currentMesh->vertexCount - 3;
+					currentMesh->indexes[pp + 2] = currentMesh->vertexCount - 2;
+					currentMesh->polyCount++;
+
+					pp += 3;
+					currentMesh->indexes[pp] = currentMesh->vertexCount - 4;
+					currentMesh->indexes[pp + 1] = currentMesh->vertexCount - 2;
+					currentMesh->indexes[pp + 2] = currentMesh->vertexCount - 1;
+					currentMesh->polyCount++;
+
+					restPolyCount -= 2;
+				}
 			}
 		}
 
-		currentMesh->SetTexture(mFont->mTexture);
-
 		mUpdatingMesh = false;
 	}
 
@@ -491,8 +520,35 @@ namespace o2
 		{
 			int polyCount = Math::Min<int>(needPolygons, mMeshMaxPolyCount);
 			needPolygons -= polyCount;
-			mMeshes.Add(mnew Mesh(mFont->mTexture, polyCount * 2, polyCount));
+			mMeshes.Add(mnew Mesh(TextureRef(), polyCount * 2, polyCount));
+		}
+	}
+
+	Mesh* Text::GetNextMesh(int& meshIdx, int polyCount)
+	{
+		meshIdx++;
+		if (meshIdx == mMeshes.Count())
+		{
+			polyCount = Math::Min<int>(polyCount, mMeshMaxPolyCount);
+			mMeshes.Add(mnew Mesh(TextureRef(), polyCount * 2, polyCount));
 		}
+
+		return mMeshes[meshIdx];
+	}
+
+	bool Text::IsSymbolsSetActual() const
+	{
+		return !mSymbolsSetDirty && mSymbolsSet.mFont == mFont && mSymbolsSet.mHeight == mHeight &&
+			mSymbolsSet.mAreaSize == mSize && mSymbolsSet.mHorAlign == mHorAlign && mSymbolsSet.mVerAlign == mVerAlign &&
+			mSymbolsSet.mWordWrap == mWordWrap && mSymbolsSet.mDotsEndings == mDotsEndings &&
+			mSymbolsSet.mSymbolsDistCoef == mSymbolsDistCoef && mSymbolsSet.mLinesDistCoef == mLinesDistanceCoef &&
+			mSymbolsSet.mText == mText;
+	}
+
+	void Text::OnFontCharactersRebuild()
+	{
+		mSymbolsSetDirty = true;
+		UpdateMesh();
 	}
 
 	Basis Text::CalculateTextBasis() const
@@ -524,19 +580,7 @@ namespace o2
 
 	void Text::BasisChanged()
 	{
-		if (mSymbolsSet.mAreaSize != mSize)
-			UpdateMesh();
-		else
-		{
-			Basis transform = CalculateTextBasis();
-			Basis meshTransform = mLastTransform.Inverted()*transform;
-
-			meshTransform.offs.x = Math::Round(meshTransform.offs.x);
-			meshTransform.offs.y = Math::Round(meshTransform.offs.y);
-
-			TransformMesh(mLastTransform.Inverted()*transform);
-			mLastTransform = transform;
-		}
+		UpdateMesh();
 	}
 
 	void Text::OnDeserialized(const DataNode& node)
@@ -544,23 +588,6 @@ namespace o2
 		SetFontAsset(mFontAssetId);
 	}
 
-	void Text::TransformMesh(const Basis& bas)
-	{
-		if (bas == Basis::Identity())
-			return;
-
-		for (auto& mesh : mMeshes)
-		{
-			for (unsigned int i = 0; i < mesh->vertexCount; i++)
-			{
-				Vertex2* vx = &mesh->vertices[i];
-				bas.Transform(vx->x, vx->y);
-			}
-		}
-
-		mSymbolsSet.Move(bas.offs);
-	}
-
 	void Text::SymbolsSet::Initialize(FontRef font, const WString& text, int height, const Vec2F& position, const Vec2F& areaSize,
 									  HorAlign horAlign, VerAlign verAlign, bool wordWrap, bool dotsEngings, 
 									  float charsDistCoef, float linesDistCoef)
@@ -610,7 +637,7 @@ namespace o2
 				for (int j = 0; j < 3; j++)
 				{
 					Vec2F dotChPos = Vec2F(curLine->mSize.x - dotCh.mOrigin.x, -dotCh.mOrigin.y);
-					curLine->mSymbols.Add(Symbol(dotChPos, dotChSize, dotCh.mTexSrc, dotCh.mId, dotCh.mOrigin, dotCh.mAdvance));
+					curLine->mSymbols.Add(Symbol(dotChPos, dotChSize, dotCh.mTexSrc, dotCh.mId, dotCh.mOrigin, dotCh.mAdvance, dotCh.mPage));
 					curLine->mString += '.'; 
 					curLine->mSize.x += dotCh.mAdvance*mSymbolsDistCoef;
 				}
@@ -624,7 +651,7 @@ namespace o2
 				continue;
 			}
 
-			curLine->mSymbols.Add(Symbol(chPos, chSize, ch.mTexSrc, ch.mId, ch.mOrigin, ch.mAdvance));
+			curLine->mSymbols.Add(Symbol(chPos, chSize, ch.mTexSrc, ch.mId, ch.mOrigin, ch.mAdvance, ch.mPage));
 
 			if (mText[i] != '\n')
 				curLine->mSize.x += ch.mAdvance*mSymbolsDistCoef;
@@ -739,8 +766,9 @@ namespace o2
 	{}
 
 	Text::SymbolsSet::Symbol::Symbol(const Vec2F& position, const Vec2F& size, const RectF& texSrc,
-										   UInt16 charId, const Vec2F& origin, float advance):
-		mFrame(position, position + size), mTexSrc(texSrc), mCharId(charId), mOrigin(origin), mAdvance(advance)
+										   UInt16 charId, const Vec2F& origin, float advance, int page):
+		mFrame(position, position + size), mTexSrc(texSrc), mCharId(charId), mOrigin(origin), mAdvance(advance),
+		mPage(page)
 	{}
 
 	bool Text::SymbolsSet::Symbol::operator==(const Symbol& other) const
@@ -783,8 +811,8 @@ CLASS_META(o2::Text)
 	PROTECTED_FIELD(mWordWrap).SERIALIZABLE_ATTRIBUTE();
 	PROTECTED_FIELD(mDotsEndings).SERIALIZABLE_ATTRIBUTE();
 	PROTECTED_FIELD(mMeshes);
-	PROTECTED_FIELD(mLastTransform);
 	PROTECTED_FIELD(mSymbolsSet);
+	PROTECTED_FIELD(mSymbolsSetDirty);
 	PROTECTED_FIELD(mUpdatingMesh);
 
 	PUBLIC_FUNCTION(void, Draw);
@@ -816,8 +844,10 @@ CLASS_META(o2::Text)
 	PUBLIC_FUNCTION(Vec2F, GetRealSize);
 	PUBLIC_FUNCTION(RectF, GetRealRect);
 	PROTECTED_FUNCTION(void, UpdateMesh);
-	PROTECTED_FUNCTION(void, TransformMesh, const Basis&);
+	PROTECTED_FUNCTION(bool, IsSymbolsSetActual);
+	PROTECTED_FUNCTION(void, OnFontCharactersRebuild);
 	PROTECTED_FUNCTION(void, PrepareMesh, int);
+	PROTECTED_FUNCTION(Mesh*, GetNextMesh, int&, int);
 	PROTECTED_FUNCTION(Basis, CalculateTextBasis);
 	PROTECTED_FUNCTION(void, ColorChanged);
 	PROTECTED_FUNCTION(void, BasisChanged);
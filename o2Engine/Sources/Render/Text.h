@@ -167,6 +167,7 @@ namespace o2
 				UInt16 mCharId;  // Character id
 				Vec2F  mOrigin;  // Character offset
 				float  mAdvance; // Character advance
+				int    mPage;    // Index of font texture page
 
 			public:
 				// Default constructor
@@ -174,7 +175,7 @@ namespace o2
 
 				// Constructor
 				Symbol(const Vec2F& position, const Vec2F& size, const RectF& texSrc, UInt16 charId,
-						  const Vec2F& origin, float advance);
+						  const Vec2F& origin, float advance, int page);
 
 				// Equals operator
 				bool operator==(const Symbol& other) const;
@@ -246,22 +247,28 @@ namespace o2
 		bool       mDotsEndings;       // If true, text will end on '...' @SERIALIZABLE
 									   
 		MeshesVec  mMeshes;            // Meshes vector
-		Basis      mLastTransform;     // Last mesh update transformation
 									   
-		SymbolsSet mSymbolsSet;        // Symbols set definition
+		SymbolsSet mSymbolsSet;        // Symbols set definition, cached between mesh updates
+		bool       mSymbolsSetDirty;   // True, when symbols set must be recalculated regardless of parameters
 									   
 		bool       mUpdatingMesh;      // True, when mesh is already updating
 
 	protected:
-		// Updating meshes
+		// Updating meshes. Symbols set is recalculated only when text parameters or font characters were changed
 		void UpdateMesh();
 
-		// Transforming meshes by basis
-		void TransformMesh(const Basis& bas);
+		// Returns true when symbols set was calculated with current text, font and layout parameters
+		bool IsSymbolsSetActual() const;
+
+		// It is called when font characters were rebuilt, invalidates symbols set and updates meshes
+		void OnFontCharactersRebuild();
 
 		// Preparing meshes for characters count
 		void PrepareMesh(int charactersCount);
 
+		// Returns next mesh after index and increases index. Adds mesh with polygons count when there is no more meshes
+		Mesh* GetNextMesh(int& meshIdx, int polyCount);
+
 		// Calculates and returns text basis
 		Basis CalculateTextBasis() const;
 
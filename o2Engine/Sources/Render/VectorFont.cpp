@@ -13,32 +13,25 @@ namespace o2
 {
 	VectorFont::VectorFont():
 		Font(), mFreeTypeFace(nullptr)
-	{
-		mTexture = TextureRef(Vec2I(256, 256));
-		mTextureSrcRect.Set(0, 0, 256, 256);
-	}
+	{}
 
 	VectorFont::VectorFont(const String& fileName):
 		Font(), mFreeTypeFace(nullptr)
 	{
-		mTexture = TextureRef(Vec2I(256, 256));
-		mTextureSrcRect.Set(0, 0, 256, 256);
-
 		Load(fileName);
 	}
 
 	VectorFont::VectorFont(const VectorFont& other):
 		Font(), mFreeTypeFace(other.mFreeTypeFace)
-	{
-		mTexture = TextureRef(Vec2I(256, 256));
-		mTextureSrcRect.Set(0, 0, 256, 256);
-	}
+	{}
 
 	VectorFont::~VectorFont()
 	{
 		if (mFreeTypeFace)
 			FT_Done_Face(mFreeTypeFace);
 
+		ClearPages();
+
 		for (auto effect : mEffects)
 			delete effect;
 	}
@@ -103,26 +96,15 @@ namespace o2
 	{
 		int len = needChararacters.Length();
 		Vector<wchar_t> needToRenderChars(len);
+		HashDictionary<wchar_t, bool> needToRenderCharsSet;
 		for (int i = 0; i < len; i++)
 		{
-			bool isNew = true;
 			wchar_t c = needChararacters[i];
-			for (auto ch : mCharacters)
-			{
-				if (ch.mId == c && ch.mHeight == height)
-				{
-					isNew = false;
-					break;
-				}
-			}
-
-			if (isNew)
-				isNew = !needToRenderChars.Contains(c);
-
-			if (!isNew)
+			if (FindCharacterIdx(c, height) >= 0 || needToRenderCharsSet.ContainsKey(c))
 				continue;
 
 			needToRenderChars.Add(c);
+			needToRenderCharsSet.Add(c, true);
 		}
 
 		if (needToRenderChars.Count() > 0)
@@ -152,161 +134,237 @@ namespace o2
 	void VectorFont::Reset()
 	{
 		mCharacters.Clear();
+		mCharactersIndexes.Clear();
+		ClearPages();
 	}
 
 	void VectorFont::UpdateCharacters(Vector<wchar_t>& newCharacters, int height)
 	{
-		CharDefsVec charactersDefs;
-		mRectsPacker.Clear();
-		
-		ExtractCharacterDefsFromTexture(charactersDefs);
-		RenderNewCharacters(charactersDefs, newCharacters, height);
-		PackCharactersDefs(charactersDefs);
+		Vec2I dpi = o2Render.GetDPI();
+		FT_Set_Char_Size(mFreeTypeFace, 0, height * 64, dpi.x, dpi.y);
 
-		onCharactersRebuild();
-	}
+		Vec2I border;
+		for (auto effect : mEffects)
+		{
+			Vec2I effectExt = effect->GetSizeExtend();
+			border.x = Math::Max(border.x, effectExt.x);
+			border.y = Math::Max(border.y, effectExt.y);
+		}
 
-	void VectorFont::ExtractCharacterDefsFromTexture(CharDefsVec& charDefs)
-	{
-		if (mCharacters.Count() == 0)
-			return;
+		border += Vec2I(2, 2);
 
-		Bitmap texBitmap(Bitmap::Format::R8G8B8A8, mTexture->GetSize());
+		for (auto ch : newCharacters)
+		{
+			Character character;
+			Bitmap* bitmap = RenderCharacter(ch, height, border, character);
 
-		glBindTexture(GL_TEXTURE_2D, mTexture->mHandle);
-		glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, texBitmap.GetData());
+			// Too large glyph is cached without page, so it isn't rendered and reported again
+			if (!InsertCharacter(bitmap, character))
+			{
+				o2Render.mLog->Error("Failed to insert character %i with height %i into font %s: glyph is too large", (int)ch, height, mFileName);
 
-		//glBindTexture(GL_TEXTURE_2D, o2Render.mLastDrawTexture->mHandle);
+				character.mPage = -1;
+				character.mTexSrc = RectF();
+			}
 
-		for (auto& ch : mCharacters)
-		{
-			CharDef charDef;
+			mCharacters.Add(character);
+			mCharactersIndexes.Add(GetCharacterKey(character.mId, character.mHeight), mCharacters.Count() - 1);
+
+			delete bitmap;
+		}
 
-			Bitmap* charBitmap = mnew Bitmap(Bitmap::Format::R8G8B8A8, ch.mSize);
+		UploadPages();
+
+		onCharactersRebuild();
+	}
 
-			RectI srcRect;
-			Vec2F texSize = texBitmap.GetSize();
-			srcRect.left = (int)(ch.mTexSrc.left*texSize.x);
-			srcRect.right = (int)(ch.mTexSrc.right*texSize.x);
-			srcRect.bottom = (int)(ch.mTexSrc.top*texSize.y);
-			srcRect.top = (int)(ch.mTexSrc.bottom*texSize.y);
+	Bitmap* VectorFont::RenderCharacter(wchar_t id, int height, const Vec2I& border, Character& character)
+	{
+		FT_Load_Char(mFreeTypeFace, id, FT_LOAD_RENDER);
+		auto glyph = mFreeTypeFace->glyph;
 
-			charBitmap->CopyImage(&texBitmap, Vec2I(), srcRect);
+		Vec2I glyphSize(glyph->bitmap.width, glyph->bitmap.rows);
 
-			charDef.mCharacter = ch;
-			charDef.mBitmap = charBitmap;
-			charDef.mPackRect = mRectsPacker.AddRect(ch.mSize);
+		Bitmap* bitmap = mnew Bitmap(Bitmap::Format::R8G8B8A8, glyphSize + border*2);
+		bitmap->Fill(Color4(255, 255, 255, 0));
+		UInt8* bitmapData = bitmap->GetData();
+		Vec2I bitmapSize = bitmap->GetSize();
 
-			charDefs.Add(charDef);
+		for (int x = 0; x < (int)glyph->bitmap.width; x++)
+		{
+			for (int y = 0; y < (int)glyph->bitmap.rows; y++)
+			{
+				Color4 c(255, 255, 255, glyph->bitmap.buffer[y*glyph->bitmap.width + x]);
+				ULong cl = c.ABGR();
+				memcpy(&bitmapData[((bitmapSize.y - y - 1 - border.y)*bitmapSize.x + x + border.x)*4], &cl, 4);
+			}
 		}
+
+		for (auto effect : mEffects)
+			effect->Process(bitmap);
+
+		character.mId = id;
+		character.mHeight = height;
+		character.mSize = bitmapSize;
+		character.mAdvance = glyph->advance.x/64.0f;
+		character.mOrigin.x = -glyph->metrics.horiBearingX/64.0f + border.x;
+		character.mOrigin.y = (glyph->metrics.height - glyph->metrics.horiBearingY)/64.0f + border.y;
+
+		return bitmap;
 	}
 
-	void VectorFont::RenderNewCharacters(CharDefsVec& charDefs, Vector<wchar_t>& newCharacters, int height)
+	bool VectorFont::InsertCharacter(Bitmap* bitmap, Character& character)
 	{
-		Vec2I dpi = o2Render.GetDPI();
-		FT_Set_Char_Size(mFreeTypeFace, 0, height * 64, dpi.x, dpi.y);
+		Vec2I size = bitmap->GetSize();
+		if (size.x > mMaxPageSize || size.y > mMaxPageSize)
+			return false;
 
-		Vec2I border;
-		for (auto effect : mEffects)
+		Vec2I position;
+		int pageIdx = -1;
+		for (int i = 0; i < mPages.Count() && pageIdx < 0; i++)
 		{
-			Vec2I effectExt = effect->GetSizeExtend();
-			border.x = Math::Max(border.x, effectExt.x);
-			border.y = Math::Max(border.y, effectExt.y);
+			if (FindPlaceOnPage(mPages[i], size, position))
+				pageIdx = i;
 		}
 
-		border += Vec2I(2, 2);
-		//border = Vec2F();
+		while (pageIdx < 0)
+		{
+			if (mPages.IsEmpty() || mPages.Last().mBitmap->GetSize().x >= mMaxPageSize)
+				AddPage();
+			else
+				GrowPage(mPages.Count() - 1);
 
-		for (auto ch : newCharacters)
+			if (FindPlaceOnPage(mPages.Last(), size, position))
+				pageIdx = mPages.Count() - 1;
+		}
+
+		Page& page = mPages[pageIdx];
+		Vec2I pageSize = page.mBitmap->GetSize();
+		page.mBitmap->CopyImage(bitmap, position);
+
+		if (!page.mNeedFullUpload)
 		{
-			CharDef newCharDef;
+			glBindTexture(GL_TEXTURE_2D, mTextures[pageIdx]->mHandle);
+			glTexSubImage2D(GL_TEXTURE_2D, 0, position.x, pageSize.y - position.y - size.y, size.x, size.y, GL_RGBA,
+							GL_UNSIGNED_BYTE, bitmap->GetData());
+		}
 
-			FT_Load_Char(mFreeTypeFace, ch, FT_LOAD_RENDER);
-			auto glyph = mFreeTypeFace->glyph;
+		Vec2F invPageSize(1.0f/pageSize.x, 1.0f/pageSize.y);
+		character.mPage = pageIdx;
+		character.mTexSrc.left = position.x*invPageSize.x;
+		character.mTexSrc.right = (position.x + size.x)*invPageSize.x;
+		character.mTexSrc.top = position.y*invPageSize.y;
+		character.mTexSrc.bottom = (position.y + size.y)*invPageSize.y;
 
-			Vec2I glyphSize(glyph->bitmap.width, glyph->bitmap.rows);
+		return true;
+	}
 
-			Bitmap* newBitmap = mnew Bitmap(Bitmap::Format::R8G8B8A8, glyphSize + border*2);
-			newBitmap->Fill(Color4(255, 255, 255, 0));
-			UInt8* newBitmapData = newBitmap->GetData();
-			Vec2I newBitmapSize = newBitmap->GetSize();
+	bool VectorFont::FindPlaceOnPage(Page& page, const Vec2I& size, Vec2I& position)
+	{
+		Vec2I pageSize = page.mBitmap->GetSize();
 
-			for (int x = 0; x < (int)glyph->bitmap.width; x++)
+		Shelf* bestShelf = nullptr;
+		for (auto& shelf : page.mShelves)
+		{
+			if (shelf.mHeight >= size.y && shelf.mWidth + size.x <= pageSize.x &&
+				(!bestShelf || shelf.mHeight < bestShelf->mHeight))
 			{
-				for (int y = 0; y < (int)glyph->bitmap.rows; y++)
-				{
-					Color4 c(255, 255, 255, glyph->bitmap.buffer[y*glyph->bitmap.width + x]);
-					ULong cl = c.ABGR();
-					memcpy(&newBitmapData[((newBitmapSize.y - y - 1 - border.y)*newBitmapSize.x + x + border.x)*4], &cl, 4);
-				}
+				bestShelf = &shelf;
 			}
+		}
 
-			for (auto effect : mEffects)
-				effect->Process(newBitmap);
+		if (!bestShelf)
+		{
+			int shelvesTop = 0;
+			if (!page.mShelves.IsEmpty())
+				shelvesTop = page.mShelves.Last().mBottom + page.mShelves.Last().mHeight;
+
+			if (shelvesTop + size.y > pageSize.y || size.x > pageSize.x)
+				return false;
 
-			newCharDef.mPackRect = mRectsPacker.AddRect(glyphSize + border*2);
-			newCharDef.mBitmap = newBitmap;
-			newCharDef.mCharacter.mId = ch;
-			newCharDef.mCharacter.mHeight = height;
-			newCharDef.mCharacter.mSize = newBitmapSize;
-			newCharDef.mCharacter.mAdvance = glyph->advance.x/64.0f;
-			newCharDef.mCharacter.mOrigin.x = -glyph->metrics.horiBearingX/64.0f + border.x;
-			newCharDef.mCharacter.mOrigin.y = (glyph->metrics.height - glyph->metrics.horiBearingY)/64.0f + border.y;
+			Shelf newShelf;
+			newShelf.mBottom = shelvesTop;
+			newShelf.mHeight = size.y;
+			newShelf.mWidth = 0;
 
-			charDefs.Add(newCharDef);
+			page.mShelves.Add(newShelf);
+			bestShelf = &page.mShelves.Last();
 		}
+
+		position = Vec2I(bestShelf->mWidth, bestShelf->mBottom);
+		bestShelf->mWidth += size.x;
+
+		return true;
 	}
 
-	void VectorFont::PackCharactersDefs(CharDefsVec& charDefs)
+	void VectorFont::AddPage()
 	{
-		mCharacters.Clear();
+		Page newPage;
+		newPage.mBitmap = mnew Bitmap(Bitmap::Format::R8G8B8A8, Vec2I(mFirstPageSize, mFirstPageSize));
+		newPage.mBitmap->Fill(Color4(255, 255, 255, 0));
+		newPage.mNeedFullUpload = true;
 
-		int texSizes[] ={64, 128, 256, 512, 1024};
-		Vec2I newTexSize;
+		mPages.Add(newPage);
+		mTextures.Add(TextureRef(newPage.mBitmap->GetSize(), Texture::Format::R8G8B8A8, Texture::Usage::Default));
 
-		for (int i = 0; i < 5; i++)
-		{
-			newTexSize = Vec2I(texSizes[i], texSizes[i]);
-			mRectsPacker.SetMaxSize(newTexSize);
+		if (mPages.Count() == 1)
+			mTextureSrcRect.Set(Vec2I(), newPage.mBitmap->GetSize());
+	}
 
-			if (!mRectsPacker.Pack())
-				continue;
+	void VectorFont::GrowPage(int pageIdx)
+	{
+		Page& page = mPages[pageIdx];
+		Vec2I oldSize = page.mBitmap->GetSize();
+		Vec2I newSize(oldSize.x*2, oldSize.y*2);
 
-			if (mRectsPacker.GetPagesCount() > 1)
-				continue;
+		Bitmap* newBitmap = mnew Bitmap(Bitmap::Format::R8G8B8A8, newSize);
+		newBitmap->Fill(Color4(255, 255, 255, 0));
+		newBitmap->CopyImage(page.mBitmap, Vec2I());
 
-			break;
-		}
+		delete page.mBitmap;
+		page.mBitmap = newBitmap;
+		page.mNeedFullUpload = true;
 
-		if (newTexSize != mTexture->GetSize())
-		{
-			mTexture = TextureRef(newTexSize, Texture::Format::R8G8B8A8, Texture::Usage::Default);
-			mTextureSrcRect.Set(Vec2I(), newTexSize);
-		}
+		mTextures[pageIdx] = TextureRef(newSize, Texture::Format::R8G8B8A8, Texture::Usage::Default);
 
-		Bitmap texBitmap(Bitmap::Format::R8G8B8A8, mTexture->GetSize());
-		texBitmap.Fill(Color4(255, 255, 255, 0));
-		Vec2F invTexSize(1.0f/mTexture->GetSize().x, 1.0f/mTexture->GetSize().y);
-		for (auto& def : charDefs)
+		if (pageIdx == 0)
+			mTextureSrcRect.Set(Vec2I(), newSize);
+
+		Vec2F scale((float)oldSize.x/newSize.x, (float)oldSize.y/newSize.y);
+		for (auto& ch : mCharacters)
 		{
-			texBitmap.CopyImage(def.mBitmap, def.mPackRect->mRect.LeftBottom());
+			if (ch.mPage != pageIdx)
+				continue;
 
-			def.mCharacter.mTexSrc.left = def.mPackRect->mRect.left*invTexSize.x;
-			def.mCharacter.mTexSrc.right = def.mPackRect->mRect.right*invTexSize.x;
-			def.mCharacter.mTexSrc.top = def.mPackRect->mRect.bottom*invTexSize.y;
-			def.mCharacter.mTexSrc.bottom = def.mPackRect->mRect.top*invTexSize.y;
+			ch.mTexSrc.left *= scale.x;
+			ch.mTexSrc.right *= scale.x;
+			ch.mTexSrc.top *= scale.y;
+			ch.mTexSrc.bottom *= scale.y;
+		}
+	}
 
-			mCharacters.Add(def.mCharacter);
+	void VectorFont::UploadPages()
+	{
+		for (int i = 0; i < mPages.Count(); i++)
+		{
+			if (!mPages[i].mNeedFullUpload)
+				continue;
 
-			delete def.mBitmap;
+			mTextures[i]->SetData(mPages[i].mBitmap);
+			mPages[i].mNeedFullUpload = false;
 		}
 
-		glBindTexture(GL_TEXTURE_2D, mTexture->mHandle);
-		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, texBitmap.GetSize().x, texBitmap.GetSize().y, 0, GL_RGBA, GL_UNSIGNED_BYTE,
-					 texBitmap.GetData());
-
 		GL_CHECK_ERROR(o2Render.mLog);
-		//glBindTexture(GL_TEXTURE_2D, o2Render.mLastDrawTexture->mHandle);
+	}
+
+	void VectorFont::ClearPages()
+	{
+		for (auto& page : mPages)
+			delete page.mBitmap;
+
+		mPages.Clear();
+		mTextures.Clear();
+		mTextureSrcRect = RectI();
 	}
 }
 
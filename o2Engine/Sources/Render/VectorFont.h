@@ -6,17 +6,17 @@
 #include "Render/Font.h"
 #include "Utils/Containers/Dictionary.h"
 #include "Utils/Property.h"
-#include "Utils/RectPacker.h"
 #include "Utils/Serializable.h"
 
 namespace o2
 {
-	class RectsPacker;
 	class Bitmap;
 
-	// -----------
-	// Vector font
-	// -----------
+	// -------------------------------------------------------------------------------------------
+	// Vector font. Glyphs are rendered by FreeType on demand and inserted into textures pages
+	// incrementally: each page keeps CPU copy of texture and places glyphs on shelves, new glyphs
+	// are uploaded into texture by sub-rectangles
+	// -------------------------------------------------------------------------------------------
 	class VectorFont: public Font
 	{
 	public:
@@ -79,42 +79,71 @@ namespace o2
 		// Removes all effects
 		void RemoveAllEffects();
 
-		// Removes all cached characters
+		// Removes all cached characters and textures pages
 		void Reset();
 
 	protected:
-		//-------------------------------
-		// Font glyph rendering character
-		// ------------------------------
-		struct CharDef
+		static const int mFirstPageSize = 128;  // Size of new page. Page size is doubled when page is full
+		static const int mMaxPageSize = 1024;   // Maximum size of page. New page is created when page is full
+
+		// -----------------------------------------------------------
+		// Row of glyphs on page. Glyphs are placed from left to right
+		// -----------------------------------------------------------
+		struct Shelf
+		{
+			int mBottom; // Bottom position of shelf on page
+			int mHeight; // Height of shelf
+			int mWidth;  // Width of placed glyphs
+
+			bool operator==(const Shelf& other) const { return mBottom == other.mBottom; }
+		};
+		typedef Vector<Shelf> ShelvesVec;
+
+		// ------------------------------------------------------------------------------
+		// Textures page. Page texture is stored in mTextures with same index as the page
+		// ------------------------------------------------------------------------------
+		struct Page
 		{
-			RectsPacker::Rect* mPackRect;  // Pack rect
-			Character          mCharacter; // Character
-			Bitmap*            mBitmap;    // Bitmap
+			Bitmap*    mBitmap;         // CPU copy of page texture
+			ShelvesVec mShelves;        // Shelves of glyphs, from bottom to top
+			bool       mNeedFullUpload; // True when page texture was recreated and needs upload whole bitmap
 
-			bool operator==(const CharDef& other) const { return false; }
+			bool operator==(const Page& other) const { return mBitmap == other.mBitmap; }
 		};
-		typedef Vector<CharDef> CharDefsVec;
+		typedef Vector<Page> PagesVec;
 		typedef Vector<Effect*> EffectsVec;
 
 	protected:
-		String        mFileName;     // Source file name
-		RectsPacker   mRectsPacker;  // Characters packer
-		FT_Face       mFreeTypeFace; // Free Type font face
-		EffectsVec    mEffects;      // Font effects
+		String     mFileName;     // Source file name
+		FT_Face    mFreeTypeFace; // Free Type font face
+		EffectsVec mEffects;      // Font effects
+		PagesVec   mPages;        // Textures pages
 
 	protected:
-		// Updates characters set
+		// Renders new characters and inserts them into pages
 		void UpdateCharacters(Vector<wchar_t>& newCharacters, int height);
 
-		// Extracts characters from texture
-		void ExtractCharacterDefsFromTexture(CharDefsVec& charDefs);
+		// Renders character glyph into bitmap with effects. Fills character metrics
+		Bitmap* RenderCharacter(wchar_t id, int height, const Vec2I& border, Character& character);
+
+		// Inserts glyph bitmap into pages, grows last page or adds new page when there is no space. Fills character
+		// page and texture source rectangle. Returns false when glyph is larger than page
+		bool InsertCharacter(Bitmap* bitmap, Character& character);
+
+		// Searches place for glyph with size on page. Returns false when there is no space
+		bool FindPlaceOnPage(Page& page, const Vec2I& size, Vec2I& position);
+
+		// Adds new empty page
+		void AddPage();
+
+		// Doubles size of page. Texture source rectangles of page characters are updated
+		void GrowPage(int pageIdx);
 
-		// Renders new characters
-		void RenderNewCharacters(CharDefsVec& charDefs, Vector<wchar_t>& newCharacters, int height);
+		// Uploads pages, which textures were recreated
+		void UploadPages();
 
-		// Pack all characters
-		void PackCharactersDefs(CharDefsVec& charDefs);
+		// Frees pages bitmaps and textures
+		void ClearPages();
 	};
 
 	template<typename _eff_type, typename ... _args>
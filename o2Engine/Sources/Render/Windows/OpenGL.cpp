@@ -21,6 +21,12 @@ void GetGLExtensions(o2::LogStream* log /*= nullptr*/)
 	glDeleteBuffers             = (PFNGLDELETEBUFFERSPROC)GetSafeWGLProcAddress("glDeleteBuffers", log);
 	glDeleteFramebuffersEXT     = (PFNGLDELETEFRAMEBUFFERSPROC)GetSafeWGLProcAddress("glDeleteFramebuffersEXT", log);
 	glCheckFramebufferStatusEXT = (PFNGLCHECKFRAMEBUFFERSTATUSEXTPROC)GetSafeWGLProcAddress("glCheckFramebufferStatusEXT", log);
+	glGenBuffers                = (PFNGLGENBUFFERSPROC)GetSafeWGLProcAddress("glGenBuffers", log);
+	glBindBuffer                = (PFNGLBINDBUFFERPROC)GetSafeWGLProcAddress("glBindBuffer", log);
+	glBufferData                = (PFNGLBUFFERDATAPROC)GetSafeWGLProcAddress("glBufferData", log);
+	glMapBufferRange            = (PFNGLMAPBUFFERRANGEPROC)GetSafeWGLProcAddress("glMapBufferRange", log);
+	glFlushMappedBufferRange    = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC)GetSafeWGLProcAddress("glFlushMappedBufferRange", log);
+	glUnmapBuffer               = (PFNGLUNMAPBUFFERPROC)GetSafeWGLProcAddress("glUnmapBuffer", log);
 
 }
 
@@ -93,4 +99,10 @@ extern PFNGLFRAMEBUFFERTEXTUREPROC        glFramebufferTexture        = NULL;
 extern PFNGLDRAWBUFFERSPROC               glDrawBuffers               = NULL;
 extern PFNGLDELETEBUFFERSPROC             glDeleteBuffers             = NULL;
 extern PFNGLDELETEFRAMEBUFFERSPROC        glDeleteFramebuffersEXT     = NULL;
-extern PFNGLCHECKFRAMEBUFFERSTATUSEXTPROC glCheckFramebufferStatusEXT = NULL;
\ No newline at end of file
+extern PFNGLCHECKFRAMEBUFFERSTATUSEXTPROC glCheckFramebufferStatusEXT = NULL;
+extern PFNGLGENBUFFERSPROC                glGenBuffers                = NULL;
+extern PFNGLBINDBUFFERPROC                glBindBuffer                = NULL;
+extern PFNGLBUFFERDATAPROC                glBufferData                = NULL;
+extern PFNGLMAPBUFFERRANGEPROC            glMapBufferRange            = NULL;
+extern PFNGLFLUSHMAPPEDBUFFERRANGEPROC    glFlushMappedBufferRange    = NULL;
+extern PFNGLUNMAPBUFFERPROC               glUnmapBuffer               = NULL;
\ No newline at end of file
@@ -37,3 +37,9 @@ extern PFNGLDRAWBUFFERSPROC               glDrawBuffers;
 extern PFNGLDELETEBUFFERSPROC             glDeleteBuffers;
 extern PFNGLDELETEFRAMEBUFFERSPROC        glDeleteFramebuffersEXT;
 extern PFNGLCHECKFRAMEBUFFERSTATUSEXTPROC glCheckFramebufferStatusEXT;
+extern PFNGLGENBUFFERSPROC                glGenBuffers;
+extern PFNGLBINDBUFFERPROC                glBindBuffer;
+extern PFNGLBUFFERDATAPROC                glBufferData;
+extern PFNGLMAPBUFFERRANGEPROC            glMapBufferRange;
+extern PFNGLFLUSHMAPPEDBUFFERRANGEPROC    glFlushMappedBufferRange;
+extern PFNGLUNMAPBUFFERPROC               glUnmapBuffer;
@@ -15,7 +15,7 @@ namespace o2
 	DECLARE_SINGLETON(Render);
 
 	Render::Render():
-		mReady(false), mStencilDrawing(false), mStencilTest(false), mClippingEverything(false)
+		mReady(false), mStencilDrawing(false), mStencilTest(false), mClippingEverything(false), mCommandsRecording(false)
 	{
 		mVertexBufferSize = USHRT_MAX;
 		mIndexBufferSize = USHRT_MAX;
@@ -95,22 +95,18 @@ namespace o2
 		// Check compatibles
 		CheckCompatibles();
 
-		// Initialize buffers
-		mVertexData = new UInt8[mVertexBufferSize*sizeof(Vertex2)];
-
-		mVertexIndexData = new UInt16[mIndexBufferSize];
-		mLastDrawVertex = 0;
-		mTrianglesCount = 0;
-		mCurrentPrimitiveType = GL_TRIANGLES;
-
 		// Configure OpenGL
 		glEnableClientState(GL_COLOR_ARRAY);
 		glEnableClientState(GL_TEXTURE_COORD_ARRAY);
 		glEnableClientState(GL_VERTEX_ARRAY);
 
-		glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex2), mVertexData + sizeof(float) * 3);
-		glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex2), mVertexData + sizeof(float) * 3 + sizeof(unsigned long));
-		glVertexPointer(3, GL_FLOAT, sizeof(Vertex2), mVertexData + 0);
+		// Initialize buffers
+		InitializeStreamingBuffers();
+
+		mLastDrawVertex = 0;
+		mTrianglesCount = 0;
+		mCurrentPrimitiveType = GL_TRIANGLES;
+		mGLScissorTest = false;
 
 		glEnable(GL_BLEND);
 		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
@@ -165,6 +161,8 @@ namespace o2
 
 		if (mGLContext)
 		{
+			DeinitializeStreamingBuffers();
+
 			auto fonts = mFonts;
 			for (auto font : fonts)
 				delete font;
@@ -223,9 +221,13 @@ namespace o2
 
 		mScissorInfos.Clear();
 		mStackScissors.Clear();
+		mCommandList.Clear();
 
 		mClippingEverything = false;
 
+		glDisable(GL_SCISSOR_TEST);
+		mGLScissorTest = false;
+
 		// Reset view matrices
 		SetupViewMatrix(mResolution);
 
@@ -238,9 +240,27 @@ namespace o2
 	void Render::DrawPrimitives()
 	{
 		if (mLastDrawVertex < 1)
+		{
+			if (mStreamingBuffersMapped)
+				UnmapStreamingBuffers();
+
 			return;
+		}
+
+		if (mVertexBufferObject)
+		{
+			UInt8* vertexOffset = (UInt8*)(size_t)mVertexStreamOffset;
+			UInt8* indexOffset = (UInt8*)(size_t)mIndexStreamOffset;
+
+			UnmapStreamingBuffers();
 
-		glDrawElements(mCurrentPrimitiveType, mLastDrawIdx, GL_UNSIGNED_SHORT, mVertexIndexData);
+			glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex2), vertexOffset + sizeof(float) * 3);
+			glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex2), vertexOffset + sizeof(float) * 3 + sizeof(unsigned long));
+			glVertexPointer(3, GL_FLOAT, sizeof(Vertex2), vertexOffset + 0);
+
+			glDrawElements(mCurrentPrimitiveType, mLastDrawIdx, GL_UNSIGNED_SHORT, indexOffset);
+		}
+		else glDrawElements(mCurrentPrimitiveType, mLastDrawIdx, GL_UNSIGNED_SHORT, mVertexIndexData);
 
 		GL_CHECK_ERROR(mLog);
 
@@ -250,6 +270,181 @@ namespace o2
 		mDIPCount++;
 	}
 
+	void Render::FlushCommands()
+	{
+		if (mCommandsRecording)
+		{
+			if (mCommandList.GetCommandsCount() > 0)
+			{
+				DrawPrimitives();
+
+				mCommandList.BuildBatches(mVertexBufferSize - 1, mIndexBufferSize - 1);
+
+				auto& commands = mCommandList.GetCommands();
+				const Vertex2* vertices = mCommandList.GetVertices();
+				const UInt16* indexes = mCommandList.GetIndexes();
+
+				for (auto& batch : mCommandList.GetBatches())
+				{
+					SetScissorTest(batch.state.scissorTest, batch.state.scissorRect);
+
+					for (int i = batch.firstCommand; i >= 0; i = commands[i].nextInBatch)
+					{
+						auto& command = commands[i];
+
+						if (batch.state.primitiveType == RenderCommandList::PrimitiveType::Lines)
+							DrawLinesData(vertices + command.vertexBegin, command.vertexCount/2);
+						else
+						{
+							DrawMeshData(batch.state.texture, vertices + command.vertexBegin, command.vertexCount,
+										 indexes + command.indexBegin, command.indexCount);
+						}
+					}
+
+					DrawPrimitives();
+				}
+
+				mCommandList.Clear();
+			}
+
+			UpdateScissorTest();
+		}
+
+		DrawPrimitives();
+	}
+
+	void Render::InitializeStreamingBuffers()
+	{
+		mVertexStreamOffset = 0;
+		mIndexStreamOffset = 0;
+		mStreamingBuffersMapped = false;
+
+		if (!glGenBuffers || !glBindBuffer || !glBufferData || !glMapBufferRange || !glFlushMappedBufferRange ||
+			!glUnmapBuffer)
+		{
+			mLog->Out("Streaming buffers aren't supported, using client side arrays");
+			InitializeClientBuffers();
+			return;
+		}
+
+		glGenBuffers(1, &mVertexBufferObject);
+		glGenBuffers(1, &mIndexBufferObject);
+
+		glBindBuffer(GL_ARRAY_BUFFER, mVertexBufferObject);
+		glBufferData(GL_ARRAY_BUFFER, mVertexBufferSize*sizeof(Vertex2)*mStreamingBatchesCount, NULL, GL_STREAM_DRAW);
+
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBufferObject);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, mIndexBufferSize*sizeof(UInt16)*mStreamingBatchesCount, NULL, GL_STREAM_DRAW);
+
+		mVertexData = nullptr;
+		mVertexIndexData = nullptr;
+
+		GL_CHECK_ERROR(mLog);
+	}
+
+	void Render::DeinitializeStreamingBuffers()
+	{
+		if (!mVertexBufferObject)
+			return;
+
+		if (mStreamingBuffersMapped)
+		{
+			glUnmapBuffer(GL_ARRAY_BUFFER);
+			glUnmapBuffer(GL_ELEMENT_ARRAY_BUFFER);
+			mStreamingBuffersMapped = false;
+		}
+
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+
+		glDeleteBuffers(1, &mVertexBufferObject);
+		glDeleteBuffers(1, &mIndexBufferObject);
+
+		mVertexBufferObject = 0;
+		mIndexBufferObject = 0;
+	}
+
+	void Render::InitializeClientBuffers()
+	{
+		mVertexData = new UInt8[mVertexBufferSize*sizeof(Vertex2)];
+		mVertexIndexData = new UInt16[mIndexBufferSize];
+
+		glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex2), mVertexData + sizeof(float) * 3);
+		glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex2), mVertexData + sizeof(float) * 3 + sizeof(unsigned long));
+		glVertexPointer(3, GL_FLOAT, sizeof(Vertex2), mVertexData + 0);
+	}
+
+	void Render::MapStreamingBuffers()
+	{
+		UInt vertexBatchSize = mVertexBufferSize*sizeof(Vertex2);
+		UInt indexBatchSize = mIndexBufferSize*sizeof(UInt16);
+
+		// Ring is over - orphaning storage, driver keeps old one while GPU uses it
+		if (mVertexStreamOffset + vertexBatchSize > vertexBatchSize*mStreamingBatchesCount)
+		{
+			glBufferData(GL_ARRAY_BUFFER, vertexBatchSize*mStreamingBatchesCount, NULL, GL_STREAM_DRAW);
+			mVertexStreamOffset = 0;
+		}
+
+		if (mIndexStreamOffset + indexBatchSize > indexBatchSize*mStreamingBatchesCount)
+		{
+			glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexBatchSize*mStreamingBatchesCount, NULL, GL_STREAM_DRAW);
+			mIndexStreamOffset = 0;
+		}
+
+		// Ranges after offsets aren't used by GPU until orphaning, so mapping can be unsynchronized
+		GLbitfield access = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_FLUSH_EXPLICIT_BIT |
+			GL_MAP_UNSYNCHRONIZED_BIT;
+
+		mVertexData = (UInt8*)glMapBufferRange(GL_ARRAY_BUFFER, mVertexStreamOffset, vertexBatchSize, access);
+		mVertexIndexData = (UInt16*)glMapBufferRange(GL_ELEMENT_ARRAY_BUFFER, mIndexStreamOffset, indexBatchSize, access);
+
+		if (!mVertexData || !mVertexIndexData)
+		{
+			mLog->Error("Failed to map streaming buffers, using client side arrays");
+
+			// One of buffers could be mapped successfully, it must not stay mapped
+			if (mVertexData)
+				glUnmapBuffer(GL_ARRAY_BUFFER);
+
+			if (mVertexIndexData)
+				glUnmapBuffer(GL_ELEMENT_ARRAY_BUFFER);
+
+			mVertexData = nullptr;
+			mVertexIndexData = nullptr;
+
+			DeinitializeStreamingBuffers();
+			InitializeClientBuffers();
+			return;
+		}
+
+		mStreamingBuffersMapped = true;
+	}
+
+	void Render::UnmapStreamingBuffers()
+	{
+		UInt vertexBytes = mLastDrawVertex*sizeof(Vertex2);
+		UInt indexBytes = mLastDrawIdx*sizeof(UInt16);
+
+		if (vertexBytes > 0)
+			glFlushMappedBufferRange(GL_ARRAY_BUFFER, 0, vertexBytes);
+
+		if (indexBytes > 0)
+			glFlushMappedBufferRange(GL_ELEMENT_ARRAY_BUFFER, 0, indexBytes);
+
+		glUnmapBuffer(GL_ARRAY_BUFFER);
+		glUnmapBuffer(GL_ELEMENT_ARRAY_BUFFER);
+
+		// Next batches begins after written data, aligned for vertex attributes
+		const UInt alignment = 64;
+		mVertexStreamOffset += (vertexBytes + alignment - 1)/alignment*alignment;
+		mIndexStreamOffset += (indexBytes + alignment - 1)/alignment*alignment;
+
+		mVertexData = nullptr;
+		mVertexIndexData = nullptr;
+		mStreamingBuffersMapped = false;
+	}
+
 	void Render::SetupViewMatrix(const Vec2I& viewSize)
 	{
 		mCurrentResolution = viewSize;
@@ -270,7 +465,7 @@ namespace o2
 		postRender();
 		postRender.Clear();
 
-		DrawPrimitives();
+		FlushCommands();
 		SwapBuffers(mHDC);
 
 		GL_CHECK_ERROR(mLog);
@@ -281,6 +476,8 @@ namespace o2
 
 	void Render::Clear(const Color4& color /*= Color4::Blur()*/)
 	{
+		FlushCommands();
+
 		glClearColor(color.RF(), color.GF(), color.BF(), color.AF());
 		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
@@ -320,7 +517,7 @@ namespace o2
 
 	void Render::UpdateCameraTransforms()
 	{
-		DrawPrimitives();
+		FlushCommands();
 
 		Vec2F resf = (Vec2F)mCurrentResolution;
 
@@ -536,7 +733,7 @@ namespace o2
 		if (mStencilDrawing || mStencilTest)
 			return;
 
-		DrawPrimitives();
+		FlushCommands();
 
 		glEnable(GL_STENCIL_TEST);
 		glStencilFunc(GL_ALWAYS, 0x1, 0xffffffff);
@@ -553,7 +750,7 @@ namespace o2
 		if (!mStencilDrawing)
 			return;
 
-		DrawPrimitives();
+		FlushCommands();
 
 		glDisable(GL_STENCIL_TEST);
 		glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
@@ -568,7 +765,7 @@ namespace o2
 		if (mStencilTest || mStencilDrawing)
 			return;
 
-		DrawPrimitives();
+		FlushCommands();
 
 		glEnable(GL_STENCIL_TEST);
 		glStencilFunc(GL_EQUAL, 0x1, 0xffffffff);
@@ -583,7 +780,7 @@ namespace o2
 		if (!mStencilTest)
 			return;
 
-		DrawPrimitives();
+		FlushCommands();
 
 		glDisable(GL_STENCIL_TEST);
 
@@ -597,6 +794,8 @@ namespace o2
 
 	void Render::ClearStencil()
 	{
+		FlushCommands();
+
 		glClearStencil(0);
 		glClear(GL_STENCIL_BUFFER_BIT);
 
@@ -628,7 +827,9 @@ namespace o2
 
 	void Render::EnableScissorTest(const RectI& rect)
 	{
-		DrawPrimitives();
+		// Recorded commands keep scissor in their state, scissor is applied on flush
+		if (!mCommandsRecording)
+			DrawPrimitives();
 
 		RectI summaryScissorRect = rect;
 		if (!mStackScissors.IsEmpty())
@@ -638,19 +839,12 @@ namespace o2
 			summaryScissorRect = summaryScissorRect.GetIntersection(lastSummaryClipRect);
 			mScissorInfos.Last().mEndDepth = mDrawingDepth;
 		}
-		else
-		{
-			glEnable(GL_SCISSOR_TEST);
-			GL_CHECK_ERROR(mLog);
-		}
 
 		mScissorInfos.Add(ScissorInfo(summaryScissorRect, mDrawingDepth));
 		mStackScissors.Add(ScissorStackItem(rect, summaryScissorRect));
 
-		glScissor((int)(summaryScissorRect.left + mCurrentResolution.x*0.5f), 
-				  (int)(summaryScissorRect.bottom + mCurrentResolution.y*0.5f),
-				  (int)summaryScissorRect.Width(), 
-				  (int)summaryScissorRect.Height());
+		if (!mCommandsRecording)
+			UpdateScissorTest();
 	}
 
 	void Render::DisableScissorTest(bool forcible /*= false*/)
@@ -661,13 +855,11 @@ namespace o2
 			return;
 		}
 
-		DrawPrimitives();
+		if (!mCommandsRecording)
+			DrawPrimitives();
 
 		if (forcible)
 		{
-			glDisable(GL_SCISSOR_TEST);
-			GL_CHECK_ERROR(mLog);
-
 			while (!mStackScissors.IsEmpty() && !mStackScissors.Last().mRenderTarget)
 				mStackScissors.PopBack();
 
@@ -677,8 +869,6 @@ namespace o2
 		{
 			if (mStackScissors.Count() == 1)
 			{
-				glDisable(GL_SCISSOR_TEST);
-				GL_CHECK_ERROR(mLog);
 				mStackScissors.PopBack();
 
 				mScissorInfos.Last().mEndDepth = mDrawingDepth;
@@ -688,10 +878,6 @@ namespace o2
 			{
 				mStackScissors.PopBack();
 				RectI lastClipRect = mStackScissors.Last().mSummaryScissorRect;
-				glScissor((int)(lastClipRect.left + mCurrentResolution.x*0.5f),
-						  (int)(lastClipRect.bottom + mCurrentResolution.y*0.5f),
-						  (int)lastClipRect.Width(), 
-						  (int)lastClipRect.Height());
 
 				mScissorInfos.Last().mEndDepth = mDrawingDepth;
 				mScissorInfos.Add(ScissorInfo(lastClipRect, mDrawingDepth));
@@ -699,6 +885,9 @@ namespace o2
 				mClippingEverything = lastClipRect == RectI();
 			}
 		}
+
+		if (!mCommandsRecording)
+			UpdateScissorTest();
 	}
 
 	bool Render::IsScissorTestEnabled() const
@@ -716,15 +905,28 @@ namespace o2
 		if (mClippingEverything)
 			return true;
 
+		if (mCommandsRecording)
+		{
+			mCommandList.AddMesh(GetCommandState(mesh->mTexture.mTexture, RenderCommandList::PrimitiveType::Triangles),
+								 mDrawingDepth, mesh->vertices, mesh->vertexCount, mesh->indexes, mesh->polyCount*3);
+		}
+		else DrawMeshData(mesh->mTexture.mTexture, mesh->vertices, mesh->vertexCount, mesh->indexes, mesh->polyCount*3);
+
+		return true;
+	}
+
+	void Render::DrawMeshData(Texture* texture, const Vertex2* vertices, UInt vertexCount, const UInt16* indexes,
+							  UInt indexCount)
+	{
 		// Check difference
-		if (mLastDrawTexture != mesh->mTexture.mTexture ||
-			mLastDrawVertex + mesh->vertexCount >= mVertexBufferSize ||
-			mLastDrawIdx + mesh->polyCount * 3 >= mIndexBufferSize ||
+		if (mLastDrawTexture != texture ||
+			mLastDrawVertex + vertexCount >= mVertexBufferSize ||
+			mLastDrawIdx + indexCount >= mIndexBufferSize ||
 			mCurrentPrimitiveType == GL_LINES)
 		{
 			DrawPrimitives();
 
-			mLastDrawTexture = mesh->mTexture.mTexture;
+			mLastDrawTexture = texture;
 			mCurrentPrimitiveType = GL_TRIANGLES;
 
 			if (mLastDrawTexture)
@@ -740,19 +942,20 @@ namespace o2
 			}
 		}
 
+		if (mVertexBufferObject && !mStreamingBuffersMapped)
+			MapStreamingBuffers();
+
 		// Copy data
-		memcpy(&mVertexData[mLastDrawVertex*sizeof(Vertex2)], mesh->vertices, sizeof(Vertex2)*mesh->vertexCount);
+		memcpy(&mVertexData[mLastDrawVertex*sizeof(Vertex2)], vertices, sizeof(Vertex2)*vertexCount);
 
-		for (UInt i = mLastDrawIdx, j = 0; j < mesh->polyCount * 3; i++, j++)
+		for (UInt i = mLastDrawIdx, j = 0; j < indexCount; i++, j++)
 		{
-			mVertexIndexData[i] = mLastDrawVertex + mesh->indexes[j];
+			mVertexIndexData[i] = mLastDrawVertex + indexes[j];
 		}
 
-		mTrianglesCount += mesh->polyCount;
-		mLastDrawVertex += mesh->vertexCount;
-		mLastDrawIdx += mesh->polyCount * 3;
-
-		return true;
+		mTrianglesCount += indexCount/3;
+		mLastDrawVertex += vertexCount;
+		mLastDrawIdx += indexCount;
 	}
 
 	bool Render::DrawMeshWire(Mesh* mesh, const Color4& color /*= Color4::White()*/)
@@ -784,6 +987,18 @@ namespace o2
 		if (!mReady)
 			return false;
 
+		if (mCommandsRecording)
+		{
+			mCommandList.AddLines(GetCommandState(nullptr, RenderCommandList::PrimitiveType::Lines), mDrawingDepth,
+								  verticies, count);
+		}
+		else DrawLinesData(verticies, count);
+
+		return true;
+	}
+
+	void Render::DrawLinesData(const Vertex2* verticies, UInt count)
+	{
 		// Check difference
 		if (mCurrentPrimitiveType == GL_TRIANGLES ||
 			mLastDrawVertex + count * 2 >= mVertexBufferSize ||
@@ -796,10 +1011,13 @@ namespace o2
 			glDisable(GL_TEXTURE_2D);
 		}
 
+		if (mVertexBufferObject && !mStreamingBuffersMapped)
+			MapStreamingBuffers();
+
 		// Copy data
 		memcpy(&mVertexData[mLastDrawVertex*sizeof(Vertex2)], verticies, sizeof(Vertex2)*count * 2);
 
-		for (UInt i = mLastDrawIdx, j = 0; j < (UInt)count * 2; i++, j++)
+		for (UInt i = mLastDrawIdx, j = 0; j < count * 2; i++, j++)
 		{
 			mVertexIndexData[i] = mLastDrawVertex + j;
 		}
@@ -807,8 +1025,6 @@ namespace o2
 		mTrianglesCount += count;
 		mLastDrawVertex += count * 2;
 		mLastDrawIdx += count * 2;
-
-		return true;
 	}
 
 	void Render::SetRenderTexture(TextureRef renderTarget)
@@ -833,16 +1049,13 @@ namespace o2
 			return;
 		}
 
-		DrawPrimitives();
+		FlushCommands();
 
 		if (!mStackScissors.IsEmpty())
-		{
 			mScissorInfos.Last().mEndDepth = mDrawingDepth;
-			glDisable(GL_SCISSOR_TEST);
-			GL_CHECK_ERROR(mLog);
-		}
 
 		mStackScissors.Add(ScissorStackItem(RectI(), RectI(), true));
+		UpdateScissorTest();
 
 		glBindFramebufferEXT(GL_FRAMEBUFFER, renderTarget->mFrameBuffer);
 		GL_CHECK_ERROR(mLog);
@@ -857,7 +1070,7 @@ namespace o2
 		if (!mCurrentRenderTarget)
 			return;
 
-		DrawPrimitives();
+		FlushCommands();
 
 		glBindFramebufferEXT(GL_FRAMEBUFFER, 0);
 		GL_CHECK_ERROR(mLog);
@@ -868,18 +1081,7 @@ namespace o2
 
 		DisableScissorTest(true);
 		mStackScissors.PopBack();
-		if (!mStackScissors.IsEmpty())
-		{
-			glEnable(GL_SCISSOR_TEST);
-			GL_CHECK_ERROR(mLog);
-
-			auto clipRect = mStackScissors.Last().mSummaryScissorRect;
-
-			glScissor((int)(clipRect.left + mCurrentResolution.x*0.5f), 
-					  (int)(clipRect.bottom + mCurrentResolution.y*0.5f),
-					  (int)clipRect.Width(), 
-					  (int)clipRect.Height());
-		}
+		UpdateScissorTest();
 	}
 
 	TextureRef Render::GetRenderTexture() const
@@ -908,6 +1110,65 @@ namespace o2
 		return mScissorInfos;
 	}
 
+	void Render::SetCommandsRecording(bool enabled)
+	{
+		if (mCommandsRecording == enabled)
+			return;
+
+		FlushCommands();
+		mCommandsRecording = enabled;
+	}
+
+	bool Render::IsCommandsRecording() const
+	{
+		return mCommandsRecording;
+	}
+
+	const RenderCommandList& Render::GetCommandList() const
+	{
+		return mCommandList;
+	}
+
+	RenderCommandList::State Render::GetCommandState(Texture* texture,
+													 RenderCommandList::PrimitiveType primitiveType) const
+	{
+		bool scissorTest = !mStackScissors.IsEmpty() && !mStackScissors.Last().mRenderTarget;
+		RectI scissorRect = scissorTest ? mStackScissors.Last().mSummaryScissorRect : RectI();
+
+		return RenderCommandList::State(texture, primitiveType, scissorTest, scissorRect);
+	}
+
+	void Render::UpdateScissorTest()
+	{
+		if (mStackScissors.IsEmpty() || mStackScissors.Last().mRenderTarget)
+			SetScissorTest(false, RectI());
+		else
+			SetScissorTest(true, mStackScissors.Last().mSummaryScissorRect);
+	}
+
+	void Render::SetScissorTest(bool enabled, const RectI& rect)
+	{
+		if (mGLScissorTest != enabled)
+		{
+			if (enabled)
+				glEnable(GL_SCISSOR_TEST);
+			else
+				glDisable(GL_SCISSOR_TEST);
+
+			GL_CHECK_ERROR(mLog);
+
+			mGLScissorTest = enabled;
+		}
+
+		if (enabled)
+		{
+			glScissor((int)(rect.left + mCurrentResolution.x*0.5f),
+					  (int)(rect.bottom + mCurrentResolution.y*0.5f),
+					  (int)rect.Width(),
+					  (int)rect.Height());
+		}
+	}
+
 	void Render::InitializeProperties()
 	{
 		INITIALIZE_PROPERTY(Render, camera, SetCamera, GetCamera);
@@ -15,10 +15,18 @@ namespace o2
 		HGLRC        mGLContext;                // OpenGL context
 		HDC          mHDC;                      // Windows frame device context
 
-		UInt8*       mVertexData;               // Vertex data buffer
-		UInt16*      mVertexIndexData;          // Index data buffer
+		UInt8*       mVertexData;               // Vertex data buffer. Points to mapped streaming buffer range when streaming
+		UInt16*      mVertexIndexData;          // Index data buffer. Points to mapped streaming buffer range when streaming
 		UInt         mVertexBufferSize = 6000;  // Maximum size of vertex buffer
 		UInt         mIndexBufferSize = 6000*3; // Maximum size of index buffer
+
+		GLuint       mVertexBufferObject = 0;   // Streaming vertex buffer object, 0 when using client side arrays
+		GLuint       mIndexBufferObject = 0;    // Streaming index buffer object, 0 when using client side arrays
+		UInt         mStreamingBatchesCount = 4;// Count of maximum sized batches in streaming buffers ring
+		UInt         mVertexStreamOffset;       // Current batch offset in streaming vertex buffer in bytes
+		UInt         mIndexStreamOffset;        // Current batch offset in streaming index buffer in bytes
+		bool         mStreamingBuffersMapped;   // Is current batch range of streaming buffers mapped
+		bool         mGLScissorTest;            // Is scissor test enabled in OpenGL state
 		GLenum       mCurrentPrimitiveType;     // Type of drawing primitives for next DIP
 				     
 		Texture*     mLastDrawTexture;          // Stored texture ptr from last DIP
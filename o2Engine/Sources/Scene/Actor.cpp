@@ -1,5 +1,6 @@
 #include "Actor.h"
 
+#include "Scene/DrawableComponent.h"
 #include "Scene/Scene.h"
 #include "Utils/Math/Basis.h"
 #include "Utils/Reflection/Reflection.h"
@@ -21,7 +22,7 @@ namespace o2
 			if (mode == ActorCreateMode::InScene)
 			{
 				o2Scene.mRootActors.Add(this);
-				o2Scene.mAllActors.Add(this);
+				o2Scene.AddActor(this);
 				mIsOnScene = true;
 			}
 
@@ -61,7 +62,7 @@ namespace o2
 		if (Scene::IsSingletonInitialzed())
 		{
 			o2Scene.mRootActors.Add(this);
-			o2Scene.mAllActors.Add(this);
+			o2Scene.AddActor(this);
 			o2Scene.onActorCreated(this);
 		}
 
@@ -102,7 +103,7 @@ namespace o2
 		if (Scene::IsSingletonInitialzed() && mode == ActorCreateMode::InScene)
 		{
 			o2Scene.mRootActors.Add(this);
-			o2Scene.mAllActors.Add(this);
+			o2Scene.AddActor(this);
 			o2Scene.onActorCreated(this);
 		}
 
@@ -130,7 +131,7 @@ namespace o2
 			if (mIsOnScene)
 			{
 				o2Scene.onActorDestroying(this);
-				o2Scene.mAllActors.Remove(this);
+				o2Scene.RemoveActor(this);
 			}
 
 			o2Scene.OnActorPrototypeBreaked(this);
@@ -148,6 +149,12 @@ namespace o2
 
 		if (Scene::IsSingletonInitialzed())
 			o2Scene.mChangedActors.Remove(this);
+
+		if (transform.mIsChangeQueued && Scene::IsSingletonInitialzed())
+			o2Scene.mTransformChangedActors.Remove(this);
+
+		delete mChildsNamesIndex;
+		delete mComponentsByTypes;
 	}
 
 	Actor& Actor::operator=(const Actor& other)
@@ -332,6 +339,7 @@ namespace o2
 	void Actor::SetName(const String& name)
 	{
 		mName = name;
+		InvalidateNameInParent();
 		OnNameChanged();
 	}
 
@@ -347,7 +355,11 @@ namespace o2
 
 	void Actor::SetId(UInt64 id)
 	{
+		UInt64 oldId = mId;
 		mId = id;
+
+		if (mIsOnScene && Scene::IsSingletonInitialzed())
+			o2Scene.OnActorIdChanged(this, oldId);
 	}
 
 	UID Actor::GetAssetId() const
@@ -365,7 +377,7 @@ namespace o2
 
 	void Actor::GenNewId(bool childs /*= true*/)
 	{
-		mId = Math::Random();
+		SetId(Math::Random());
 
 		if (childs)
 		{
@@ -386,7 +398,7 @@ namespace o2
 			return;
 
 		o2Scene.mRootActors.Remove(this);
-		o2Scene.mAllActors.Remove(this);
+		o2Scene.RemoveActor(this);
 		ComponentsExcludeFromScene();
 		mIsOnScene = false;
 
@@ -402,7 +414,7 @@ namespace o2
 		if (!mParent)
 			o2Scene.mRootActors.Add(this);
 
-		o2Scene.mAllActors.Add(this);
+		o2Scene.AddActor(this);
 		mIsOnScene = true;
 		ComponentsIncludeToScene();
 
@@ -488,6 +500,7 @@ namespace o2
 				lastIdx++;
 
 			mParent->mChilds.RemoveAt(lastIdx);
+			mParent->InvalidateChildsNamesIndex();
 			mParent->OnChildsChanged();
 		}
 		else
@@ -521,7 +534,10 @@ namespace o2
 		mParent = actor;
 
 		if (mParent)
+		{
 			mParent->mChilds.Add(this);
+			mParent->InvalidateChildsNamesIndex();
+		}
 		else
 			o2Scene.mRootActors.Add(this);
 
@@ -554,6 +570,7 @@ namespace o2
 
 		mChilds.Add(actor);
 		actor->mParent = this;
+		InvalidateChildsNamesIndex();
 
 		actor->transform.UpdateTransform();
 		actor->UpdateEnabled();
@@ -577,6 +594,7 @@ namespace o2
 
 		mChilds.Insert(actor, index);
 		actor->mParent = this;
+		InvalidateChildsNamesIndex();
 
 		actor->transform.UpdateTransform();
 		actor->UpdateEnabled();
@@ -589,7 +607,7 @@ namespace o2
 	Actor* Actor::GetChild(const String& path) const
 	{
 		int delPos = path.Find("/");
-		WString pathPart = path.SubStr(0, delPos);
+		String pathPart = path.SubStr(0, delPos);
 
 		if (pathPart == "..")
 		{
@@ -604,15 +622,12 @@ namespace o2
 			return nullptr;
 		}
 
-		for (auto child : mChilds)
+		if (Actor* child = FindChildByName(pathPart))
 		{
-			if (child->mName == pathPart)
-			{
-				if (delPos == -1)
-					return child;
-				else
-					return child->GetChild(path.SubStr(delPos + 1));
-			}
+			if (delPos == -1)
+				return child;
+			else
+				return child->GetChild(path.SubStr(delPos + 1));
 		}
 
 		return nullptr;
@@ -632,6 +647,7 @@ namespace o2
 
 		actor->mParent = nullptr;
 		mChilds.Remove(actor);
+		InvalidateChildsNamesIndex();
 
 		if (release)
 		{
@@ -656,6 +672,7 @@ namespace o2
 		}
 
 		mChilds.Clear();
+		InvalidateChildsNamesIndex();
 
 		OnChildsChanged();
 	}
@@ -676,6 +693,7 @@ namespace o2
 	{
 		mComponents.Remove(component);
 		component->mOwner = nullptr;
+		UpdateComponentsByTypes();
 
 		OnChanged();
 
@@ -690,14 +708,20 @@ namespace o2
 			delete comp;
 
 		mComponents.Clear();
+		UpdateComponentsByTypes();
 
 		OnChanged();
 	}
 
 	Component* Actor::GetComponent(const String& typeName)
 	{
+		const Type* type = Reflection::GetType(typeName);
+		if (!type)
+			return nullptr;
+
+		TypeId typeId = type->ID();
 		for (auto comp : mComponents)
-			if (comp->GetType().GetName() == typeName)
+			if (comp->GetType().ID() == typeId)
 				return comp;
 
 		return nullptr;
@@ -705,11 +729,7 @@ namespace o2
 
 	Component* Actor::GetComponent(const Type* type)
 	{
-		for (auto comp : mComponents)
-			if (comp->GetType().IsBasedOn(*type))
-				return comp;
-
-		return nullptr;
+		return FindComponentByTypeId(type->ID());
 	}
 
 	Component* Actor::GetComponent(UInt64 id)
@@ -815,10 +835,18 @@ namespace o2
 	void Actor::OnTransformChanged()
 	{
 		for (auto comp : mComponents)
+		{
 			comp->OnTransformChanged();
 
+			if (mLayer)
+			{
+				if (auto drawable = dynamic_cast<DrawableComponent*>(comp))
+					mLayer->ComponentBoundsChanged(drawable);
+			}
+		}
+
 		for (auto child : mChilds)
-			child->transform.UpdateTransform();
+			child->transform.UpdateChanges();
 
 		OnChanged();
 	}
@@ -936,8 +964,9 @@ namespace o2
 		if (ActorDataNodeConverter::Instance().mLockDepth == 0)
 			ActorDataNodeConverter::Instance().ActorCreated(this);
 
-		mId = *node.GetNode("Id");
+		SetId(*node.GetNode("Id"));
 		mName = *node.GetNode("Name");
+		InvalidateNameInParent();
 		mLocked = *node.GetNode("Locked");
 		mEnabled = *node.GetNode("Enabled");
 
@@ -968,6 +997,8 @@ namespace o2
 				child->mParent = this;
 				mChilds.Add(child);
 			}
+
+			InvalidateChildsNamesIndex();
 		}
 
 		ActorDataNodeConverter::Instance().UnlockPointersResolving();
@@ -1085,7 +1116,7 @@ namespace o2
 			}
 		}
 
-		mId = *node.GetNode("Id");
+		SetId(*node.GetNode("Id"));
 
 		if (!mPrototypeLink)
 			return;
@@ -1097,6 +1128,8 @@ namespace o2
 		else
 			mName = proto->mName;
 
+		InvalidateNameInParent();
+
 		if (auto subNode = node.GetNode("Enabled"))
 			mEnabled = *subNode;
 		else
@@ -1154,6 +1187,7 @@ namespace o2
 				Actor* child = mnew Actor(mIsOnScene ? ActorCreateMode::InScene : ActorCreateMode::NotInScene);
 				mChilds.Add(child);
 				child->mParent = this;
+				InvalidateChildsNamesIndex();
 
 				child->Deserialize(*childNode);
 			}
@@ -1169,6 +1203,7 @@ namespace o2
 
 				mComponents.Add(newComponent);
 				newComponent->mOwner = this;
+				UpdateComponentsByTypes();
 
 				if (newComponent)
 				{
@@ -1320,6 +1355,7 @@ namespace o2
 		}
 
 		mChilds.Clear();
+		InvalidateChildsNamesIndex();
 	}
 
 	void Actor::GetAllChildrenActors(Vector<Actor*>& actors)
@@ -1330,6 +1366,109 @@ namespace o2
 			child->GetAllChildrenActors(actors);
 	}
 
+	void Actor::UpdateSeparated(float dt, ComponentsVec& threadSafeComponents)
+	{
+		Animatable::Update(dt);
+
+		for (auto comp : mComponents)
+		{
+			if (comp->IsUpdateThreadSafe())
+				threadSafeComponents.Add(comp);
+			else
+				comp->Update(dt);
+		}
+	}
+
+	void Actor::UpdateChildsSeparated(float dt, ComponentsVec& threadSafeComponents)
+	{
+		for (auto child : mChilds)
+			child->UpdateSeparated(dt, threadSafeComponents);
+
+		for (auto child : mChilds)
+			child->UpdateChildsSeparated(dt, threadSafeComponents);
+	}
+
+	Actor* Actor::FindChildByName(const String& name) const
+	{
+		if (mChilds.Count() < mMinNamesIndexChildsCount)
+			return mChilds.FindMatch([&](Actor* x) { return x->mName == name; });
+
+		if (mChildsNamesIndexDirty)
+		{
+			Actor* thisActor = const_cast<Actor*>(this);
+			if (!mChildsNamesIndex)
+				thisActor->mChildsNamesIndex = mnew ActorsNamesDict();
+			else
+				mChildsNamesIndex->Clear();
+
+			// Only first child with name is indexed, same as linear search
+			for (auto child : mChilds)
+			{
+				if (!mChildsNamesIndex->ContainsKey(child->mName))
+					mChildsNamesIndex->Add(child->mName, child);
+			}
+
+			thisActor->mChildsNamesIndexDirty = false;
+		}
+
+		if (Actor** child = mChildsNamesIndex->TryGet(name))
+			return *child;
+
+		return nullptr;
+	}
+
+	void Actor::InvalidateChildsNamesIndex()
+	{
+		mChildsNamesIndexDirty = true;
+	}
+
+	void Actor::InvalidateNameInParent()
+	{
+		if (mParent)
+			mParent->mChildsNamesIndexDirty = true;
+	}
+
+	void Actor::UpdateComponentsByTypes()
+	{
+		if (mComponents.IsEmpty())
+		{
+			if (mComponentsByTypes)
+				mComponentsByTypes->Clear();
+
+			return;
+		}
+
+		if (!mComponentsByTypes)
+			mComponentsByTypes = mnew CompsTypesDict();
+		else
+			mComponentsByTypes->Clear();
+
+		// Dictionary is filled here, not at search, so searching doesn't change it and can be done from workers
+		for (auto comp : mComponents)
+		{
+			const Type& type = comp->GetType();
+			if (type.GetAllBaseTypesIds().IsEmpty() && !mComponentsByTypes->ContainsKey(type.ID()))
+				mComponentsByTypes->Add(type.ID(), comp);
+
+			for (auto typeId : type.GetAllBaseTypesIds())
+			{
+				if (!mComponentsByTypes->ContainsKey(typeId))
+					mComponentsByTypes->Add(typeId, comp);
+			}
+		}
+	}
+
+	Component* Actor::FindComponentByTypeId(TypeId id) const
+	{
+		if (!mComponentsByTypes)
+			return nullptr;
+
+		if (Component* const* comp = mComponentsByTypes->TryGet(id))
+			return *comp;
+
+		return nullptr;
+	}
+
 	void Actor::ApplyChangesToPrototype()
 	{
 		if (!mPrototype)
@@ -1426,6 +1565,7 @@ namespace o2
 				}
 
 				protoChild->mName = child->mName;
+				protoChild->InvalidateNameInParent();
 				protoChild->mEnabled = child->mEnabled;
 				protoChild->transform = child->transform;
 				protoChild->mAssetId = child->mAssetId;
@@ -1530,6 +1670,7 @@ namespace o2
 			newProtoChild->mEnabled  = child->mEnabled;
 			newProtoChild->transform = child->transform;
 			newProtoChild->mAssetId  = child->mAssetId;
+			newProtoChild->InvalidateNameInParent();
 			newProtoChild->SetLayer(child->mLayer);
 
 			if (child->mPrototype)
@@ -1572,6 +1713,7 @@ namespace o2
 				newChild->mEnabled  = child->mEnabled;
 				newChild->transform = child->transform;
 				newChild->mAssetId  = child->mAssetId;
+				newChild->InvalidateNameInParent();
 				newChild->SetLayer(child->mLayer);
 
 				if (child->mPrototype)
@@ -1625,6 +1767,7 @@ namespace o2
 		dest->Animatable::operator=(*source);
 
 		dest->mName = source->mName;
+		dest->InvalidateNameInParent();
 		dest->mEnabled = source->mEnabled;
 		dest->transform = source->transform;
 		dest->mAssetId = source->mAssetId;
@@ -1688,6 +1831,7 @@ namespace o2
 		dest->Animatable::operator=(*source);
 
 		dest->mName = source->mName;
+		dest->InvalidateNameInParent();
 		dest->mEnabled = source->mEnabled;
 		dest->transform = source->transform;
 		dest->mAssetId = source->mAssetId;
@@ -1732,6 +1876,7 @@ namespace o2
 		dest->Animatable::operator=(*source);
 
 		dest->mName = source->mName;
+		dest->InvalidateNameInParent();
 		dest->mEnabled = source->mEnabled;
 		dest->transform = source->transform;
 		dest->mAssetId = source->mAssetId;
@@ -1764,6 +1909,8 @@ namespace o2
 			else ++it;
 		}
 
+		dest->UpdateComponentsByTypes();
+
 		for (auto component : source->mComponents)
 		{
 			Component* matchingComponent = dest->mComponents.FindMatch([&](Component* x) { return x->GetPrototypeLink() == component; });
@@ -1922,7 +2069,10 @@ namespace o2
 		}
 
 		if (source->mName != changed->mName && dest->mName == source->mName)
+		{
 			dest->mName = changed->mName;
+			dest->InvalidateNameInParent();
+		}
 
 		if (source->mEnabled != changed->mEnabled && dest->mEnabled == source->mEnabled)
 			dest->mEnabled = changed->mEnabled;
@@ -2145,9 +2295,22 @@ namespace o2
 		if (mLockDepth > 0)
 			return;
 
+		// New actors are indexed once, so resolving doesn't depend on new actors count
+		HashDictionary<UInt64, Actor*> newActorsByIds;
+		if (!mUnresolvedActors.IsEmpty())
+		{
+			newActorsByIds.Reserve(mNewActors.Count());
+			for (auto actor : mNewActors)
+			{
+				if (!newActorsByIds.ContainsKey(actor->mId))
+					newActorsByIds.Add(actor->mId, actor);
+			}
+		}
+
 		for (auto def : mUnresolvedActors)
 		{
-			*def.target = mNewActors.FindMatch([&](Actor* x) { return x->GetID() == def.actorId; });
+			Actor** newActor = newActorsByIds.TryGet(def.actorId);
+			*def.target = newActor ? *newActor : nullptr;
 
 			if (!*def.target)
 			{
@@ -2417,6 +2580,13 @@ CLASS_META(o2::Actor)
 	PROTECTED_FUNCTION(void, OnParentChanged, Actor*);
 	PROTECTED_FUNCTION(void, SeparateActors, Vector<Actor*>&);
 	PROTECTED_FUNCTION(void, GetAllChildrenActors, Vector<Actor*>&);
+	PROTECTED_FUNCTION(void, UpdateSeparated, float, ComponentsVec&);
+	PROTECTED_FUNCTION(void, UpdateChildsSeparated, float, ComponentsVec&);
+	PROTECTED_FUNCTION(Actor*, FindChildByName, const String&);
+	PROTECTED_FUNCTION(void, InvalidateChildsNamesIndex);
+	PROTECTED_FUNCTION(void, InvalidateNameInParent);
+	PROTECTED_FUNCTION(void, UpdateComponentsByTypes);
+	PROTECTED_FUNCTION(Component*, FindComponentByTypeId, TypeId);
 	PROTECTED_FUNCTION(void, InitializeProperties);
 	PROTECTED_FUNCTION(void, ProcessCopying, Actor*, const Actor*, Vector<Actor**>&, Vector<Component**>&, _tmp3, _tmp4, bool);
 	PROTECTED_FUNCTION(void, ProcessPrototypeMaking, Actor*, Actor*, Vector<Actor**>&, Vector<Component**>&, _tmp5, _tmp6, bool);
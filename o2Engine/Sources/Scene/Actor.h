@@ -6,6 +6,7 @@
 #include "Scene/Component.h"
 #include "Scene/Scene.h"
 #include "Scene/Tags.h"
+#include "Utils/Containers/HashDictionary.h"
 #include "Utils/Containers/Vector.h"
 #include "Utils/Singleton.h"
 #include "Utils/String.h"
@@ -306,11 +307,23 @@ namespace o2
 
 		// Return all components by type
 		template<typename _type>
-		Vector<_type>* GetComponents() const;
+		Vector<_type*> GetComponents() const;
 
 		// Returns all components by type in this and children
 		template<typename _type>
-		Vector<_type>* GetComponentsInChildren() const;
+		Vector<_type*> GetComponentsInChildren() const;
+
+		// Adds all components by type in this and children into result
+		template<typename _type>
+		void GetComponentsInChildren(Vector<_type*>& result) const;
+
+		// Calls func for all components by type in this and children, without copying arrays
+		template<typename _type, typename _func_type>
+		void ForEachComponentInChildren(const _func_type& func) const;
+
+		// Calls func for all children, without copying children array
+		template<typename _func_type>
+		void ForEachChild(const _func_type& func) const;
 
 		// Returns all components
 		ComponentsVec GetComponents() const;
@@ -340,30 +353,38 @@ namespace o2
 
 	protected:
 		typedef Vector<ActorRef*> ActorRefsVec;
+		typedef HashDictionary<String, Actor*> ActorsNamesDict;
+		typedef HashDictionary<TypeId, Component*> CompsTypesDict;
+
+		static const int mMinNamesIndexChildsCount = 16; // Minimal count of children, when search by name uses index
 
-		ActorAssetRef mPrototype;               // Prototype asset
-		ActorRef      mPrototypeLink = nullptr; // Prototype link actor. Links to source actor from prototype
+		ActorAssetRef    mPrototype;                    // Prototype asset
+		ActorRef         mPrototypeLink = nullptr;      // Prototype link actor. Links to source actor from prototype
 
-		UInt64        mId;                      // Unique actor id
-		String        mName;                    // Name of actor
+		UInt64           mId;                           // Unique actor id
+		String           mName;                         // Name of actor
 
-		Actor*        mParent = nullptr;        // Parent actor
-		ActorsVec     mChilds;                  // Children actors 
-		ComponentsVec mComponents;              // Components vector 
-		Scene::Layer* mLayer = nullptr;         // Scene layer
+		Actor*           mParent = nullptr;             // Parent actor
+		ActorsVec        mChilds;                       // Children actors 
+		ComponentsVec    mComponents;                   // Components vector 
+		CompsTypesDict*  mComponentsByTypes = nullptr;  // First components by their types and base types ids
+		Scene::Layer*    mLayer = nullptr;              // Scene layer
 
-		bool          mEnabled = true;          // Is actor enabled
-		bool          mResEnabled = true;       // Is actor enabled in hierarchy
+		ActorsNamesDict* mChildsNamesIndex = nullptr;   // First children by names. Built at search by name
+		bool             mChildsNamesIndexDirty = true; // Is children names index outdated
 
-		bool          mLocked = false;          // Is actor locked
-		bool          mResLocked = false;       // Is actor locked in hierarchy
+		bool             mEnabled = true;               // Is actor enabled
+		bool             mResEnabled = true;            // Is actor enabled in hierarchy
 
-		bool          mIsOnScene = true;        // Is actor on scene
+		bool             mLocked = false;               // Is actor locked
+		bool             mResLocked = false;            // Is actor locked in hierarchy
 
-		bool          mIsAsset = false;         // Is this actor cached asset
-		UID           mAssetId;                 // Source asset id
+		bool             mIsOnScene = true;             // Is actor on scene
 
-		ActorRefsVec  mReferences;              // References to this actor
+		bool             mIsAsset = false;              // Is this actor cached asset
+		UID              mAssetId;                      // Source asset id
+
+		ActorRefsVec     mReferences;                   // References to this actor
 
 	protected:
 		// Not using prototype setter
@@ -423,6 +444,27 @@ namespace o2
 		// Returns all children actors with their children
 		void GetAllChildrenActors(Vector<Actor*>& actors);
 
+		// Updates actor and not thread safe components. Thread safe components are added into threadSafeComponents
+		void UpdateSeparated(float dt, ComponentsVec& threadSafeComponents);
+
+		// Updates childs and not thread safe components. Thread safe components are added into threadSafeComponents
+		void UpdateChildsSeparated(float dt, ComponentsVec& threadSafeComponents);
+
+		// Returns first child with name. Uses children names index when there are many children
+		Actor* FindChildByName(const String& name) const;
+
+		// Marks children names index as outdated, it will be rebuilt at next search by name
+		void InvalidateChildsNamesIndex();
+
+		// Marks parent's children names index as outdated. It is called when name changed
+		void InvalidateNameInParent();
+
+		// Rebuilds components by types dictionary. It is called when components list changed
+		void UpdateComponentsByTypes();
+
+		// Returns first component, which type is based on type with id
+		Component* FindComponentByTypeId(TypeId id) const;
+
 		// Initializes properties
 		void InitializeProperties();
 
@@ -569,20 +611,45 @@ namespace o2
 	};
 
 	template<typename _type>
-	Vector<_type>* Actor::GetComponentsInChildren() const
+	Vector<_type*> Actor::GetComponentsInChildren() const
 	{
-		Vector < _type >> res = GetComponents < _type*();
+		Vector<_type*> res;
+		GetComponentsInChildren<_type>(res);
+
+		return res;
+	}
+
+	template<typename _type>
+	void Actor::GetComponentsInChildren(Vector<_type*>& result) const
+	{
+		ForEachComponentInChildren<_type>([&](_type* comp) { result.Add(comp); });
+	}
+
+	template<typename _type, typename _func_type>
+	void Actor::ForEachComponentInChildren(const _func_type& func) const
+	{
+		const Type& type = TypeOf(_type);
+		for (auto comp : mComponents)
+		{
+			if (comp->GetType().IsBasedOn(type))
+				func(dynamic_cast<_type*>(comp));
+		}
 
 		for (auto child : mChilds)
-			res.Add(child->GetComponentsInChildren<_type>());
+			child->ForEachComponentInChildren<_type>(func);
+	}
 
-		return res;
+	template<typename _func_type>
+	void Actor::ForEachChild(const _func_type& func) const
+	{
+		for (auto child : mChilds)
+			func(child);
 	}
 
 	template<typename _type>
 	_type* Actor::GetComponentInChildren() const
 	{
-		_type > res = GetComponent < _type*();
+		_type* res = GetComponent<_type>();
 
 		if (res)
 			return res;
@@ -600,23 +667,18 @@ namespace o2
 	template<typename _type>
 	_type* Actor::GetComponent() const
 	{
-		for (auto comp : mComponents)
-		{
-			if (comp->GetType().IsBasedOn(TypeOf(_type)))
-				return dynamic_cast<_type*>(comp);
-		}
-
-		return nullptr;
+		return dynamic_cast<_type*>(FindComponentByTypeId(TypeOf(_type).ID()));
 	}
 
 	template<typename _type>
-	Vector<_type>* Actor::GetComponents() const
+	Vector<_type*> Actor::GetComponents() const
 	{
-		Vector<_type>* res;
+		const Type& type = TypeOf(_type);
+		Vector<_type*> res;
 		for (auto comp : mComponents)
 		{
-			if (comp->GetType().IsBasedOn(TypeOf(_type)))
-				res.Add(comp);
+			if (comp->GetType().IsBasedOn(type))
+				res.Add(dynamic_cast<_type*>(comp));
 		}
 
 		return res;
@@ -1,19 +1,22 @@
 #include "ActorTransform.h"
 
 #include "Actor.h"
+#include "Scene/Scene.h"
 
 namespace o2
 {
 	ActorTransform::ActorTransform(const Vec2F& size /*= Vec2F()*/, const Vec2F& position /*= Vec2F()*/,
 								   float angle /*= 0.0f*/, const Vec2F& scale /*= Vec2F(1.0f, 1.0f)*/,
 								   const Vec2F& pivot /*= Vec2F(0.5f, 0.5f)*/):
-		Transform(size, position, angle, scale, pivot), mOwner(nullptr)
+		Transform(size, position, angle, scale, pivot), mIsParentInvTransformActual(false), mIsWorldTransformDirty(true),
+		mIsChanged(false), mIsChangeQueued(false), mOwner(nullptr)
 	{
 		InitializeProperties();
 	}
 
 	ActorTransform::ActorTransform(const ActorTransform& other):
-		Transform(other), mOwner(nullptr)
+		Transform(other), mIsParentInvTransformActual(false), mIsWorldTransformDirty(true), mIsChanged(false),
+		mIsChangeQueued(false), mOwner(nullptr)
 	{
 		InitializeProperties();
 	}
@@ -43,6 +46,8 @@ namespace o2
 
 	void ActorTransform::SetWorldPivot(const Vec2F& pivot)
 	{
+		CheckWorldTransform();
+
 		Basis trasform = mWorldTransform;
 		SetSizePivot(World2LocalPoint(pivot));
 		SetWorldBasis(trasform);
@@ -61,6 +66,7 @@ namespace o2
 
 	Vec2F ActorTransform::GetWorldPosition() const
 	{
+		CheckWorldTransform();
 		return mPosition*mParentTransform;
 	}
 
@@ -72,6 +78,8 @@ namespace o2
 
 	RectF ActorTransform::GetWorldRect() const
 	{
+		CheckWorldTransform();
+
 		RectF localRect = GetRect();
 		RectF worldRect(localRect.LeftBottom()*mParentTransform, localRect.RightTop()*mParentTransform);
 		return worldRect;
@@ -79,11 +87,13 @@ namespace o2
 
 	void ActorTransform::SetWorldAngle(float rad)
 	{
+		CheckWorldTransform();
 		SetAngle(rad - mParentTransform.GetAngle());
 	}
 
 	float ActorTransform::GetWorldAngle() const
 	{
+		CheckWorldTransform();
 		return mWorldTransform.GetAngle();
 	}
 
@@ -95,6 +105,7 @@ namespace o2
 
 	Basis ActorTransform::GetWorldBasis() const
 	{
+		CheckWorldTransform();
 		return mWorldTransform;
 	}
 
@@ -106,6 +117,7 @@ namespace o2
 
 	Basis ActorTransform::GetWorldNonSizedBasis() const
 	{
+		CheckWorldTransform();
 		return mWorldNonSizedTransform;
 	}
 
@@ -117,6 +129,8 @@ namespace o2
 
 	RectF ActorTransform::GetWorldAxisAlignedRect() const
 	{
+		CheckWorldTransform();
+
 		RectF localAARect = GetRect();
 		RectF worldAARect(localAARect.LeftBottom()*mParentTransform, localAARect.RightTop()*mParentTransform);
 		return worldAARect;
@@ -124,6 +138,8 @@ namespace o2
 
 	void ActorTransform::SetWorldLeftTop(const Vec2F& position)
 	{
+		CheckWorldTransform();
+
 		Basis transformed = mWorldTransform;
 		Vec2F lastHandleCoords = Vec2F(0.0f, 1.0f)*mWorldTransform;
 		Vec2F delta = position - lastHandleCoords;
@@ -139,11 +155,14 @@ namespace o2
 
 	Vec2F ActorTransform::GetWorldLeftTop() const
 	{
+		CheckWorldTransform();
 		return mWorldTransform.offs + mWorldTransform.yv;
 	}
 
 	void ActorTransform::SetWorldRightTop(const Vec2F& position)
 	{
+		CheckWorldTransform();
+
 		Basis transformed = mWorldTransform;
 		Vec2F lastHandleCoords = Vec2F(1.0f, 1.0f)*mWorldTransform;
 		Vec2F delta = position - lastHandleCoords;
@@ -158,11 +177,14 @@ namespace o2
 
 	Vec2F ActorTransform::GetWorldRightTop() const
 	{
+		CheckWorldTransform();
 		return mWorldTransform.offs + mWorldTransform.yv + mWorldTransform.xv;
 	}
 
 	void ActorTransform::SetWorldLeftBottom(const Vec2F& position)
 	{
+		CheckWorldTransform();
+
 		Basis transformed = mWorldTransform;
 		Vec2F lastHandleCoords = Vec2F(0.0f, 0.0f)*mWorldTransform;
 		Vec2F delta = position - lastHandleCoords;
@@ -178,11 +200,14 @@ namespace o2
 
 	Vec2F ActorTransform::GetWorldLeftBottom() const
 	{
+		CheckWorldTransform();
 		return mWorldTransform.offs;
 	}
 
 	void ActorTransform::SetWorldRightBottom(const Vec2F& position)
 	{
+		CheckWorldTransform();
+
 		Basis transformed = mWorldTransform;
 		Vec2F lastHandleCoords = Vec2F(1.0f, 0.0f)*mWorldTransform;
 		Vec2F delta = position - lastHandleCoords;
@@ -198,61 +223,77 @@ namespace o2
 
 	Vec2F ActorTransform::GetWorldRightBottom() const
 	{
+		CheckWorldTransform();
 		return mWorldTransform.offs + mWorldTransform.xv;
 	}
 
 	void ActorTransform::SetWorldCenter(const Vec2F& position)
 	{
+		CheckWorldTransform();
+
 		Vec2F translate = position - GetWorldCenter();
 		SetWorldBasis(mWorldTransform*Basis::Translated(translate));
 	}
 
 	Vec2F ActorTransform::GetWorldCenter() const
 	{
+		CheckWorldTransform();
 		return mWorldTransform.offs + (mWorldTransform.xv + mWorldTransform.yv)*0.5f;
 	}
 
 	void ActorTransform::SetRight(const Vec2F& dir)
 	{
+		CheckWorldTransform();
+
 		Basis transf = Basis::Rotated(GetRight().SignedAngle(dir));
 		SetWorldBasis(mWorldTransform*transf);
 	}
 
 	Vec2F ActorTransform::GetRight() const
 	{
+		CheckWorldTransform();
 		return mWorldNonSizedTransform.xv;
 	}
 
 	void ActorTransform::SetLeft(const Vec2F& dir)
 	{
+		CheckWorldTransform();
+
 		Basis transf = Basis::Rotated(GetLeft().SignedAngle(dir));
 		SetWorldBasis(mWorldTransform*transf);
 	}
 
 	Vec2F ActorTransform::GetLeft() const
 	{
+		CheckWorldTransform();
 		return mWorldNonSizedTransform.xv.Inverted();
 	}
 
 	void ActorTransform::SetUp(const Vec2F& dir)
 	{
+		CheckWorldTransform();
+
 		Basis transf = Basis::Rotated(GetUp().SignedAngle(dir));
 		SetWorldBasis(mWorldTransform*transf);
 	}
 
 	Vec2F ActorTransform::GetUp() const
 	{
+		CheckWorldTransform();
 		return mWorldNonSizedTransform.yv;
 	}
 
 	void ActorTransform::SetDown(const Vec2F& dir)
 	{
+		CheckWorldTransform();
+
 		Basis transf = Basis::Rotated(GetDown().SignedAngle(dir));
 		SetWorldBasis(mWorldTransform*transf);
 	}
 
 	Vec2F ActorTransform::GetDown() const
 	{
+		CheckWorldTransform();
 		return mWorldNonSizedTransform.yv.Inverted();
 	}
 
@@ -263,6 +304,8 @@ namespace o2
 
 	Vec2F ActorTransform::World2LocalPoint(const Vec2F& worldPoint) const
 	{
+		CheckWorldTransform();
+
 		Vec2F nx = mWorldTransform.xv, ny = mWorldTransform.yv, offs = mWorldTransform.offs, w = worldPoint;
 		float lx = (w.x*ny.y - offs.x*ny.y - w.y*ny.x + offs.y*ny.x) / (nx.x*ny.y - ny.x*nx.y);
 		float ly = (w.y - offs.y - nx.y*lx) / ny.y;
@@ -271,11 +314,14 @@ namespace o2
 
 	Vec2F ActorTransform::Local2WorldPoint(const Vec2F& localPoint) const
 	{
+		CheckWorldTransform();
 		return mWorldTransform*(localPoint / mSize);
 	}
 
 	Vec2F ActorTransform::World2LocalDir(const Vec2F& worldDir) const
 	{
+		CheckWorldTransform();
+
 		Vec2F nx = mWorldTransform.xv / (mSize.x*mScale.x), ny = mWorldTransform.yv / (mSize.y*mScale.y), wd = worldDir;
 		float ldy = (wd.x*nx.y - wd.y*nx.x) / (nx.y*ny.x - ny.y*nx.x);
 		float ldx = (wd.x - ny.x*ldy) / nx.x;
@@ -284,12 +330,16 @@ namespace o2
 
 	Vec2F ActorTransform::Local2WorldDir(const Vec2F& localDir) const
 	{
+		CheckWorldTransform();
+
 		Vec2F nx = mWorldTransform.xv / (mSize.x*mScale.x), ny = mWorldTransform.yv / (mSize.y*mScale.y);
 		return nx*localDir.x + ny*localDir.y;
 	}
 
 	bool ActorTransform::IsPointInside(const Vec2F& point) const
 	{
+		CheckWorldTransform();
+
 		Vec2F rs = mScale*mSize;
 		Vec2F nx = mWorldTransform.xv / rs.x, ny = mWorldTransform.yv / rs.y;
 		Vec2F lp = point - mWorldTransform.offs;
@@ -310,19 +360,66 @@ namespace o2
 	{
 		Transform::UpdateTransform();
 
+		InvalidateWorldTransform();
+
+		if (mOwner && !mIsChangeQueued && Scene::IsSingletonInitialzed())
+		{
+			mIsChangeQueued = true;
+			o2Scene.mTransformChangedActors.Add(mOwner);
+		}
+	}
+
+	void ActorTransform::InvalidateWorldTransform()
+	{
+		mIsWorldTransformDirty = true;
+		mIsChanged = true;
+
+		// Children of dirty transform are already dirty
+		if (mOwner)
+		{
+			for (auto child : mOwner->mChilds)
+			{
+				if (!child->transform.mIsWorldTransformDirty)
+					child->transform.InvalidateWorldTransform();
+			}
+		}
+	}
+
+	void ActorTransform::CheckWorldTransform() const
+	{
+		if (mIsWorldTransformDirty)
+			const_cast<ActorTransform*>(this)->RecalculateWorldTransform();
+	}
+
+	void ActorTransform::RecalculateWorldTransform()
+	{
 		if (mOwner && mOwner->mParent)
 		{
-			mParentTransform = mOwner->mParent->transform.mWorldNonSizedTransform;
+			ActorTransform& parentTransform = mOwner->mParent->transform;
+			parentTransform.CheckWorldTransform();
+
+			mParentTransform = parentTransform.mWorldNonSizedTransform;
 			mWorldTransform = mTransform*mParentTransform;
 			mWorldNonSizedTransform = mNonSizedTransform*mParentTransform;
 		}
 		else
 		{
+			mParentTransform = Basis::Identity();
 			mWorldNonSizedTransform = mNonSizedTransform;
 			mWorldTransform = mTransform;
 		}
 
 		mIsParentInvTransformActual = false;
+		mIsWorldTransformDirty = false;
+	}
+
+	void ActorTransform::UpdateChanges()
+	{
+		if (!mIsChanged)
+			return;
+
+		CheckWorldTransform();
+		mIsChanged = false;
 
 		if (mOwner)
 			mOwner->OnTransformChanged();
@@ -330,6 +427,8 @@ namespace o2
 
 	void ActorTransform::CheckParentInvTransform()
 	{
+		CheckWorldTransform();
+
 		if (mIsParentInvTransformActual)
 			return;
 
@@ -370,6 +469,9 @@ CLASS_META(o2::ActorTransform)
 	PROTECTED_FIELD(mParentInvertedTransform);
 	PROTECTED_FIELD(mParentTransform);
 	PROTECTED_FIELD(mIsParentInvTransformActual);
+	PROTECTED_FIELD(mIsWorldTransformDirty);
+	PROTECTED_FIELD(mIsChanged);
+	PROTECTED_FIELD(mIsChangeQueued);
 	PROTECTED_FIELD(mOwner);
 
 	PUBLIC_FUNCTION(Actor*, GetOwnerActor);
@@ -413,6 +515,10 @@ CLASS_META(o2::ActorTransform)
 	PUBLIC_FUNCTION(bool, IsPointInside, const Vec2F&);
 	PROTECTED_FUNCTION(void, SetOwner, Actor*);
 	PROTECTED_FUNCTION(void, UpdateTransform);
+	PROTECTED_FUNCTION(void, InvalidateWorldTransform);
+	PROTECTED_FUNCTION(void, CheckWorldTransform);
+	PROTECTED_FUNCTION(void, RecalculateWorldTransform);
+	PROTECTED_FUNCTION(void, UpdateChanges);
 	PROTECTED_FUNCTION(void, CheckParentInvTransform);
 	PROTECTED_FUNCTION(void, InitializeProperties);
 }
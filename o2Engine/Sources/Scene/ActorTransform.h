@@ -160,15 +160,31 @@ namespace o2
 		Basis  mParentInvertedTransform;    // Parent world transform inverted
 		Basis  mParentTransform;            // Parent world transform
 		bool   mIsParentInvTransformActual; // Is mParentInvertedTransform is actual
+		bool   mIsWorldTransformDirty;      // Is world transforms must be recalculated before using
+		bool   mIsChanged;                  // Is transform changed and owner actor isn't notified yet
+		bool   mIsChangeQueued;             // Is owner actor in scene's transform changed actors list
 		Actor* mOwner;                      // Owner actor
 
 	protected:
 		// Sets owner and updates transform
 		void SetOwner(Actor* actor);
 
-		// Updates mTransform 
+		// Updates mTransform and marks world transforms of this and children as dirty. World transforms are 
+		// recalculated on demand, owner actor is notified by scene's transforms update
 		void UpdateTransform();
 
+		// Marks world transforms of this and children as dirty and changed
+		void InvalidateWorldTransform();
+
+		// Recalculates world transforms if they are dirty
+		void CheckWorldTransform() const;
+
+		// Recalculates world transforms by parent
+		void RecalculateWorldTransform();
+
+		// Recalculates world transform if changed and notifies owner actor. Owner notifies changed children
+		void UpdateChanges();
+
 		// Check mParentInvertedTransform for actual
 		void CheckParentInvTransform();
 
@@ -176,5 +192,6 @@ namespace o2
 		void InitializeProperties();
 
 		friend class Actor;
+		friend class Scene;
 	};
 }
@@ -41,6 +41,11 @@ namespace o2
 	void Component::Update(float dt)
 	{}
 
+	bool Component::IsUpdateThreadSafe() const
+	{
+		return false;
+	}
+
 	void Component::SetEnabled(bool active)
 	{
 		if (mEnabled == active)
@@ -124,6 +129,7 @@ namespace o2
 		{
 			mOwner->OnChanged();
 			mOwner->mComponents.Remove(this);
+			mOwner->UpdateComponentsByTypes();
 		}
 
 		mOwner = actor;
@@ -131,6 +137,7 @@ namespace o2
 		if (mOwner)
 		{
 			mOwner->mComponents.Add(this);
+			mOwner->UpdateComponentsByTypes();
 			OnTransformChanged();
 			mOwner->OnChanged();
 		}
@@ -224,6 +231,7 @@ CLASS_META(o2::Component)
 
 	PUBLIC_FUNCTION(UInt64, GetID);
 	PUBLIC_FUNCTION(void, Update, float);
+	PUBLIC_FUNCTION(bool, IsUpdateThreadSafe);
 	PUBLIC_FUNCTION(void, SetEnabled, bool);
 	PUBLIC_FUNCTION(void, Enable);
 	PUBLIC_FUNCTION(void, Disable);
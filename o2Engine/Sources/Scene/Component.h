@@ -35,6 +35,9 @@ namespace o2
 		// Updates component
 		virtual void Update(float dt);
 
+		// Returns true when component's update changes only it's own state and can be called from worker thread
+		virtual bool IsUpdateThreadSafe() const;
+
 		// Sets component enable
 		virtual void SetEnabled(bool active);
 
@@ -69,11 +72,11 @@ namespace o2
 
 		// Returns components with type
 		template<typename _type>
-		Vector<_type>* GetComponents() const;
+		Vector<_type*> GetComponents() const;
 
 		// Returns components with type in children
 		template<typename _type>
-		Vector<_type>* GetComponentsInChildren() const;
+		Vector<_type*> GetComponentsInChildren() const;
 
 		// Returns name of component
 		virtual String GetName() const;
@@ -129,28 +132,28 @@ namespace o2
 	};
 
 	template<typename _type>
-	Vector<_type>* Component::GetComponentsInChildren() const
+	Vector<_type*> Component::GetComponentsInChildren() const
 	{
 		if (mOwner)
-			return mOwner->GetComponentsInChildren();
+			return mOwner->GetComponentsInChildren<_type>();
 
-		return Vector<_type>*();
+		return Vector<_type*>();
 	}
 
 	template<typename _type>
-	Vector<_type>* Component::GetComponents() const
+	Vector<_type*> Component::GetComponents() const
 	{
 		if (mOwner)
-			return mOwner->GetComponents();
+			return mOwner->GetComponents<_type>();
 
-		return Vector<_type>*();
+		return Vector<_type*>();
 	}
 
 	template<typename _type>
 	_type* Component::GetComponentInChildren() const
 	{
 		if (mOwner)
-			return mOwner->GetComponentInChildren();
+			return mOwner->GetComponentInChildren<_type>();
 
 		return nullptr;
 	}
@@ -159,7 +162,7 @@ namespace o2
 	_type* Component::GetComponent() const
 	{
 		if (mOwner)
-			return mOwner->GetComponent();
+			return mOwner->GetComponent<_type>();
 
 		return nullptr;
 	}
@@ -33,11 +33,21 @@ namespace o2
 		mEmitter.Update(dt);
 	}
 
+	bool ParticlesEmitterComponent::IsUpdateThreadSafe() const
+	{
+		return true;
+	}
+
 	String ParticlesEmitterComponent::GetName() const
 	{
 		return "Particles";
 	}
 
+	bool ParticlesEmitterComponent::GetDrawingBounds(RectF& bounds) const
+	{
+		return false;
+	}
+
 	void ParticlesEmitterComponent::OnTransformChanged()
 	{
 		mEmitter.basis = mOwner->transform.GetWorldBasis();
@@ -53,7 +63,9 @@ CLASS_META(o2::ParticlesEmitterComponent)
 
 	PUBLIC_FUNCTION(void, Draw);
 	PUBLIC_FUNCTION(void, Update, float);
+	PUBLIC_FUNCTION(bool, IsUpdateThreadSafe);
 	PUBLIC_FUNCTION(String, GetName);
+	PUBLIC_FUNCTION(bool, GetDrawingBounds, RectF&);
 	PROTECTED_FUNCTION(void, OnTransformChanged);
 }
 END_META;
@@ -22,9 +22,15 @@ namespace o2
 		// Updates component
 		void Update(float dt);
 
+		// Emitter updates only own particles with own random generator and cached image rect, so it can be updated on worker
+		bool IsUpdateThreadSafe() const;
+
 		// Returns name of component
 		String GetName() const;
 
+		// Particles can fly out of actor's rectangle, so bounds are unknown and component is always drawn
+		bool GetDrawingBounds(RectF& bounds) const;
+
 	protected:
 		ParticlesEmitter mEmitter; // @SERIALIZABLE @EDITOR_PROPERTY
 
@@ -6,13 +6,15 @@
 namespace o2
 {
 	DrawableComponent::DrawableComponent():
-		Component(), mDrawingDepth(0)
+		Component(), mDrawingDepth(0), mDrawOrder(0), mInDrawablesGrid(false), mUnboundedDrawing(false),
+		mDrawingBoundsChanged(false), mDrawingQueryIdx(0)
 	{
 		InitializeProperties();
 	}
 
 	DrawableComponent::DrawableComponent(const DrawableComponent& other):
-		Component(other), mDrawingDepth(other.mDrawingDepth)
+		Component(other), mDrawingDepth(other.mDrawingDepth), mDrawOrder(0), mInDrawablesGrid(false),
+		mUnboundedDrawing(false), mDrawingBoundsChanged(false), mDrawingQueryIdx(0)
 	{
 		InitializeProperties();
 	}
@@ -54,6 +56,15 @@ namespace o2
 		return mDrawingDepth;
 	}
 
+	bool DrawableComponent::GetDrawingBounds(RectF& bounds) const
+	{
+		if (!mOwner)
+			return false;
+
+		bounds = mOwner->transform.GetWorldAxisAlignedRect();
+		return true;
+	}
+
 	void DrawableComponent::OnLayerChanged(Scene::Layer* oldLayer, Scene::Layer* newLayer)
 	{
 		if (oldLayer)
@@ -86,6 +97,7 @@ namespace o2
 		if (mOwner)
 		{
 			mOwner->mComponents.Remove(this);
+			mOwner->UpdateComponentsByTypes();
 
 			if (mOwner->mIsOnScene)
 				mOwner->mLayer->UnregDrawableComponent(this);
@@ -96,6 +108,7 @@ namespace o2
 		if (mOwner)
 		{
 			mOwner->mComponents.Add(this);
+			mOwner->UpdateComponentsByTypes();
 
 			if (mOwner->mIsOnScene)
 				mOwner->mLayer->RegDrawableComponent(this);
@@ -131,6 +144,7 @@ CLASS_META(o2::DrawableComponent)
 
 	PUBLIC_FUNCTION(void, SetDrawingDepth, float);
 	PUBLIC_FUNCTION(float, GetDrawingDepth);
+	PUBLIC_FUNCTION(bool, GetDrawingBounds, RectF&);
 	PROTECTED_FUNCTION(void, OnLayerChanged, Scene::Layer*, Scene::Layer*);
 	PROTECTED_FUNCTION(void, UpdateEnabled);
 	PROTECTED_FUNCTION(void, SetOwnerActor, Actor*);
@@ -33,10 +33,21 @@ namespace o2
 		// Returns drawing depth
 		float GetDrawingDepth() const;
 
+		// Returns world bounds of drawing content. Returns false when bounds are unknown, such component is always drawn
+		virtual bool GetDrawingBounds(RectF& bounds) const;
+
 		SERIALIZABLE(DrawableComponent);
 
 	protected:
-		float mDrawingDepth; // Drawing depth. Components with higher depth will be drawn later @SERIALIZABLE
+		float mDrawingDepth;          // Drawing depth. Components with higher depth will be drawn later @SERIALIZABLE
+
+		UInt  mDrawOrder;             // Order of enabling in layer. Sorts components with same depth
+		bool  mInDrawablesGrid;       // Is component placed in layer drawables grid
+		bool  mUnboundedDrawing;      // Is component stored in grid without bounds
+		bool  mDrawingBoundsChanged;  // Is component waiting for update in drawables grid
+		RectF mDrawingBounds;         // World drawing bounds, placed in drawables grid
+		RectI mDrawingCells;          // Range of drawables grid cells, containing component
+		UInt  mDrawingQueryIdx;       // Index of last drawables grid query, that checked component
 
 	protected:
 		// It is called when actor changed layer
@@ -57,6 +68,7 @@ namespace o2
 		// Initializes property
 		void InitializeProperties();
 
+		friend class DrawablesGrid;
 		friend class Scene;
 	};
 }
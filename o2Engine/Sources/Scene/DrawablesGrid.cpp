@@ -0,0 +1,210 @@
+#include "DrawablesGrid.h"
+
+#include "Scene/DrawableComponent.h"
+
+namespace o2
+{
+	DrawablesGrid::DrawablesGrid(float cellSize /*= 512.0f*/):
+		mCellSize(cellSize), mQueryIdx(0)
+	{}
+
+	DrawablesGrid::DrawablesGrid(const DrawablesGrid& other):
+		mCellSize(other.mCellSize), mQueryIdx(0)
+	{}
+
+	DrawablesGrid::~DrawablesGrid()
+	{
+		Clear();
+	}
+
+	DrawablesGrid& DrawablesGrid::operator=(const DrawablesGrid& other)
+	{
+		Clear();
+		mCellSize = other.mCellSize;
+
+		return *this;
+	}
+
+	void DrawablesGrid::Add(DrawableComponent* component)
+	{
+		if (component->mInDrawablesGrid)
+			return;
+
+		component->mInDrawablesGrid = true;
+		component->mDrawingQueryIdx = mQueryIdx;
+
+		RectF bounds;
+		if (component->GetDrawingBounds(bounds))
+		{
+			RectI cells = GetCellsRange(bounds);
+			if ((Int64)(cells.right - cells.left + 1)*(Int64)(cells.top - cells.bottom + 1) <= mMaxComponentCells)
+			{
+				component->mUnboundedDrawing = false;
+				component->mDrawingBounds = bounds;
+				component->mDrawingCells = cells;
+				AddToCells(component, cells);
+				return;
+			}
+		}
+
+		component->mUnboundedDrawing = true;
+		mUnbounded.Add(component);
+	}
+
+	void DrawablesGrid::Remove(DrawableComponent* component)
+	{
+		if (!component->mInDrawablesGrid)
+			return;
+
+		if (component->mUnboundedDrawing)
+			mUnbounded.Remove(component);
+		else
+			RemoveFromCells(component, component->mDrawingCells);
+
+		component->mInDrawablesGrid = false;
+	}
+
+	void DrawablesGrid::Update(DrawableComponent* component)
+	{
+		if (!component->mInDrawablesGrid)
+			return;
+
+		// Component stays in same cells most times, only bounds are updated
+		RectF bounds;
+		if (!component->mUnboundedDrawing && component->GetDrawingBounds(bounds))
+		{
+			RectI cells = GetCellsRange(bounds);
+			if (cells.left == component->mDrawingCells.left && cells.right == component->mDrawingCells.right &&
+				cells.bottom == component->mDrawingCells.bottom && cells.top == component->mDrawingCells.top)
+			{
+				component->mDrawingBounds = bounds;
+				return;
+			}
+		}
+
+		Remove(component);
+		Add(component);
+	}
+
+	void DrawablesGrid::Query(const RectF& rect, DrawCompsVec& result)
+	{
+		mQueryIdx++;
+
+		RectI cells = GetCellsRange(rect);
+		Int64 rangeCellsCount = (Int64)(cells.right - cells.left + 1)*(Int64)(cells.top - cells.bottom + 1);
+
+		if (rangeCellsCount > mCells.Count())
+		{
+			for (auto& kv : mCells)
+				QueryCell(*kv.Value(), rect, result);
+		}
+		else
+		{
+			for (int x = cells.left; x <= cells.right; x++)
+			{
+				for (int y = cells.bottom; y <= cells.top; y++)
+				{
+					if (auto cell = mCells.TryGet(GetCellKey(x, y)))
+						QueryCell(**cell, rect, result);
+				}
+			}
+		}
+
+		result.Add(mUnbounded);
+	}
+
+	void DrawablesGrid::Clear()
+	{
+		for (auto& kv : mCells)
+		{
+			for (auto component : *kv.Value())
+				component->mInDrawablesGrid = false;
+
+			delete kv.Value();
+		}
+
+		for (auto component : mUnbounded)
+			component->mInDrawablesGrid = false;
+
+		mCells.Clear();
+		mUnbounded.Clear();
+	}
+
+	float DrawablesGrid::GetCellSize() const
+	{
+		return mCellSize;
+	}
+
+	int DrawablesGrid::GetCellsCount() const
+	{
+		return mCells.Count();
+	}
+
+	RectI DrawablesGrid::GetCellsRange(const RectF& rect) const
+	{
+		float invCellSize = 1.0f/mCellSize;
+		return RectI((int)floorf(rect.left*invCellSize), (int)floorf(rect.top*invCellSize),
+					 (int)floorf(rect.right*invCellSize), (int)floorf(rect.bottom*invCellSize));
+	}
+
+	UInt64 DrawablesGrid::GetCellKey(int x, int y)
+	{
+		return ((UInt64)(UInt)x << 32) | (UInt64)(UInt)y;
+	}
+
+	void DrawablesGrid::AddToCells(DrawableComponent* component, const RectI& cells)
+	{
+		for (int x = cells.left; x <= cells.right; x++)
+		{
+			for (int y = cells.bottom; y <= cells.top; y++)
+			{
+				UInt64 key = GetCellKey(x, y);
+				DrawCompsVec** cell = mCells.TryGet(key);
+				if (!cell)
+				{
+					mCells.Add(key, mnew DrawCompsVec());
+					cell = mCells.TryGet(key);
+				}
+
+				(*cell)->Add(component);
+			}
+		}
+	}
+
+	void DrawablesGrid::RemoveFromCells(DrawableComponent* component, const RectI& cells)
+	{
+		// Empty cells are released, so moving components doesn't grow cells dictionary
+		for (int x = cells.left; x <= cells.right; x++)
+		{
+			for (int y = cells.bottom; y <= cells.top; y++)
+			{
+				UInt64 key = GetCellKey(x, y);
+				DrawCompsVec** cell = mCells.TryGet(key);
+				if (!cell)
+					continue;
+
+				(*cell)->Remove(component);
+
+				if ((*cell)->IsEmpty())
+				{
+					delete *cell;
+					mCells.RemoveUnordered(key);
+				}
+			}
+		}
+	}
+
+	void DrawablesGrid::QueryCell(const DrawCompsVec& cell, const RectF& rect, DrawCompsVec& result)
+	{
+		for (auto component : cell)
+		{
+			if (component->mDrawingQueryIdx == mQueryIdx)
+				continue;
+
+			component->mDrawingQueryIdx = mQueryIdx;
+
+			if (component->mDrawingBounds.IsIntersects(rect))
+				result.Add(component);
+		}
+	}
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "Utils/CommonTypes.h"
+#include "Utils/Containers/HashDictionary.h"
+#include "Utils/Containers/Vector.h"
+#include "Utils/Math/Rect.h"
+
+namespace o2
+{
+	class DrawableComponent;
+
+	// -----------------------------------------------------------------------------------------
+	// Uniform grid of drawable components world bounds. Component is placed into all cells,
+	// overlapped by it's bounds. Components without bounds or with too large bounds are stored
+	// separately and always passes query
+	// -----------------------------------------------------------------------------------------
+	class DrawablesGrid
+	{
+	public:
+		typedef Vector<DrawableComponent*> DrawCompsVec;
+
+	public:
+		// Constructor
+		DrawablesGrid(float cellSize = 512.0f);
+
+		// Copy-constructor. Components aren't copied, they belong to one grid
+		DrawablesGrid(const DrawablesGrid& other);
+
+		// Destructor
+		~DrawablesGrid();
+
+		// Copy-operator. Removes all components, copies only cell size
+		DrawablesGrid& operator=(const DrawablesGrid& other);
+
+		// Adds component into cells by it's bounds
+		void Add(DrawableComponent* component);
+
+		// Removes component from cells
+		void Remove(DrawableComponent* component);
+
+		// Moves component into cells by it's current bounds
+		void Update(DrawableComponent* component);
+
+		// Adds into result components, which bounds intersects rect. Each component is added once, order isn't defined
+		void Query(const RectF& rect, DrawCompsVec& result);
+
+		// Removes all components and cells
+		void Clear();
+
+		// Returns cell size
+		float GetCellSize() const;
+
+		// Returns count of cells with components
+		int GetCellsCount() const;
+
+	protected:
+		typedef HashDictionary<UInt64, DrawCompsVec*> CellsDict;
+
+		// Maximum count of cells for component, components with larger bounds aren't placed into cells
+		static const int mMaxComponentCells = 64;
+
+		float        mCellSize;       // Size of cell in world units
+		CellsDict    mCells;          // Cells by packed coordinates
+		DrawCompsVec mUnbounded;      // Components, that aren't placed into cells
+		UInt         mQueryIdx;       // Index of last query. Stored in components to skip duplicates
+
+	protected:
+		// Returns range of cells overlapped by rect
+		RectI GetCellsRange(const RectF& rect) const;
+
+		// Returns cell key by coordinates
+		static UInt64 GetCellKey(int x, int y);
+
+		// Adds component into cells range
+		void AddToCells(DrawableComponent* component, const RectI& cells);
+
+		// Removes component from cells range
+		void RemoveFromCells(DrawableComponent* component, const RectI& cells);
+
+		// Checks cell components and adds them into result
+		void QueryCell(const DrawCompsVec& cell, const RectF& rect, DrawCompsVec& result);
+	};
+}
@@ -1,15 +1,19 @@
 #include "Scene.h"
 
+#include <algorithm>
 #include "Assets/ActorAsset.h"
+#include "Render/Render.h"
 #include "Scene/Actor.h"
 #include "Scene/DrawableComponent.h"
 #include "Scene/Tags.h"
+#include "Utils/TaskManager.h"
 
 namespace o2
 {
 	DECLARE_SINGLETON(Scene);
 
-	Scene::Scene()
+	Scene::Scene():
+		mParallelUpdate(false)
 	{
 		mDefaultLayer = AddLayer("Default");
 	}
@@ -24,22 +28,133 @@ namespace o2
 
 	void Scene::Update(float dt)
 	{
+		if (mParallelUpdate)
+		{
+			UpdateParallel(dt);
+			return;
+		}
+
 		for (auto actor : mRootActors)
 			actor->Update(dt);
 
 		for (auto actor : mRootActors)
 			actor->UpdateChilds(dt);
+
+		UpdateTransforms();
+	}
+
+	void Scene::SetParallelUpdate(bool enabled)
+	{
+		mParallelUpdate = enabled;
+	}
+
+	bool Scene::IsParallelUpdate() const
+	{
+		return mParallelUpdate;
+	}
+
+	void Scene::UpdateTransforms()
+	{
+		// Notified actors can change transforms again, they are added to end and processed in this pass
+		for (int i = 0; i < mTransformChangedActors.Count(); i++)
+		{
+			Actor* actor = mTransformChangedActors[i];
+			actor->transform.mIsChangeQueued = false;
+			actor->transform.UpdateChanges();
+		}
+
+		mTransformChangedActors.Clear();
 	}
 
 	void Scene::Draw()
 	{
+		UpdateTransforms();
+
+		RectF viewRect = o2Render.GetCamera().GetAxisAlignedRect();
+
 		for (auto layer : mLayers)
 		{
-			for (auto comp : layer->mEnabledDrawables)
+			mVisibleDrawables.Clear();
+			layer->GetVisibleDrawableComponents(viewRect, mVisibleDrawables);
+
+			for (auto comp : mVisibleDrawables)
 				comp->Draw();
 		}
 	}
 
+	void Scene::UpdateParallel(float dt)
+	{
+		mThreadSafeComponents.Clear();
+
+		for (auto actor : mRootActors)
+			actor->UpdateSeparated(dt, mThreadSafeComponents);
+
+		for (auto actor : mRootActors)
+			actor->UpdateChildsSeparated(dt, mThreadSafeComponents);
+
+		// World transforms are calculated lazily, so they must be actual before reading from workers
+		UpdateTransforms();
+
+		auto updateRange = [&](int begin, int end)
+		{
+			for (int i = begin; i < end; i++)
+				mThreadSafeComponents[i]->Update(dt);
+		};
+
+		if (TaskManager::IsSingletonInitialzed())
+			o2Tasks.ParallelFor(mThreadSafeComponents.Count(), mParallelUpdateRangeSize, updateRange);
+		else
+			updateRange(0, mThreadSafeComponents.Count());
+
+		UpdateTransforms();
+	}
+
+	void Scene::AddActor(Actor* actor)
+	{
+		mAllActors.Add(actor);
+		AddActorIdIndex(actor);
+	}
+
+	void Scene::RemoveActor(Actor* actor)
+	{
+		mAllActors.Remove(actor);
+		RemoveActorIdIndex(actor, actor->mId);
+	}
+
+	void Scene::OnActorIdChanged(Actor* actor, UInt64 oldId)
+	{
+		RemoveActorIdIndex(actor, oldId);
+		AddActorIdIndex(actor);
+	}
+
+	void Scene::AddActorIdIndex(Actor* actor)
+	{
+		Actor** indexed = mActorsByIds.TryGet(actor->mId);
+		if (!indexed)
+			mActorsByIds.Add(actor->mId, actor);
+		else if (*indexed != actor && !mNotIndexedActors.Contains(actor))
+			mNotIndexedActors.Add(actor);
+	}
+
+	void Scene::RemoveActorIdIndex(Actor* actor, UInt64 id)
+	{
+		Actor** indexed = mActorsByIds.TryGet(id);
+		if (!indexed || *indexed != actor)
+		{
+			mNotIndexedActors.Remove(actor);
+			return;
+		}
+
+		mActorsByIds.RemoveUnordered(id);
+
+		int duplicateIdx = mNotIndexedActors.FindIdx([=](Actor* x) { return x->mId == id; });
+		if (duplicateIdx >= 0)
+		{
+			mActorsByIds.Add(id, mNotIndexedActors[duplicateIdx]);
+			mNotIndexedActors.RemoveAt(duplicateIdx);
+		}
+	}
+
 	Scene::Layer* Scene::GetLayer(const String& name)
 	{
 		if (auto layer = mLayers.FindMatch([&](auto x) { return x->name == name; }))
@@ -152,26 +267,29 @@ namespace o2
 
 	Actor* Scene::GetActorByID(UInt64 id) const
 	{
-		return mAllActors.FindMatch([=](Actor* x) { return x->mId == id; });
+		if (Actor* const* actor = mActorsByIds.TryGet(id))
+			return *actor;
+
+		return mNotIndexedActors.FindMatch([=](Actor* x) { return x->mId == id; });
 	}
 
 	Actor* Scene::GetAssetActorByID(UID id)
 	{
-		auto cached = mCache.FindMatch([=](const ActorAssetRef& x) { return x->GetAssetId() == id; });
+		ActorAssetRef* cached = mCache.TryGet(id);
 
 		if (!cached)
 		{
-			cached = ActorAssetRef(id);
-			mCache.Add(cached);
+			mCache.Add(id, ActorAssetRef(id));
+			cached = mCache.TryGet(id);
 		}
 
-		return cached->GetActor();
+		return (*cached)->GetActor();
 	}
 
 	Actor* Scene::FindActor(const String& path)
 	{
 		int delPos = path.Find("/");
-		WString pathPart = path.SubStr(0, delPos);
+		String pathPart = path.SubStr(0, delPos);
 
 		for (auto actor : mRootActors)
 		{
@@ -223,6 +341,7 @@ namespace o2
 		}
 
 		DataNode data;
+		data.EnableArena();
 		data.LoadFromFile(path);
 
 		auto layersNode = data.GetNode("Layers");
@@ -369,6 +488,23 @@ namespace o2
 		return mEnabledDrawables;
 	}
 
+	void Scene::Layer::GetVisibleDrawableComponents(const RectF& viewRect, DrawCompsVec& result)
+	{
+		UpdateDrawablesGrid();
+
+		int begin = result.Count();
+		mDrawablesGrid.Query(viewRect, result);
+
+		// Restoring order of mEnabledDrawables: by depth, then by enabling order
+		auto visible = result.Data() + begin;
+		std::sort(visible, visible + result.Count() - begin, [](DrawableComponent* a, DrawableComponent* b) {
+			if (a->mDrawingDepth != b->mDrawingDepth)
+				return a->mDrawingDepth < b->mDrawingDepth;
+
+			return a->mDrawOrder < b->mDrawOrder;
+		});
+	}
+
 	void Scene::Layer::RegDrawableComponent(DrawableComponent* component)
 	{
 		mDrawables.Add(component);
@@ -397,8 +533,8 @@ namespace o2
 		int rangeMin = 0, rangeMax = mEnabledDrawables.Count();
 		float targetDepth = component->mDrawingDepth;
 		int position = 0;
-		bool skipLinearSearch = false;
 
+		// Component is placed after all components with same depth, so they are ordered by enabling
 		while (rangeMax - rangeMin > binSearchRangeSizeStop)
 		{
 			int center = (rangeMin + rangeMax) >> 1;
@@ -407,29 +543,50 @@ namespace o2
 
 			if (targetDepth < centerValue)
 				rangeMax = center;
-			else if (targetDepth > centerValue)
-				rangeMin = center;
 			else
-			{
-				position = center;
-				skipLinearSearch = true;
-				break;
-			}
+				rangeMin = center;
 		}
 
-		if (!skipLinearSearch)
-		{
-			for (position = rangeMin; position < rangeMax; position++)
-				if (mEnabledDrawables[position]->mDrawingDepth > targetDepth)
-					break;
-		}
+		for (position = rangeMin; position < rangeMax; position++)
+			if (mEnabledDrawables[position]->mDrawingDepth > targetDepth)
+				break;
 
 		mEnabledDrawables.Insert(component, position);
+
+		component->mDrawOrder = ++mLastDrawOrder;
+		mDrawablesGrid.Add(component);
 	}
 
 	void Scene::Layer::ComponentDisabled(DrawableComponent* component)
 	{
 		mEnabledDrawables.Remove(component);
+		mDrawablesGrid.Remove(component);
+
+		if (component->mDrawingBoundsChanged)
+		{
+			mBoundsChangedDrawables.Remove(component);
+			component->mDrawingBoundsChanged = false;
+		}
+	}
+
+	void Scene::Layer::ComponentBoundsChanged(DrawableComponent* component)
+	{
+		if (component->mDrawingBoundsChanged || !component->mInDrawablesGrid)
+			return;
+
+		component->mDrawingBoundsChanged = true;
+		mBoundsChangedDrawables.Add(component);
+	}
+
+	void Scene::Layer::UpdateDrawablesGrid()
+	{
+		for (auto component : mBoundsChangedDrawables)
+		{
+			component->mDrawingBoundsChanged = false;
+			mDrawablesGrid.Update(component);
+		}
+
+		mBoundsChangedDrawables.Clear();
 	}
 
 #if IS_EDITOR
@@ -523,10 +680,13 @@ CLASS_META(o2::Scene::Layer)
 	PUBLIC_FUNCTION(const ActorsVec&, GetEnabledActors);
 	PUBLIC_FUNCTION(const DrawCompsVec&, GetDrawableComponents);
 	PUBLIC_FUNCTION(const DrawCompsVec&, GetEnabledDrawableComponents);
+	PUBLIC_FUNCTION(void, GetVisibleDrawableComponents, const RectF&, DrawCompsVec&);
 	PROTECTED_FUNCTION(void, RegDrawableComponent, DrawableComponent*);
 	PROTECTED_FUNCTION(void, UnregDrawableComponent, DrawableComponent*);
 	PROTECTED_FUNCTION(void, ComponentDepthChanged, DrawableComponent*);
 	PROTECTED_FUNCTION(void, ComponentEnabled, DrawableComponent*);
 	PROTECTED_FUNCTION(void, ComponentDisabled, DrawableComponent*);
+	PROTECTED_FUNCTION(void, ComponentBoundsChanged, DrawableComponent*);
+	PROTECTED_FUNCTION(void, UpdateDrawablesGrid);
 }
 END_META;
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Assets/ActorAsset.h"
+#include "Scene/DrawablesGrid.h"
+#include "Utils/Containers/HashDictionary.h"
 #include "Utils/Containers/Vector.h"
 #include "Utils/Serializable.h"
 #include "Utils/Singleton.h"
@@ -13,6 +15,7 @@
 namespace o2
 {
 	class Actor;
+	class Component;
 	class DrawableComponent;
 	class Tag;
 
@@ -23,8 +26,10 @@ namespace o2
 	{
 	public:
 		typedef Vector<Actor*> ActorsVec;
+		typedef Vector<Component*> ComponentsVec;
 		typedef Vector<DrawableComponent*> DrawCompsVec;
-		typedef Vector<ActorAssetRef> ActorsAssetsVec;
+		typedef HashDictionary<UID, ActorAssetRef> ActorsAssetsDict;
+		typedef HashDictionary<UInt64, Actor*> ActorsIdsDict;
 		typedef Vector<String> StringsVec;
 		typedef Vector<Tag*> TagsVec;
 		typedef Dictionary<ActorAssetRef, ActorsVec> ActorsCacheDict;
@@ -49,6 +54,9 @@ namespace o2
 			// Returns enabled drawable components of actors in layer
 			const DrawCompsVec& GetEnabledDrawableComponents() const;
 
+			// Adds into result enabled drawable components, that intersects view rectangle, in drawing order
+			void GetVisibleDrawableComponents(const RectF& viewRect, DrawCompsVec& result);
+
 			SERIALIZABLE(Layer);
 
 		protected:
@@ -57,6 +65,10 @@ namespace o2
 			DrawCompsVec mDrawables;        // Drawable components in layer
 			DrawCompsVec mEnabledDrawables; // Enabled drawable components in layer
 
+			DrawablesGrid mDrawablesGrid;          // Spatial grid of enabled drawable components
+			DrawCompsVec  mBoundsChangedDrawables; // Drawable components, which bounds were changed since last query
+			UInt          mLastDrawOrder = 0;      // Last given drawing order of enabled component
+
 		protected:
 			// Registers drawable component
 			void RegDrawableComponent(DrawableComponent* component);
@@ -73,6 +85,12 @@ namespace o2
 			// It is called when component was enabled
 			void ComponentDisabled(DrawableComponent* component);
 
+			// It is called when drawable component's actor transform was changed, component will be moved in grid before next query
+			void ComponentBoundsChanged(DrawableComponent* component);
+
+			// Moves components with changed bounds in drawables grid
+			void UpdateDrawablesGrid();
+
 			friend class DrawableComponent;
 			friend class Scene;
 			friend class Actor;
@@ -151,7 +169,7 @@ namespace o2
 
 		// Returns all components with type in scene
 		template<typename _type>
-		Vector<_type>* FindAllActorsComponents();
+		Vector<_type*> FindAllActorsComponents();
 
 		// Removes all actors
 		void Clear();
@@ -171,9 +189,19 @@ namespace o2
 		// Reparent actors to new parent at next of prevActor;
 		void ReparentActors(const ActorsVec& actors, Actor* newParent, Actor* prevActor);
 
-		// Updates root actors
+		// Updates root actors. In parallel update mode thread safe components are updated on workers after others
 		void Update(float dt);
 
+		// Sets parallel updating of thread safe components. Deterministic mode is controlled by tasks manager
+		void SetParallelUpdate(bool enabled);
+
+		// Returns is parallel updating of thread safe components enabled
+		bool IsParallelUpdate() const;
+
+		// Recalculates world transforms of changed actors and notifies them. Multiple changes of actor's transform
+		// during frame are processed once. It is called after updating and before drawing
+		void UpdateTransforms();
+
 #if IS_EDITOR	  
 		// It is called when actor was changed
 		void OnActorChanged(Actor* actor);   
@@ -198,16 +226,24 @@ namespace o2
 #endif       
 
 	protected:
-		ActorsVec       mRootActors;          // Scene root actors		
-		ActorsVec       mAllActors;           // All scene actors
-		LayersVec       mLayers;              // Scene layers
-		TagsVec         mTags;                // Scene tags
-		Layer*          mDefaultLayer;        // Default scene layer
-		ActorsAssetsVec mCache;               // Cached actors assets
+		static const int mParallelUpdateRangeSize = 8; // Count of thread safe components, updating by worker at once
+
+		ActorsVec        mRootActors;             // Scene root actors		
+		ActorsVec        mAllActors;              // All scene actors
+		ActorsIdsDict    mActorsByIds;            // All scene actors by ids. Actor with duplicated id isn't indexed
+		ActorsVec        mNotIndexedActors;       // Actors with duplicated ids, they're searched linearly
+		LayersVec        mLayers;                 // Scene layers
+		TagsVec          mTags;                   // Scene tags
+		Layer*           mDefaultLayer;           // Default scene layer
+		ActorsAssetsDict mCache;                  // Cached actors assets by assets ids
+		DrawCompsVec     mVisibleDrawables;       // Visible drawable components buffer, used while drawing
+		ActorsVec        mTransformChangedActors; // Actors with changed transforms, waiting for notification
+		ComponentsVec    mThreadSafeComponents;   // Thread safe components buffer, used while parallel updating
+		bool             mParallelUpdate;         // Is thread safe components updating in parallel
 				  						      
 #if IS_EDITOR	  						      
-		ActorsVec       mChangedActors;       // Changed actors array
-		ActorsCacheDict mPrototypeLinksCache; // Cache of linked to prototypes actors
+		ActorsVec        mChangedActors;          // Changed actors array
+		ActorsCacheDict  mPrototypeLinksCache;    // Cache of linked to prototypes actors
 #endif
 
 	protected:
@@ -220,7 +256,26 @@ namespace o2
 		// Draws scene drawable components
 		void Draw();
 
+		// Updates actors and not thread safe components, then updates thread safe components on workers
+		void UpdateParallel(float dt);
+
+		// Adds actor into all actors list and ids index
+		void AddActor(Actor* actor);
+
+		// Removes actor from all actors list and ids index
+		void RemoveActor(Actor* actor);
+
+		// It is called when actor's id changed, updates ids index
+		void OnActorIdChanged(Actor* actor, UInt64 oldId);
+
+		// Adds actor into ids index by it's id. Does nothing when actor is already indexed
+		void AddActorIdIndex(Actor* actor);
+
+		// Removes actor from ids index by id. Indexes not indexed actor with same id instead
+		void RemoveActorIdIndex(Actor* actor, UInt64 id);
+
 		friend class Actor;
+		friend class ActorTransform;
 		friend class Application;
 		friend class DrawableComponent;
 	};
@@ -242,11 +297,11 @@ namespace o2
 	};
 
 	template<typename _type>
-	Vector<_type>* Scene::FindAllActorsComponents()
+	Vector<_type*> Scene::FindAllActorsComponents()
 	{
-		Vector<_type>* res;
+		Vector<_type*> res;
 		for (auto actor : mRootActors)
-			res.Add(actor->GetComponentsInChildren<_type>());
+			actor->GetComponentsInChildren<_type>(res);
 
 		return res;
 	}
@@ -256,7 +311,7 @@ namespace o2
 	{
 		for (auto actor : mRootActors)
 		{
-			_type> res = actor->GetComponentInChildren<_type*();
+			_type* res = actor->GetComponentInChildren<_type>();
 			if (res)
 				return res;
 		}
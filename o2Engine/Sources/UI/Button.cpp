@@ -111,6 +111,11 @@ namespace o2
 		return UIWidget::IsUnderPoint(point);
 	}
 
+	RectF UIButton::GetCursorAreaBounds() const
+	{
+		return UIWidget::GetUnderPointBounds();
+	}
+
 	void UIButton::OnCursorPressed(const Input::Cursor& cursor)
 	{
 		auto pressedState = state["pressed"];
@@ -264,6 +269,7 @@ CLASS_META(o2::UIButton)
 	PUBLIC_FUNCTION(UIButtonGroup*, GetButtonGroup);
 	PUBLIC_FUNCTION(bool, IsFocusable);
 	PUBLIC_FUNCTION(bool, IsUnderPoint, const Vec2F&);
+	PUBLIC_FUNCTION(RectF, GetCursorAreaBounds);
 	PROTECTED_FUNCTION(void, OnCursorPressed, const Input::Cursor&);
 	PROTECTED_FUNCTION(void, OnCursorReleased, const Input::Cursor&);
 	PROTECTED_FUNCTION(void, OnCursorPressBreak, const Input::Cursor&);
@@ -198,6 +198,8 @@ namespace o2
 			case BaseCorner::Bottom: ArrangeFromBottom(); break;
 			case BaseCorner::RightBottom: ArrangeFromRightBottom(); break;
 		}
+
+		UpdateBoundsWithChilds();
 	}
 
 	void UIGridLayout::ArrangeFromLeftTop()
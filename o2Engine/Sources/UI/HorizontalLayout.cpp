@@ -211,6 +211,7 @@ namespace o2
 			break;
 		}
 
+		UpdateBoundsWithChilds();
 	}
 
 	void UIHorizontalLayout::UpdateLayoutParametres()
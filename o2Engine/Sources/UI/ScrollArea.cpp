@@ -567,6 +567,11 @@ namespace o2
 		for (auto child : mChilds)
 			MoveWidgetAndCheckClipping(child, widgetsMove);
 
+		UpdateBoundsWithChilds();
+
+		for (auto parent = mParent; parent; parent = parent->mParent)
+			parent->UpdateBoundsWithChilds();
+
 		UpdateScrollParams();
 		UpdateScrollBarsLayout();
 	}
@@ -581,6 +586,9 @@ namespace o2
 
 		for (auto child : widget->mChilds)
 			MoveWidgetAndCheckClipping(child, delta);
+
+		if (!widget->mIsClipped)
+			widget->UpdateBoundsWithChilds();
 	}
 
 	void UIScrollArea::UpdateScrollBarsLayout()
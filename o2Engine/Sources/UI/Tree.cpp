@@ -84,6 +84,11 @@ namespace o2
 		return UIWidget::IsUnderPoint(point);
 	}
 
+	RectF UITreeNode::GetCursorAreaBounds() const
+	{
+		return UIWidget::GetUnderPointBounds();
+	}
+
 	void UITreeNode::UpdateTreeLayout(float dt)
 	{
 		mOwnerTree->mIsNeedUdateLayout = true;
@@ -1693,6 +1698,11 @@ namespace o2
 		return UIWidget::IsUnderPoint(point);
 	}
 
+	RectF UITree::GetCursorAreaBounds() const
+	{
+		return UIWidget::GetUnderPointBounds();
+	}
+
 	float UITree::Node::GetHeight() const
 	{
 		float res = 20;
@@ -1825,6 +1835,7 @@ CLASS_META(o2::UITree)
 	PUBLIC_FUNCTION(bool, IsScrollable);
 	PUBLIC_FUNCTION(bool, IsFocusable);
 	PUBLIC_FUNCTION(bool, IsUnderPoint, const Vec2F&);
+	PUBLIC_FUNCTION(RectF, GetCursorAreaBounds);
 	PUBLIC_FUNCTION(void, UpdateLayout, bool, bool);
 	PROTECTED_FUNCTION(UnknownPtr, GetObjectParent, UnknownPtr);
 	PROTECTED_FUNCTION(Vector<UnknownPtr>, GetObjectChilds, UnknownPtr);
@@ -1900,6 +1911,7 @@ CLASS_META(o2::UITreeNode)
 	PUBLIC_FUNCTION(void, Collapse, bool);
 	PUBLIC_FUNCTION(UnknownPtr, GetObject);
 	PUBLIC_FUNCTION(bool, IsUnderPoint, const Vec2F&);
+	PUBLIC_FUNCTION(RectF, GetCursorAreaBounds);
 	PROTECTED_FUNCTION(void, UpdateTreeLayout, float);
 	PROTECTED_FUNCTION(void, OnCursorDblClicked, const Input::Cursor&);
 	PROTECTED_FUNCTION(void, OnCursorEnter, const Input::Cursor&);
@@ -421,6 +421,7 @@ namespace o2
 
 	void UIManager::Update(float dt)
 	{
+		UpdateLayouts();
 		mScreenWidget->Update(dt);
 
 		if (o2Input.IsKeyPressed(VK_TAB))
@@ -429,6 +430,7 @@ namespace o2
 
 	void UIManager::Draw()
 	{
+		UpdateLayouts();
 		mScreenWidget->Draw();
 
 		for (auto widget : mTopWidgets)
@@ -440,6 +442,11 @@ namespace o2
 			UIContextMenu::mVisibleContextMenu->SpecialDraw();
 	}
 
+	void UIManager::UpdateLayouts()
+	{
+		mScreenWidget->UpdateDirtyLayouts();
+	}
+
 	void UIManager::UpdateRootSize()
 	{
 		Vec2I resolution = o2Render.GetResolution();
@@ -217,6 +217,9 @@ namespace o2
 		// Draws widgets
 		void Draw();
 
+		// Updates all changed widgets layouts. Calls automatically before updating and drawing
+		void UpdateLayouts();
+
 		// Registering widget for draing at top of all regular widgets
 		void DrawWidgetAtTop(UIWidget* widget);
 
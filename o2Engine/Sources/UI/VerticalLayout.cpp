@@ -212,6 +212,7 @@ namespace o2
 			break;
 		}
 
+		UpdateBoundsWithChilds();
 	}
 
 	void UIVerticalLayout::UpdateLayoutParametres()
@@ -206,7 +206,7 @@ namespace o2
 		if (mParent)
 		{
 			mParent->RemoveChild(this, false);
-			mParent->UpdateLayout();
+			mParent->SetLayoutDirty();
 		}
 
 		mParent = parent;
@@ -214,7 +214,7 @@ namespace o2
 		if (mParent)
 		{
 			mParent->mChilds.Add(this);
-			mParent->UpdateLayout();
+			mParent->SetLayoutDirty();
 		}
 
 		UpdateTransparency();
@@ -234,7 +234,7 @@ namespace o2
 
 		if (updateNow)
 		{
-			UpdateLayout();
+			SetLayoutDirty();
 			UpdateTransparency();
 			UpdateVisibility();
 		}
@@ -260,7 +260,7 @@ namespace o2
 			OnChildAdded(widget);
 		}
 
-		UpdateLayout();
+		SetLayoutDirty();
 		UpdateTransparency();
 		UpdateVisibility();
 	}
@@ -276,7 +276,7 @@ namespace o2
 		mChilds.Insert(widget, index);
 		widget->mParent = this;
 
-		UpdateLayout();
+		SetLayoutDirty();
 		UpdateTransparency();
 		UpdateVisibility();
 
@@ -292,7 +292,6 @@ namespace o2
 			return false;
 
 		bool res = child->mParent->RemoveChild(child);
-		child->mParent->UpdateLayout();
 		child->UpdateTransparency();
 		child->UpdateVisibility();
 
@@ -308,7 +307,7 @@ namespace o2
 		mChilds.Remove(widget);
 		
 		if (updateLayout)
-			UpdateLayout();
+			SetLayoutDirty();
 
 		OnChildRemoved(widget);
 
@@ -369,7 +368,7 @@ namespace o2
 		mChilds.Clear();
 		
 		if (updateLayout)
-			UpdateLayout();
+			SetLayoutDirty();
 	}
 
 	const UIWidget::WidgetsVec& UIWidget::GetChilds() const
@@ -674,6 +673,11 @@ namespace o2
 		return mDrawingScissorRect.IsInside(point) && layout.mAbsoluteRect.IsInside(point);
 	}
 
+	RectF UIWidget::GetUnderPointBounds() const
+	{
+		return mBounds;
+	}
+
 	bool UIWidget::CheckIsLayoutDrivenByParent(bool forcibleLayout)
 	{
 		if (layout.mDrivenByParent && !forcibleLayout)
@@ -702,6 +706,44 @@ namespace o2
 			UpdateChildrenLayouts(true);
 	}
 
+	void UIWidget::SetLayoutDirty()
+	{
+		mLayoutDirty = true;
+
+		if (layout.mDrivenByParent && mParent)
+		{
+			mParent->SetLayoutDirty();
+			return;
+		}
+
+		for (auto parent = mParent; parent && !parent->mChildsLayoutDirty; parent = parent->mParent)
+			parent->mChildsLayoutDirty = true;
+	}
+
+	bool UIWidget::IsLayoutDirty() const
+	{
+		return mLayoutDirty;
+	}
+
+	void UIWidget::UpdateLayoutIfDirty()
+	{
+		UIWidget* topDirtyWidget = nullptr;
+		for (auto widget = this; widget; widget = widget->mParent)
+		{
+			if (widget->mLayoutDirty)
+				topDirtyWidget = widget;
+		}
+
+		if (!topDirtyWidget)
+			return;
+
+		topDirtyWidget->mLayoutDirty = false;
+		topDirtyWidget->UpdateLayout(true);
+
+		for (auto parent = topDirtyWidget->mParent; parent; parent = parent->mParent)
+			parent->UpdateBoundsWithChilds();
+	}
+
 	float UIWidget::GetMinWidthWithChildren() const
 	{
 		return layout.mMinSize.x;
@@ -716,6 +758,34 @@ namespace o2
 	{
 		for (auto child : mChilds)
 			child->UpdateLayout(forcible);
+
+		if (forcible)
+			mChildsLayoutDirty = false;
+
+		UpdateBoundsWithChilds();
+	}
+
+	void UIWidget::UpdateDirtyLayouts()
+	{
+		bool layoutUpdated = mLayoutDirty;
+		if (mLayoutDirty)
+		{
+			mLayoutDirty = false;
+			UpdateLayout();
+		}
+
+		if (!mChildsLayoutDirty && !layoutUpdated)
+			return;
+
+		mChildsLayoutDirty = false;
+
+		for (auto child : mChilds)
+		{
+			if (child->mLayoutDirty || child->mChildsLayoutDirty)
+				child->UpdateDirtyLayouts();
+		}
+
+		UpdateBoundsWithChilds();
 	}
 
 	void UIWidget::UpdateBoundsWithChilds()
@@ -723,10 +793,7 @@ namespace o2
 		mBoundsWithChilds = mBounds;
 
 		for (auto child : mChilds)
-			mBoundsWithChilds.Expand(child->mBoundsWithChilds);
-
-		if (mParent)
-			mParent->UpdateBoundsWithChilds();
+			mBoundsWithChilds = mBoundsWithChilds.Expand(child->mBoundsWithChilds);
 	}
 
 	void UIWidget::CheckClipping(const RectF& clipArea)
@@ -771,7 +838,7 @@ namespace o2
 				mFullyDisabled = !mResVisible;
 
 			if (updateLayout)
-				UpdateLayout();
+				SetLayoutDirty();
 
 			if (mResVisible)
 				onShow();
@@ -838,6 +905,7 @@ namespace o2
 		layout.mLocalRect.top    = Math::Floor(layout.mLocalRect.top);
 
 		layout.mAbsoluteRect = layout.mLocalRect + parentPos;
+		mLayoutDirty = false;
 		mLastChildsAbsRect = mChildsAbsRect;
 		mChildsAbsRect = layout.mAbsoluteRect;
 
@@ -858,10 +926,9 @@ namespace o2
 		mBounds = layout.mAbsoluteRect;
 
 		for (auto layer : mDrawingLayers)
-			mBounds.Expand(layer->GetRect());
+			mBounds = mBounds.Expand(layer->GetRect());
 
-		if (mChilds.IsEmpty())
-			UpdateBoundsWithChilds();
+		UpdateBoundsWithChilds();
 	}
 
 	void UIWidget::UpdateLayersDrawingSequence()
@@ -1044,6 +1111,8 @@ CLASS_META(o2::UIWidget)
 	PROTECTED_FIELD(mIsClipped);
 	PROTECTED_FIELD(mBounds);
 	PROTECTED_FIELD(mBoundsWithChilds);
+	PROTECTED_FIELD(mLayoutDirty);
+	PROTECTED_FIELD(mChildsLayoutDirty);
 
 	typedef Dictionary<String, UIWidgetLayer*> _tmp1;
 	typedef Dictionary<String, UIWidget*> _tmp2;
@@ -1095,7 +1164,11 @@ CLASS_META(o2::UIWidget)
 	PUBLIC_FUNCTION(bool, IsFocusable);
 	PUBLIC_FUNCTION(void, SetFocusable, bool);
 	PUBLIC_FUNCTION(bool, IsUnderPoint, const Vec2F&);
+	PUBLIC_FUNCTION(RectF, GetUnderPointBounds);
 	PUBLIC_FUNCTION(void, UpdateLayout, bool, bool);
+	PUBLIC_FUNCTION(void, SetLayoutDirty);
+	PUBLIC_FUNCTION(bool, IsLayoutDirty);
+	PUBLIC_FUNCTION(void, UpdateLayoutIfDirty);
 	PROTECTED_FUNCTION(void, DrawDebugFrame);
 	PROTECTED_FUNCTION(void, OnFocused);
 	PROTECTED_FUNCTION(void, OnUnfocused);
@@ -1103,6 +1176,7 @@ CLASS_META(o2::UIWidget)
 	PROTECTED_FUNCTION(float, GetMinWidthWithChildren);
 	PROTECTED_FUNCTION(float, GetMinHeightWithChildren);
 	PROTECTED_FUNCTION(void, UpdateChildrenLayouts, bool);
+	PROTECTED_FUNCTION(void, UpdateDirtyLayouts);
 	PROTECTED_FUNCTION(void, UpdateBounds);
 	PROTECTED_FUNCTION(void, UpdateBoundsWithChilds);
 	PROTECTED_FUNCTION(void, CheckClipping, const RectF&);
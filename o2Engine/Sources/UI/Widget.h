@@ -211,9 +211,21 @@ namespace o2
 		// Returns true if point is under drawable
 		bool IsUnderPoint(const Vec2F& point);
 
+		// Returns widget bounds with drawing layers. Doesn't update dirty layout
+		RectF GetUnderPointBounds() const;
+
 		// Updates layout
 		virtual void UpdateLayout(bool forcible = false, bool withChildren = true);
 
+		// Marks layout as changed. It will be updated in next UI layouts pass or when layout rectangle requested
+		void SetLayoutDirty();
+
+		// Returns is layout changed and not updated yet
+		bool IsLayoutDirty() const;
+
+		// Updates layout of topmost changed widget from this and parents, if there are changes
+		void UpdateLayoutIfDirty();
+
 		SERIALIZABLE(UIWidget);
 
 	protected:
@@ -245,6 +257,9 @@ namespace o2
 		RectF          mBounds;                 // Widget bounds by drawing layers
 		RectF          mBoundsWithChilds;       // Widget with childs bounds
 
+		bool           mLayoutDirty = false;       // Is layout changed and must be updated
+		bool           mChildsLayoutDirty = false; // Is some of children layouts changed and must be updated
+
 	protected:
 		// Draws debug frame by mAbsoluteRect
 		void DrawDebugFrame();
@@ -267,10 +282,13 @@ namespace o2
 		// Updates children layouts
 		virtual void UpdateChildrenLayouts(bool forcible = false);
 
+		// Updates changed layouts of this and children widgets, from top to bottom
+		void UpdateDirtyLayouts();
+
 		// Updates bounds by drawing layers
 		virtual void UpdateBounds();
 
-		// Updates bound with children
+		// Updates bounds with children from this bounds and direct children bounds
 		virtual void UpdateBoundsWithChilds();
 
 		// Checks widget clipping by area
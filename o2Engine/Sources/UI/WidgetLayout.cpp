@@ -39,7 +39,7 @@ namespace o2
 		CopyFrom(other);
 
 		if (mOwner)
-			mOwner->UpdateLayout();
+			mOwner->SetLayoutDirty();
 
 		return *this;
 	}
@@ -55,16 +55,19 @@ namespace o2
 		Vec2F delta = position - GetPosition();
 		mOffsetMin += delta;
 		mOffsetMax += delta;
-		mOwner->UpdateLayout();
+		mOwner->SetLayoutDirty();
 	}
 
 	bool UIWidgetLayout::IsUnderPoint(const Vec2F& point) const
 	{
+		UpdateOwnerLayoutIfDirty();
 		return mAbsoluteRect.IsInside(point);
 	}
 
 	Vec2F UIWidgetLayout::GetPosition()
 	{
+		UpdateOwnerLayoutIfDirty();
+
 		Vec2F parentPivot;
 
 // 		if (mOwner->mParent)
@@ -78,11 +81,12 @@ namespace o2
 		Vec2F szDelta = size - GetSize();
 		mOffsetMax += szDelta*(Vec2F::One() - mPivot);
 		mOffsetMin -= szDelta*mPivot;
-		mOwner->UpdateLayout();
+		mOwner->SetLayoutDirty();
 	}
 
 	Vec2F UIWidgetLayout::GetSize() const
 	{
+		UpdateOwnerLayoutIfDirty();
 		return mAbsoluteRect.Size();
 	}
 
@@ -91,11 +95,12 @@ namespace o2
 		float delta = width - GetWidth();
 		mOffsetMax.x += delta*(1.0f - mPivot.x);
 		mOffsetMin.x -= delta*mPivot.x;
-		mOwner->UpdateLayout();
+		mOwner->SetLayoutDirty();
 	}
 
 	float UIWidgetLayout::GetWidth() const
 	{
+		UpdateOwnerLayoutIfDirty();
 		return mAbsoluteRect.Width();
 	}
 
@@ -104,67 +109,78 @@ namespace o2
 		float delta = height - GetHeight();
 		mOffsetMax.y += delta*(1.0f - mPivot.y);
 		mOffsetMin.y -= delta*mPivot.y;
-		mOwner->UpdateLayout();
+		mOwner->SetLayoutDirty();
 	}
 
 	float UIWidgetLayout::GetHeight() const
 	{
+		UpdateOwnerLayoutIfDirty();
 		return mAbsoluteRect.Height();
 	}
 
 	void UIWidgetLayout::SetRect(const RectF& rect)
 	{
+		UpdateOwnerLayoutIfDirty();
 		mOffsetMin += rect.LeftBottom() - mLocalRect.LeftBottom();
 		mOffsetMax += rect.RightTop() - mLocalRect.RightTop();
-		mOwner->UpdateLayout();
+		mOwner->SetLayoutDirty();
 	}
 
 	RectF UIWidgetLayout::GetRect() const
 	{
+		UpdateOwnerLayoutIfDirty();
 		return mLocalRect;
 	}
 
 	void UIWidgetLayout::SetAbsoluteLeft(float value)
 	{
+		UpdateOwnerLayoutIfDirty();
 		mOffsetMin.x += value - mAbsoluteRect.left;
-		mOwner->UpdateLayout();
+		mOwner->SetLayoutDirty();
 	}
 
 	float UIWidgetLayout::GetAbsoluteLeft() const
 	{
+		UpdateOwnerLayoutIfDirty();
 		return mAbsoluteRect.left;
 	}
 
 	void UIWidgetLayout::SetAbsoluteRight(float value)
 	{
+		UpdateOwnerLayoutIfDirty();
 		mOffsetMax.x += value - mAbsoluteRect.right;
-		mOwner->UpdateLayout();
+		mOwner->SetLayoutDirty();
 	}
 
 	float UIWidgetLayout::GetAbsoluteRight() const
 	{
+		UpdateOwnerLayoutIfDirty();
 		return mAbsoluteRect.right;
 	}
 
 	void UIWidgetLayout::SetAbsoluteBottom(float value)
 	{
+		UpdateOwnerLayoutIfDirty();
 		mOffsetMin.y += value - mAbsoluteRect.bottom;
-		mOwner->UpdateLayout();
+		mOwner->SetLayoutDirty();
 	}
 
 	float UIWidgetLayout::GetAbsoluteBottom() const
 	{
+		UpdateOwnerLayoutIfDirty();
 		return mAbsoluteRect.bottom;
 	}
 
 	void UIWidgetLayout::SetAbsoluteTop(float value)
 	{
+		UpdateOwnerLayoutIfDirty();
 		mOffsetMax.y += value - mAbsoluteRect.top;
-		mOwner->UpdateLayout();
+		mOwner->SetLayoutDirty();
 	}
 
 	float UIWidgetLayout::GetAbsoluteTop() const
 	{
+		UpdateOwnerLayoutIfDirty();
 		return mAbsoluteRect.top;
 	}
 
@@ -173,78 +189,89 @@ namespace o2
 		Vec2F delta = absPosition - GetAbsolutePosition();
 		mOffsetMin += delta;
 		mOffsetMax += delta;
-		mOwner->UpdateLayout();
+		mOwner->SetLayoutDirty();
 	}
 
 	Vec2F UIWidgetLayout::GetAbsolutePosition() const
 	{
+		UpdateOwnerLayoutIfDirty();
 		return mAbsoluteRect.LeftBottom() + mAbsoluteRect.Size()*mPivot;
 	}
 
 	void UIWidgetLayout::SetAbsoluteLeftTop(const Vec2F& absPosition)
 	{
+		UpdateOwnerLayoutIfDirty();
 		mOffsetMin.x += absPosition.x - mAbsoluteRect.left;
 		mOffsetMax.y += absPosition.y - mAbsoluteRect.top;
-		mOwner->UpdateLayout();
+		mOwner->SetLayoutDirty();
 	}
 
 	Vec2F UIWidgetLayout::GetAbsoluteLeftTop() const
 	{
+		UpdateOwnerLayoutIfDirty();
 		return mAbsoluteRect.LeftTop();
 	}
 
 	void UIWidgetLayout::SetAbsoluteLeftBottom(const Vec2F& absPosition)
 	{
+		UpdateOwnerLayoutIfDirty();
 		mOffsetMin.x += absPosition.x - mAbsoluteRect.left;
 		mOffsetMin.y += absPosition.y - mAbsoluteRect.bottom;
-		mOwner->UpdateLayout();
+		mOwner->SetLayoutDirty();
 	}
 
 	Vec2F UIWidgetLayout::GetAbsoluteLeftBottom() const
 	{
+		UpdateOwnerLayoutIfDirty();
 		return mAbsoluteRect.LeftBottom();
 	}
 
 	void UIWidgetLayout::SetAbsoluteRightTop(const Vec2F& absPosition)
 	{
+		UpdateOwnerLayoutIfDirty();
 		mOffsetMax.x += absPosition.x - mAbsoluteRect.right;
 		mOffsetMax.y += absPosition.y - mAbsoluteRect.top;
-		mOwner->UpdateLayout();
+		mOwner->SetLayoutDirty();
 	}
 
 	Vec2F UIWidgetLayout::GetAbsoluteRightTop() const
 	{
+		UpdateOwnerLayoutIfDirty();
 		return mAbsoluteRect.RightTop();
 	}
 
 	void UIWidgetLayout::SetAbsoluteRightBottom(const Vec2F& absPosition)
 	{
+		UpdateOwnerLayoutIfDirty();
 		mOffsetMax.x += absPosition.x - mAbsoluteRect.right;
 		mOffsetMin.y += absPosition.y - mAbsoluteRect.bottom;
-		mOwner->UpdateLayout();
+		mOwner->SetLayoutDirty();
 	}
 
 	Vec2F UIWidgetLayout::GetAbsoluteRightBottom() const
 	{
+		UpdateOwnerLayoutIfDirty();
 		return mAbsoluteRect.RightBottom();
 	}
 
 	void UIWidgetLayout::SetAbsoluteRect(const RectF& rect)
 	{
+		UpdateOwnerLayoutIfDirty();
 		mOffsetMin += rect.LeftBottom() - mAbsoluteRect.LeftBottom();
 		mOffsetMax += rect.RightTop() - mAbsoluteRect.RightTop();
-		mOwner->UpdateLayout();
+		mOwner->SetLayoutDirty();
 	}
 
 	RectF UIWidgetLayout::GetAbsoluteRect() const
 	{
+		UpdateOwnerLayoutIfDirty();
 		return mAbsoluteRect;
 	}
 
 	void UIWidgetLayout::SetPivot(const Vec2F& pivot)
 	{
 		mPivot = pivot;
-		mOwner->UpdateLayout();
+		mOwner->SetLayoutDirty();
 	}
 
 	Vec2F UIWidgetLayout::GetPivot() const
@@ -255,7 +282,7 @@ namespace o2
 	void UIWidgetLayout::SetPivotX(float x)
 	{
 		mPivot.x = x;
-		mOwner->UpdateLayout();
+		mOwner->SetLayoutDirty();
 	}
 
 	float UIWidgetLayout::GetPivotX() const
@@ -266,7 +293,7 @@ namespace o2
 	void UIWidgetLayout::SetPivotY(float y)
 	{
 		mPivot.y = y;
-		mOwner->UpdateLayout();
+		mOwner->SetLayoutDirty();
 	}
 
 	float UIWidgetLayout::GetPivotY() const
@@ -277,7 +304,7 @@ namespace o2
 	void UIWidgetLayout::SetAnchorMin(const Vec2F& min)
 	{
 		mAnchorMin = min;
-		mOwner->UpdateLayout();
+		mOwner->SetLayoutDirty();
 	}
 
 	Vec2F UIWidgetLayout::GetAnchorMin() const
@@ -288,7 +315,7 @@ namespace o2
 	void UIWidgetLayout::SetAnchorMax(const Vec2F& max)
 	{
 		mAnchorMax = max;
-		mOwner->UpdateLayout();
+		mOwner->SetLayoutDirty();
 	}
 
 	Vec2F UIWidgetLayout::GetAnchorMax() const
@@ -299,7 +326,7 @@ namespace o2
 	void UIWidgetLayout::SetAnchorLeft(float value)
 	{
 		mAnchorMin.x = value;
-		mOwner->UpdateLayout();
+		mOwner->SetLayoutDirty();
 	}
 
 	float UIWidgetLayout::GetAnchorLeft() const
@@ -310,7 +337,7 @@ namespace o2
 	void UIWidgetLayout::SetAnchorRight(float value)
 	{
 		mAnchorMax.x = value;
-		mOwner->UpdateLayout();
+		mOwner->SetLayoutDirty();
 	}
 
 	float UIWidgetLayout::GetAnchorRight() const
@@ -321,7 +348,7 @@ namespace o2
 	void UIWidgetLayout::SetAnchorBottom(float value)
 	{
 		mAnchorMin.y = value;
-		mOwner->UpdateLayout();
+		mOwner->SetLayoutDirty();
 	}
 
 	float UIWidgetLayout::GetAnchorBottom() const
@@ -332,7 +359,7 @@ namespace o2
 	void UIWidgetLayout::SetAnchorTop(float value)
 	{
 		mAnchorMax.y = value;
-		mOwner->UpdateLayout();
+		mOwner->SetLayoutDirty();
 	}
 
 	float UIWidgetLayout::GetAnchorTop() const
@@ -343,7 +370,7 @@ namespace o2
 	void UIWidgetLayout::SetOffsetMin(const Vec2F& min)
 	{
 		mOffsetMin = min;
-		mOwner->UpdateLayout();
+		mOwner->SetLayoutDirty();
 	}
 
 	Vec2F UIWidgetLayout::GetOffsetMin() const
@@ -354,7 +381,7 @@ namespace o2
 	void UIWidgetLayout::SetOffsetMax(const Vec2F& max)
 	{
 		mOffsetMax = max;
-		mOwner->UpdateLayout();
+		mOwner->SetLayoutDirty();
 	}
 
 	Vec2F UIWidgetLayout::GetOffsetMax() const
@@ -365,7 +392,7 @@ namespace o2
 	void UIWidgetLayout::SetOffsetLeft(float value)
 	{
 		mOffsetMin.x = value;
-		mOwner->UpdateLayout();
+		mOwner->SetLayoutDirty();
 	}
 
 	float UIWidgetLayout::GetOffsetLeft() const
@@ -376,7 +403,7 @@ namespace o2
 	void UIWidgetLayout::SetOffsetRight(float value)
 	{
 		mOffsetMax.x = value;
-		mOwner->UpdateLayout();
+		mOwner->SetLayoutDirty();
 	}
 
 	float UIWidgetLayout::GetOffsetRight() const
@@ -387,7 +414,7 @@ namespace o2
 	void UIWidgetLayout::SetOffsetBottom(float value)
 	{
 		mOffsetMin.y = value;
-		mOwner->UpdateLayout();
+		mOwner->SetLayoutDirty();
 	}
 
 	float UIWidgetLayout::GetOffsetBottom() const
@@ -398,7 +425,7 @@ namespace o2
 	void UIWidgetLayout::SetOffsetTop(float value)
 	{
 		mOffsetMax.y = value;
-		mOwner->UpdateLayout();
+		mOwner->SetLayoutDirty();
 	}
 
 	float UIWidgetLayout::GetOffsetTop() const
@@ -410,7 +437,7 @@ namespace o2
 	{
 		mMinSize = minSize;
 		mCheckMinMaxFunc = THIS_FUNC(CheckMinMax);
-		mOwner->UpdateLayout();
+		mOwner->SetLayoutDirty();
 	}
 
 	Vec2F UIWidgetLayout::GetMinimalSize() const
@@ -422,7 +449,7 @@ namespace o2
 	{
 		mMinSize.x = value;
 		mCheckMinMaxFunc = THIS_FUNC(CheckMinMax);
-		mOwner->UpdateLayout();
+		mOwner->SetLayoutDirty();
 	}
 
 	float UIWidgetLayout::GetMinimalWidth() const
@@ -434,7 +461,7 @@ namespace o2
 	{
 		mMinSize.y = value;
 		mCheckMinMaxFunc = THIS_FUNC(CheckMinMax);
-		mOwner->UpdateLayout();
+		mOwner->SetLayoutDirty();
 	}
 
 	float UIWidgetLayout::GetMinimalHeight() const
@@ -446,7 +473,7 @@ namespace o2
 	{
 		mMaxSize = maxSize;
 		mCheckMinMaxFunc = THIS_FUNC(CheckMinMax);
-		mOwner->UpdateLayout();
+		mOwner->SetLayoutDirty();
 	}
 
 	Vec2F UIWidgetLayout::GetMaximalSize() const
@@ -458,7 +485,7 @@ namespace o2
 	{
 		mMaxSize.x = value;
 		mCheckMinMaxFunc = THIS_FUNC(CheckMinMax);
-		mOwner->UpdateLayout();
+		mOwner->SetLayoutDirty();
 	}
 
 	float UIWidgetLayout::GetMaximalWidth() const
@@ -470,7 +497,7 @@ namespace o2
 	{
 		mMaxSize.y = value;
 		mCheckMinMaxFunc = THIS_FUNC(CheckMinMax);
-		mOwner->UpdateLayout();
+		mOwner->SetLayoutDirty();
 	}
 
 	float UIWidgetLayout::GetMaximalHeight() const
@@ -486,7 +513,7 @@ namespace o2
 	void UIWidgetLayout::SetWeight(const Vec2F& weight)
 	{
 		mWeight = weight;
-		mOwner->UpdateLayout();
+		mOwner->SetLayoutDirty();
 	}
 
 	Vec2F UIWidgetLayout::GetWeight() const
@@ -497,7 +524,7 @@ namespace o2
 	void UIWidgetLayout::SetWidthWeight(float widthWeigth)
 	{
 		mWeight.x = widthWeigth;
-		mOwner->UpdateLayout();
+		mOwner->SetLayoutDirty();
 	}
 
 	float UIWidgetLayout::GetWidthWeight()
@@ -508,7 +535,7 @@ namespace o2
 	void UIWidgetLayout::SetHeightWeight(float heigthWeigth)
 	{
 		mWeight.y = heigthWeigth;
-		mOwner->UpdateLayout();
+		mOwner->SetLayoutDirty();
 	}
 
 	float UIWidgetLayout::GetHeightWeight()
@@ -700,6 +727,12 @@ namespace o2
 	void UIWidgetLayout::DontCheckMinMax()
 	{}
 
+	void UIWidgetLayout::UpdateOwnerLayoutIfDirty() const
+	{
+		if (mOwner)
+			mOwner->UpdateLayoutIfDirty();
+	}
+
 	void UIWidgetLayout::InitializeProperties()
 	{
 		INITIALIZE_PROPERTY(UIWidgetLayout, pivot, SetPivot, GetPivot);
@@ -882,6 +915,7 @@ CLASS_META(o2::UIWidgetLayout)
 	PROTECTED_FUNCTION(void, CopyFrom, const UIWidgetLayout&);
 	PROTECTED_FUNCTION(void, CheckMinMax);
 	PROTECTED_FUNCTION(void, DontCheckMinMax);
+	PROTECTED_FUNCTION(void, UpdateOwnerLayoutIfDirty);
 	PROTECTED_FUNCTION(void, InitializeProperties);
 }
 END_META;
@@ -219,6 +219,7 @@ namespace o2
 		void CopyFrom(const UIWidgetLayout& other);
 		void CheckMinMax();
 		void DontCheckMinMax();
+		void UpdateOwnerLayoutIfDirty() const;
 		void InitializeProperties();
 
 		friend class UIContextMenu;
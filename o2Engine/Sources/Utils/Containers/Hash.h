@@ -0,0 +1,73 @@
+#pragma once
+
+#include <functional>
+#include "Utils/CommonTypes.h"
+
+namespace o2
+{
+	template<typename T>
+	class TString;
+
+	// Returns FNV-1a hash of bytes block
+	inline UInt HashBytes(const void* data, int size, UInt seed = 2166136261u)
+	{
+		const UInt8* bytes = (const UInt8*)data;
+		UInt res = seed;
+		for (int i = 0; i < size; i++)
+		{
+			res ^= bytes[i];
+			res *= 16777619u;
+		}
+
+		return res;
+	}
+
+	// Mixes bits of integer value, spreads close values over whole range
+	inline UInt HashInteger(UInt64 value)
+	{
+		value ^= value >> 33;
+		value *= 0xff51afd7ed558ccdULL;
+		value ^= value >> 33;
+		value *= 0xc4ceb9fe1a85ec53ULL;
+		value ^= value >> 33;
+
+		return (UInt)value;
+	}
+
+	// --------------------------------------------------------------------
+	// Hash function object. By default uses std::hash, specialized for
+	// pointers, strings and UID (see UID.h)
+	// --------------------------------------------------------------------
+	template<typename _type>
+	struct Hash
+	{
+		UInt operator()(const _type& value) const
+		{
+			return HashInteger((UInt64)std::hash<_type>()(value));
+		}
+	};
+
+	// ---------------------------------------------------------------------
+	// Pointers hash. Pointers are aligned, so low bits are mixed with high
+	// ---------------------------------------------------------------------
+	template<typename _type>
+	struct Hash<_type*>
+	{
+		UInt operator()(_type* value) const
+		{
+			return HashInteger((UInt64)value);
+		}
+	};
+
+	// ------------
+	// Strings hash
+	// ------------
+	template<typename T>
+	struct Hash<TString<T>>
+	{
+		UInt operator()(const TString<T>& value) const
+		{
+			return HashBytes(value.Data(), value.Length()*sizeof(T));
+		}
+	};
+}
@@ -0,0 +1,1079 @@
+#pragma once
+
+#include "Utils/Containers/Hash.h"
+#include "Utils/Containers/IDictionary.h"
+#include "Utils/Containers/Vector.h"
+
+namespace o2
+{
+	// -----------------------------------------------------------------------------------------
+	// Hash dictionary. Pairs are stored in insertion order in vector, so iteration order is
+	// stable and equal to Dictionary. Lookup goes through open-addressing table with linear
+	// probing, which stores pair indexes. Keys can't be changed through iterators and GetIdx.
+	// Removed pairs are released and left in place, pairs vector is compacted before next
+	// access by index or iteration, so removing keeps order and is constant time
+	// -----------------------------------------------------------------------------------------
+	template<typename _key_type, typename _value_type, typename _hasher = Hash<_key_type>>
+	class HashDictionary : public IDictionary<_key_type, _value_type>
+	{
+	public:
+		typedef typename IDictionary<_key_type, _value_type>::TKeyValue TKeyValue;
+
+		// --------
+		// Iterator
+		// --------
+		class Iterator
+		{
+			typedef typename Vector<TKeyValue>::Iterator PairIterator;
+
+			HashDictionary* mDictionary; // Owner dictionary
+			PairIterator    mPairIt;     // Pair iterator
+
+		public:
+			// Constructor
+			Iterator(HashDictionary* dictionary, int index = 0);
+
+			// Returns index of current element
+			int Index() const;
+
+			// Plus operator - moving element index right
+			Iterator  operator+(int offs) const;
+
+			// Plus and assign operator
+			Iterator& operator+=(int offs);
+
+			// Minus operator - moving element index left
+			Iterator  operator-(int offs) const;
+
+			// Minus and assign operator
+			Iterator& operator-=(int offs);
+
+			// Increment operator
+			Iterator& operator++();
+
+			// Post increment operator
+			Iterator  operator++(int);
+
+			// Decrement operator
+			Iterator& operator--();
+
+			// Post decrement operator
+			Iterator  operator--(int);
+
+			// Equal operator
+			bool operator==(const Iterator& itr) const;
+
+			// Not equal operator
+			bool operator!=(const Iterator& itr) const;
+
+			// Boolean cast operator. Return true if value is valid (in array range)
+			operator bool() const;
+
+			// Key access
+			const _key_type& Key();
+
+			// Value access
+			_value_type& Value();
+
+			// Pointer access operator (for range-based-for)
+			Iterator& operator*();
+		};
+
+		// -----------------
+		// Constant iterator
+		// -----------------
+		class ConstIterator
+		{
+			typedef typename Vector<TKeyValue>::ConstIterator PairIterator;
+
+			const HashDictionary* mDictionary; // Owner dictionary
+			PairIterator          mPairIt;     // Pair iterator
+
+		public:
+			// Constructor
+			ConstIterator(const HashDictionary* dictionary, int index = 0);
+
+			// Returns index of current element
+			int Index() const;
+
+			// Plus operator - moving element index right
+			ConstIterator  operator+(int offs) const;
+
+			// Plus and assign operator
+			ConstIterator& operator+=(int offs);
+
+			// Minus operator - moving element index left
+			ConstIterator  operator-(int offs) const;
+
+			// Minus and assign operator
+			ConstIterator& operator-=(int offs);
+
+			// Increment operator
+			ConstIterator& operator++();
+
+			// Post increment operator
+			ConstIterator  operator++(int);
+
+			// Decrement operator
+			ConstIterator& operator--();
+
+			// Post decrement operator
+			ConstIterator  operator--(int);
+
+			// Equal operator
+			bool operator==(const ConstIterator& itr) const;
+
+			// Not equal operator
+			bool operator!=(const ConstIterator& itr) const;
+
+			// Boolean cast operator. Return true if value is valid (in array range)
+			operator bool() const;
+
+			// Key access
+			const _key_type& Key() const;
+
+			// Value access
+			const _value_type& Value() const;
+
+			// Pointer access operator (for range-based-for)
+			const ConstIterator& operator*();
+		};
+
+	public:
+		// Default constructor
+		HashDictionary();
+
+		// Constructor with reserved capacity
+		explicit HashDictionary(int capacity);
+
+		// Copy-constructor
+		HashDictionary(const HashDictionary& other);
+
+		// Constructor from initializer list
+		HashDictionary(std::initializer_list<TKeyValue> init);
+
+		// Destructor
+		~HashDictionary();
+
+		// Check equals operator
+		bool operator==(const HashDictionary& other) const;
+
+		// Check not equals operator
+		bool operator!=(const HashDictionary& other) const;
+
+		// Copy-operator
+		HashDictionary& operator=(const HashDictionary& other);
+
+		// Adds element. Replaces value when key already exists
+		void Add(const _key_type& key, const _value_type& value);
+
+		// Adds element. Replaces value when key already exists
+		void Add(const TKeyValue& keyValue);
+
+		// Adds elements from other dictionary
+		void Add(const HashDictionary& other);
+
+		// Removes element by key in constant time. Keeps order of other elements
+		void Remove(const _key_type& key);
+
+		// Removes element by key in constant time. Last element takes it's place, so order isn't kept
+		void RemoveUnordered(const _key_type& key);
+
+		// Removes all which pass function
+		void RemoveAll(const Function<bool(const TKeyValue&)>& match);
+
+		// Removes all elements
+		void Clear();
+
+		// Reserves space for specified count of elements without rehashing
+		void Reserve(int capacity);
+
+		// Returns true if contains element with specified key
+		bool ContainsKey(const _key_type& key) const;
+
+		// Returns true if contains element with specified value
+		bool ContainsValue(const _value_type& value) const;
+
+		// Returns true if contains same element
+		bool Contains(const TKeyValue& keyValue) const;
+
+		// Returns true if contains element which pass function
+		bool ContainsPred(const Function<bool(const TKeyValue&)>& match) const;
+
+		// Returns element by key
+		TKeyValue FindKey(const _key_type& key) const;
+
+		// Returns element by value
+		TKeyValue FindValue(const _value_type& value) const;
+
+		// Returns first element which pass function
+		TKeyValue Find(const Function<bool(const TKeyValue&)>& match) const;
+
+		// Returns last element which pass function
+		TKeyValue FindLast(const Function<bool(const TKeyValue&)>& match) const;
+
+		// Returns first element which pass function
+		TKeyValue First(const Function<bool(const TKeyValue&)>& match) const;
+
+		// Returns last element which pass function
+		TKeyValue Last(const Function<bool(const TKeyValue&)>& match) const;
+
+		// Sets value by key. Adds element when key not exists
+		void Set(const _key_type& key, const _value_type& value);
+
+		// Returns value reference by key
+		_value_type& Get(const _key_type& key);
+
+		// Returns constant value reference by key
+		const _value_type& Get(const _key_type& key) const;
+
+		// Tries to get value by key, returns true if found
+		bool TryGetValue(const _key_type& key, _value_type& output) const;
+
+		// Returns pointer to value by key, or nullptr when not found
+		_value_type* TryGet(const _key_type& key);
+
+		// Returns constant pointer to value by key, or nullptr when not found
+		const _value_type* TryGet(const _key_type& key) const;
+
+		// Returns pair by index
+		const TKeyValue& GetIdx(int index) const;
+
+		// Returns count of elements
+		int Count() const;
+
+		// Returns count of elements which pass function
+		int Count(const Function<bool(const TKeyValue&)>& match) const;
+
+		// Returns true when no elements
+		bool IsEmpty() const;
+
+		// Sorts element by predicate
+		void Sort(const Function<bool(const TKeyValue&, const TKeyValue&)>& pred);
+
+		// Invokes function for all elements
+		void ForEach(const Function<void(TKeyValue&)>& func);
+
+		// Returns true when all elements pass function
+		bool All(const Function<bool(const TKeyValue&)>& match) const;
+
+		// Returns true when any of elements pass function
+		bool Any(const Function<bool(const TKeyValue&)>& match) const;
+
+		// Returns begin iterator
+		Iterator Begin();
+
+		// Returns end iterator
+		Iterator End();
+
+		// Returns constant begin iterator
+		ConstIterator Begin() const;
+
+		// Returns constant end iterator
+		ConstIterator End() const;
+
+		// Returns begin iterator (for range-based-for)
+		Iterator begin() { return Begin(); }
+
+		// Returns end iterator (for range-based-for)
+		Iterator end() { return End(); }
+
+		// Returns constant begin iterator (for range-based-for)
+		ConstIterator begin() const { return Begin(); }
+
+		// Returns constant end iterator (for range-based-for)
+		ConstIterator end() const { return End(); }
+
+	protected:
+		static const int mEmptySlot = -1;   // Empty slot index mark
+		static const int mMinSlots = 8;     // Minimal slots table size
+
+		mutable Vector<TKeyValue> mPairs;            // Key-value pairs vector in insertion order, with removed pairs until compacting
+		mutable int               mRemovedCount = 0; // Count of removed pairs in mPairs, they aren't referenced from slots
+		int*                      mSlots = nullptr;  // Open-addressing table of pairs indexes, mEmptySlot when empty
+		UInt*                     mHashes = nullptr; // Hashes of keys, parallel to mSlots
+		int                       mSlotsCount = 0;   // Size of slots table, power of two
+
+	protected:
+		// Returns slot index with key, or -1
+		int FindSlot(const _key_type& key, UInt hash) const;
+
+		// Returns pair index by key, or -1
+		int FindIdx(const _key_type& key) const;
+
+		// Puts pair index into first free slot by hash
+		void InsertSlot(int pairIdx, UInt hash);
+
+		// Removes slot and shifts following slots of cluster back
+		void EraseSlot(int slot);
+
+		// Removes removed pairs from the end of pairs vector
+		void TrimRemovedPairs();
+
+		// Removes all removed pairs from pairs vector, keeping order of others, and updates slots pairs indexes
+		void CompactPairs() const;
+
+		// Reallocates slots table with new size and puts all pairs into it
+		void Rehash(int slotsCount);
+
+		// Returns slots count required for elements count
+		int GetSlotsCount(int elementsCount) const;
+	};
+
+#pragma region HashDictionary::Iterator implementation
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	HashDictionary<_key_type, _value_type, _hasher>::Iterator::Iterator(HashDictionary* dictionary, int index /*= 0*/):
+		mDictionary(dictionary), mPairIt(mDictionary->mPairs.Begin() + index)
+	{}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	int HashDictionary<_key_type, _value_type, _hasher>::Iterator::Index() const
+	{
+		return mPairIt.Index();
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	typename HashDictionary<_key_type, _value_type, _hasher>::Iterator HashDictionary<_key_type, _value_type, _hasher>::Iterator::operator+(int offs) const
+	{
+		return Iterator(mDictionary, Index() + offs);
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	typename HashDictionary<_key_type, _value_type, _hasher>::Iterator& HashDictionary<_key_type, _value_type, _hasher>::Iterator::operator+=(int offs)
+	{
+		mPairIt += offs;
+		return *this;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	typename HashDictionary<_key_type, _value_type, _hasher>::Iterator HashDictionary<_key_type, _value_type, _hasher>::Iterator::operator-(int offs) const
+	{
+		return Iterator(mDictionary, Index() - offs);
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	typename HashDictionary<_key_type, _value_type, _hasher>::Iterator& HashDictionary<_key_type, _value_type, _hasher>::Iterator::operator-=(int offs)
+	{
+		mPairIt -= offs;
+		return *this;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	typename HashDictionary<_key_type, _value_type, _hasher>::Iterator& HashDictionary<_key_type, _value_type, _hasher>::Iterator::operator++() // ++A;
+	{
+		mPairIt++;
+		return *this;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	typename HashDictionary<_key_type, _value_type, _hasher>::Iterator HashDictionary<_key_type, _value_type, _hasher>::Iterator::operator++(int) // A++;
+	{
+		Iterator temp = *this;
+		mPairIt++;
+		return temp;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	typename HashDictionary<_key_type, _value_type, _hasher>::Iterator& HashDictionary<_key_type, _value_type, _hasher>::Iterator::operator--() // --A;
+	{
+		mPairIt--;
+		return *this;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	typename HashDictionary<_key_type, _value_type, _hasher>::Iterator HashDictionary<_key_type, _value_type, _hasher>::Iterator::operator--(int) // A--;
+	{
+		Iterator temp = *this;
+		mPairIt--;
+		return temp;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	bool HashDictionary<_key_type, _value_type, _hasher>::Iterator::operator==(const Iterator& itr) const
+	{
+		return mPairIt == itr.mPairIt;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	bool HashDictionary<_key_type, _value_type, _hasher>::Iterator::operator!=(const Iterator& itr) const
+	{
+		return mPairIt != itr.mPairIt;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	HashDictionary<_key_type, _value_type, _hasher>::Iterator::operator bool() const
+	{
+		return mPairIt.IsValid();
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	const _key_type& HashDictionary<_key_type, _value_type, _hasher>::Iterator::Key()
+	{
+		return mPairIt.Value().mKey;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	_value_type& HashDictionary<_key_type, _value_type, _hasher>::Iterator::Value()
+	{
+		return mPairIt.Value().mValue;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	typename HashDictionary<_key_type, _value_type, _hasher>::Iterator& HashDictionary<_key_type, _value_type, _hasher>::Iterator::operator*()
+	{
+		return *this;
+	}
+
+#pragma endregion HashDictionary::Iterator implementation
+
+#pragma region HashDictionary::ConstIterator implementation
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	HashDictionary<_key_type, _value_type, _hasher>::ConstIterator::ConstIterator(const HashDictionary* dictionary, int index /*= 0*/):
+		mDictionary(dictionary), mPairIt(mDictionary->mPairs.Begin() + index)
+	{}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	int HashDictionary<_key_type, _value_type, _hasher>::ConstIterator::Index() const
+	{
+		return mPairIt.Index();
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	typename HashDictionary<_key_type, _value_type, _hasher>::ConstIterator HashDictionary<_key_type, _value_type, _hasher>::ConstIterator::operator+(int offs) const
+	{
+		return ConstIterator(mDictionary, Index() + offs);
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	typename HashDictionary<_key_type, _value_type, _hasher>::ConstIterator& HashDictionary<_key_type, _value_type, _hasher>::ConstIterator::operator+=(int offs)
+	{
+		mPairIt += offs;
+		return *this;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	typename HashDictionary<_key_type, _value_type, _hasher>::ConstIterator HashDictionary<_key_type, _value_type, _hasher>::ConstIterator::operator-(int offs) const
+	{
+		return ConstIterator(mDictionary, Index() - offs);
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	typename HashDictionary<_key_type, _value_type, _hasher>::ConstIterator& HashDictionary<_key_type, _value_type, _hasher>::ConstIterator::operator-=(int offs)
+	{
+		mPairIt -= offs;
+		return *this;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	typename HashDictionary<_key_type, _value_type, _hasher>::ConstIterator& HashDictionary<_key_type, _value_type, _hasher>::ConstIterator::operator++() // ++A;
+	{
+		mPairIt++;
+		return *this;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	typename HashDictionary<_key_type, _value_type, _hasher>::ConstIterator HashDictionary<_key_type, _value_type, _hasher>::ConstIterator::operator++(int) // A++;
+	{
+		ConstIterator temp = *this;
+		mPairIt++;
+		return temp;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	typename HashDictionary<_key_type, _value_type, _hasher>::ConstIterator& HashDictionary<_key_type, _value_type, _hasher>::ConstIterator::operator--() // --A;
+	{
+		mPairIt--;
+		return *this;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	typename HashDictionary<_key_type, _value_type, _hasher>::ConstIterator HashDictionary<_key_type, _value_type, _hasher>::ConstIterator::operator--(int) // A--;
+	{
+		ConstIterator temp = *this;
+		mPairIt--;
+		return temp;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	bool HashDictionary<_key_type, _value_type, _hasher>::ConstIterator::operator==(const ConstIterator& itr) const
+	{
+		return mPairIt == itr.mPairIt;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	bool HashDictionary<_key_type, _value_type, _hasher>::ConstIterator::operator!=(const ConstIterator& itr) const
+	{
+		return mPairIt != itr.mPairIt;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	HashDictionary<_key_type, _value_type, _hasher>::ConstIterator::operator bool() const
+	{
+		return mPairIt.IsValid();
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	const _key_type& HashDictionary<_key_type, _value_type, _hasher>::ConstIterator::Key() const
+	{
+		return mPairIt.Value().mKey;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	const _value_type& HashDictionary<_key_type, _value_type, _hasher>::ConstIterator::Value() const
+	{
+		return mPairIt.Value().mValue;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	const typename HashDictionary<_key_type, _value_type, _hasher>::ConstIterator& HashDictionary<_key_type, _value_type, _hasher>::ConstIterator::operator*()
+	{
+		return *this;
+	}
+
+#pragma endregion HashDictionary::ConstIterator implementation
+
+#pragma region HashDictionary implementation
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	HashDictionary<_key_type, _value_type, _hasher>::HashDictionary()
+	{}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	HashDictionary<_key_type, _value_type, _hasher>::HashDictionary(int capacity)
+	{
+		Reserve(capacity);
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	HashDictionary<_key_type, _value_type, _hasher>::HashDictionary(const HashDictionary& other)
+	{
+		other.CompactPairs();
+		mPairs = other.mPairs;
+		Rehash(other.mSlotsCount);
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	HashDictionary<_key_type, _value_type, _hasher>::HashDictionary(std::initializer_list<TKeyValue> init)
+	{
+		Reserve((int)init.size());
+		for (auto& elem : init)
+			Add(elem);
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	HashDictionary<_key_type, _value_type, _hasher>::~HashDictionary()
+	{
+		if (mSlots)
+		{
+			mfree(mSlots);
+			mfree(mHashes);
+		}
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	bool HashDictionary<_key_type, _value_type, _hasher>::operator==(const HashDictionary& other) const
+	{
+		CompactPairs();
+		other.CompactPairs();
+
+		return mPairs == other.mPairs;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	bool HashDictionary<_key_type, _value_type, _hasher>::operator!=(const HashDictionary& other) const
+	{
+		return !(*this == other);
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	HashDictionary<_key_type, _value_type, _hasher>& HashDictionary<_key_type, _value_type, _hasher>::operator=(const HashDictionary& other)
+	{
+		if (this == &other)
+			return *this;
+
+		other.CompactPairs();
+		mPairs = other.mPairs;
+		mRemovedCount = 0;
+		Rehash(other.mSlotsCount);
+
+		return *this;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	void HashDictionary<_key_type, _value_type, _hasher>::Add(const _key_type& key, const _value_type& value)
+	{
+		UInt hash = _hasher()(key);
+		int slot = FindSlot(key, hash);
+		if (slot >= 0)
+		{
+			mPairs[mSlots[slot]].mValue = value;
+			return;
+		}
+
+		if (GetSlotsCount(Count() + 1) > mSlotsCount)
+			Rehash(GetSlotsCount(Count() + 1));
+
+		mPairs.Add(TKeyValue(key, value));
+		InsertSlot(mPairs.Count() - 1, hash);
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	void HashDictionary<_key_type, _value_type, _hasher>::Add(const TKeyValue& keyValue)
+	{
+		Add(keyValue.mKey, keyValue.mValue);
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	void HashDictionary<_key_type, _value_type, _hasher>::Add(const HashDictionary& other)
+	{
+		Reserve(Count() + other.Count());
+
+		other.CompactPairs();
+		for (auto& kv : other.mPairs)
+			Add(kv.mKey, kv.mValue);
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	void HashDictionary<_key_type, _value_type, _hasher>::Remove(const _key_type& key)
+	{
+		int slot = FindSlot(key, _hasher()(key));
+		if (slot < 0)
+			return;
+
+		int idx = mSlots[slot];
+		EraseSlot(slot);
+
+		// Pair is released and left in place instead of shifting following pairs and their slots
+		mPairs[idx] = TKeyValue();
+		mRemovedCount++;
+
+		TrimRemovedPairs();
+
+		if (mRemovedCount > Count())
+			CompactPairs();
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	void HashDictionary<_key_type, _value_type, _hasher>::RemoveUnordered(const _key_type& key)
+	{
+		int slot = FindSlot(key, _hasher()(key));
+		if (slot < 0)
+			return;
+
+		// Last pair must be alive to take place of removed
+		TrimRemovedPairs();
+
+		int idx = mSlots[slot];
+		EraseSlot(slot);
+
+		int lastIdx = mPairs.Count() - 1;
+		if (idx != lastIdx)
+		{
+			const _key_type& lastKey = mPairs[lastIdx].mKey;
+			mSlots[FindSlot(lastKey, _hasher()(lastKey))] = idx;
+			mPairs[idx] = mPairs[lastIdx];
+		}
+
+		mPairs.RemoveAt(lastIdx);
+		TrimRemovedPairs();
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	void HashDictionary<_key_type, _value_type, _hasher>::RemoveAll(const Function<bool(const TKeyValue&)>& match)
+	{
+		CompactPairs();
+		mPairs.RemoveAll(match);
+		Rehash(mSlotsCount);
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	void HashDictionary<_key_type, _value_type, _hasher>::Clear()
+	{
+		mPairs.Clear();
+		mRemovedCount = 0;
+
+		for (int i = 0; i < mSlotsCount; i++)
+			mSlots[i] = mEmptySlot;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	void HashDictionary<_key_type, _value_type, _hasher>::Reserve(int capacity)
+	{
+		mPairs.Reserve(capacity);
+
+		int slotsCount = GetSlotsCount(capacity);
+		if (slotsCount > mSlotsCount)
+			Rehash(slotsCount);
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	bool HashDictionary<_key_type, _value_type, _hasher>::ContainsKey(const _key_type& key) const
+	{
+		return FindIdx(key) >= 0;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	bool HashDictionary<_key_type, _value_type, _hasher>::ContainsValue(const _value_type& value) const
+	{
+		CompactPairs();
+
+		for (auto& kv : mPairs)
+		{
+			if (kv.mValue == value)
+				return true;
+		}
+
+		return false;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	bool HashDictionary<_key_type, _value_type, _hasher>::Contains(const TKeyValue& keyValue) const
+	{
+		int idx = FindIdx(keyValue.mKey);
+		return idx >= 0 && mPairs[idx].mValue == keyValue.mValue;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	bool HashDictionary<_key_type, _value_type, _hasher>::ContainsPred(const Function<bool(const TKeyValue&)>& match) const
+	{
+		CompactPairs();
+		return mPairs.ContainsPred(match);
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	typename HashDictionary<_key_type, _value_type, _hasher>::TKeyValue HashDictionary<_key_type, _value_type, _hasher>::FindKey(const _key_type& key) const
+	{
+		int idx = FindIdx(key);
+		if (idx >= 0)
+			return mPairs[idx];
+
+		return TKeyValue();
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	typename HashDictionary<_key_type, _value_type, _hasher>::TKeyValue HashDictionary<_key_type, _value_type, _hasher>::FindValue(const _value_type& value) const
+	{
+		CompactPairs();
+
+		for (auto& kv : mPairs)
+		{
+			if (kv.mValue == value)
+				return kv;
+		}
+
+		return TKeyValue();
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	typename HashDictionary<_key_type, _value_type, _hasher>::TKeyValue HashDictionary<_key_type, _value_type, _hasher>::Find(const Function<bool(const TKeyValue&)>& match) const
+	{
+		CompactPairs();
+		return mPairs.FindMatch(match);
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	typename HashDictionary<_key_type, _value_type, _hasher>::TKeyValue HashDictionary<_key_type, _value_type, _hasher>::FindLast(const Function<bool(const TKeyValue&)>& match) const
+	{
+		CompactPairs();
+		return mPairs.Last(match);
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	typename HashDictionary<_key_type, _value_type, _hasher>::TKeyValue HashDictionary<_key_type, _value_type, _hasher>::First(const Function<bool(const TKeyValue&)>& match) const
+	{
+		CompactPairs();
+		return mPairs.First(match);
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	typename HashDictionary<_key_type, _value_type, _hasher>::TKeyValue HashDictionary<_key_type, _value_type, _hasher>::Last(const Function<bool(const TKeyValue&)>& match) const
+	{
+		CompactPairs();
+		return mPairs.Last(match);
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	void HashDictionary<_key_type, _value_type, _hasher>::Set(const _key_type& key, const _value_type& value)
+	{
+		Add(key, value);
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	_value_type& HashDictionary<_key_type, _value_type, _hasher>::Get(const _key_type& key)
+	{
+		int idx = FindIdx(key);
+		Assert(idx >= 0, "Failed to get value from dictionary: not found key");
+
+		return mPairs[idx].mValue;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	const _value_type& HashDictionary<_key_type, _value_type, _hasher>::Get(const _key_type& key) const
+	{
+		int idx = FindIdx(key);
+		Assert(idx >= 0, "Failed to get value from dictionary: not found key");
+
+		return mPairs[idx].mValue;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	bool HashDictionary<_key_type, _value_type, _hasher>::TryGetValue(const _key_type& key, _value_type& output) const
+	{
+		int idx = FindIdx(key);
+		if (idx < 0)
+			return false;
+
+		output = mPairs[idx].mValue;
+		return true;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	_value_type* HashDictionary<_key_type, _value_type, _hasher>::TryGet(const _key_type& key)
+	{
+		int idx = FindIdx(key);
+		return idx >= 0 ? &mPairs[idx].mValue : nullptr;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	const _value_type* HashDictionary<_key_type, _value_type, _hasher>::TryGet(const _key_type& key) const
+	{
+		int idx = FindIdx(key);
+		return idx >= 0 ? &mPairs[idx].mValue : nullptr;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	const typename HashDictionary<_key_type, _value_type, _hasher>::TKeyValue& HashDictionary<_key_type, _value_type, _hasher>::GetIdx(int index) const
+	{
+		CompactPairs();
+		return mPairs.Get(index);
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	int HashDictionary<_key_type, _value_type, _hasher>::Count() const
+	{
+		return mPairs.Count() - mRemovedCount;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	int HashDictionary<_key_type, _value_type, _hasher>::Count(const Function<bool(const TKeyValue&)>& match) const
+	{
+		CompactPairs();
+		return mPairs.CountMatch(match);
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	bool HashDictionary<_key_type, _value_type, _hasher>::IsEmpty() const
+	{
+		return mPairs.Count() == 0;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	void HashDictionary<_key_type, _value_type, _hasher>::Sort(const Function<bool(const TKeyValue&, const TKeyValue&)>& pred)
+	{
+		CompactPairs();
+		mPairs.Sort(pred);
+		Rehash(mSlotsCount);
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	void HashDictionary<_key_type, _value_type, _hasher>::ForEach(const Function<void(TKeyValue&)>& func)
+	{
+		CompactPairs();
+
+		for (auto& kv : mPairs)
+			func(kv);
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	bool HashDictionary<_key_type, _value_type, _hasher>::All(const Function<bool(const TKeyValue&)>& match) const
+	{
+		CompactPairs();
+		return mPairs.All(match);
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	bool HashDictionary<_key_type, _value_type, _hasher>::Any(const Function<bool(const TKeyValue&)>& match) const
+	{
+		CompactPairs();
+		return mPairs.Any(match);
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	typename HashDictionary<_key_type, _value_type, _hasher>::Iterator HashDictionary<_key_type, _value_type, _hasher>::Begin()
+	{
+		CompactPairs();
+		return Iterator(this, 0);
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	typename HashDictionary<_key_type, _value_type, _hasher>::Iterator HashDictionary<_key_type, _value_type, _hasher>::End()
+	{
+		CompactPairs();
+		return Iterator(this, Count());
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	typename HashDictionary<_key_type, _value_type, _hasher>::ConstIterator HashDictionary<_key_type, _value_type, _hasher>::Begin() const
+	{
+		CompactPairs();
+		return ConstIterator(this, 0);
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	typename HashDictionary<_key_type, _value_type, _hasher>::ConstIterator HashDictionary<_key_type, _value_type, _hasher>::End() const
+	{
+		CompactPairs();
+		return ConstIterator(this, Count());
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	int HashDictionary<_key_type, _value_type, _hasher>::FindSlot(const _key_type& key, UInt hash) const
+	{
+		if (mSlotsCount == 0)
+			return -1;
+
+		int mask = mSlotsCount - 1;
+		for (int slot = hash & mask; ; slot = (slot + 1) & mask)
+		{
+			int idx = mSlots[slot];
+			if (idx == mEmptySlot)
+				return -1;
+
+			if (mHashes[slot] == hash && mPairs[idx].mKey == key)
+				return slot;
+		}
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	int HashDictionary<_key_type, _value_type, _hasher>::FindIdx(const _key_type& key) const
+	{
+		int slot = FindSlot(key, _hasher()(key));
+		return slot >= 0 ? mSlots[slot] : -1;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	void HashDictionary<_key_type, _value_type, _hasher>::InsertSlot(int pairIdx, UInt hash)
+	{
+		int mask = mSlotsCount - 1;
+		int slot = hash & mask;
+		while (mSlots[slot] != mEmptySlot)
+			slot = (slot + 1) & mask;
+
+		mSlots[slot] = pairIdx;
+		mHashes[slot] = hash;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	void HashDictionary<_key_type, _value_type, _hasher>::EraseSlot(int slot)
+	{
+		int mask = mSlotsCount - 1;
+		int hole = slot;
+		for (int next = (hole + 1) & mask; mSlots[next] != mEmptySlot; next = (next + 1) & mask)
+		{
+			int home = mHashes[next] & mask;
+
+			// Moving element back when its home slot is not in (hole, next] cyclic range
+			bool inRange = hole <= next ? (home > hole && home <= next) : (home > hole || home <= next);
+			if (!inRange)
+			{
+				mSlots[hole] = mSlots[next];
+				mHashes[hole] = mHashes[next];
+				hole = next;
+			}
+		}
+
+		mSlots[hole] = mEmptySlot;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	void HashDictionary<_key_type, _value_type, _hasher>::TrimRemovedPairs()
+	{
+		// Last pair is removed when it's key isn't found at last index
+		while (mRemovedCount > 0 && FindIdx(mPairs.Last().mKey) != mPairs.Count() - 1)
+		{
+			mPairs.PopBack();
+			mRemovedCount--;
+		}
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	void HashDictionary<_key_type, _value_type, _hasher>::CompactPairs() const
+	{
+		if (mRemovedCount == 0)
+			return;
+
+		// Removed pairs aren't referenced from slots, so pairs without slot are skipped
+		Vector<int> pairsSlots;
+		pairsSlots.Resize(mPairs.Count());
+		for (int i = 0; i < pairsSlots.Count(); i++)
+			pairsSlots[i] = mEmptySlot;
+
+		for (int i = 0; i < mSlotsCount; i++)
+		{
+			if (mSlots[i] != mEmptySlot)
+				pairsSlots[mSlots[i]] = i;
+		}
+
+		int count = 0;
+		for (int i = 0; i < mPairs.Count(); i++)
+		{
+			if (pairsSlots[i] == mEmptySlot)
+				continue;
+
+			if (count != i)
+				mPairs[count] = mPairs[i];
+
+			mSlots[pairsSlots[i]] = count++;
+		}
+
+		mPairs.RemoveRange(count, mPairs.Count());
+		mRemovedCount = 0;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	void HashDictionary<_key_type, _value_type, _hasher>::Rehash(int slotsCount)
+	{
+		CompactPairs();
+
+		slotsCount = Math::Max(slotsCount, GetSlotsCount(mPairs.Count()));
+
+		if (slotsCount > 0 && slotsCount != mSlotsCount)
+		{
+			if (mSlots)
+			{
+				mfree(mSlots);
+				mfree(mHashes);
+			}
+
+			mSlotsCount = slotsCount;
+			mSlots = (int*)mmalloc(sizeof(int)*mSlotsCount);
+			mHashes = (UInt*)mmalloc(sizeof(UInt)*mSlotsCount);
+		}
+
+		for (int i = 0; i < mSlotsCount; i++)
+			mSlots[i] = mEmptySlot;
+
+		int count = mPairs.Count();
+		for (int i = 0; i < count; i++)
+			InsertSlot(i, _hasher()(mPairs[i].mKey));
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	int HashDictionary<_key_type, _value_type, _hasher>::GetSlotsCount(int elementsCount) const
+	{
+		if (elementsCount == 0)
+			return 0;
+
+		// Keeping load factor not greater than 0.5
+		int res = mMinSlots;
+		while (res < elementsCount*2)
+			res *= 2;
+
+		return res;
+	}
+
+#pragma endregion HashDictionary implementation
+
+}
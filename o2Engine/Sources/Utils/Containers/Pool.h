@@ -1,23 +1,29 @@
 #pragma once
 
+#include <new>
+#include <type_traits>
+#include <utility>
 #include "Utils/Containers/Vector.h"
 
 namespace o2
 {
-	// ----------------------
-	// Pool objects container
-	// ----------------------
+	// -------------------------------------------------------------------------------
+	// Pool objects container. Objects are stored in contiguous chunks, free slots
+	// are linked into intrusive free list. Take/Free recycles constructed objects:
+	// object is constructed once and keeps it's state between Take calls.
+	// Construct/Destroy constructs object in place and destroys it when freeing.
+	// Pool owns memory of all objects, so objects can't outlive pool. Only objects
+	// taken from this pool can be freed into it
+	// -------------------------------------------------------------------------------
 	template<typename _type>
 	class Pool
 	{
-		Vector<_type*> mObjects;   // Cached objects
-		int            mChunkSize; // Cache resize size
-
 	public:
 		// Constructor
 		Pool(int initialCount = 5, int chunkSize = 5);
 
-		// Destructor
+		// Destructor. Destroys all constructed objects and frees chunks. All taken objects must be freed
+		// before, otherwise pointers to them becomes dangling
 		~Pool();
 
 		// Sets chunk size - cache resize size
@@ -26,20 +32,89 @@ namespace o2
 		// Returns chunk size - cache resize size
 		int  GetChunkSize() const;
 
-		// Takes object from cached and returns him
+		// Takes object from cached and returns him. Object is default constructed when slot is empty
 		_type* Take();
 
-		// Frees object and puts into cached
+		// Frees object and puts into cached. Object is not destroyed and will be returned by Take.
+		// Object must be taken from this pool
 		void Free(_type* obj);
 
+		// Takes free slot and constructs object in place with arguments
+		template<typename ... _args>
+		_type* Construct(_args&& ... args);
+
+		// Destroys object and returns it's slot into pool
+		void Destroy(_type* obj);
+
 		// Creates cached object
 		void CreateObjects(int count);
-	};
 
+		// Releases chunks with all slots free. Returns count of released slots
+		int Trim();
+
+		// Returns count of objects taken from pool
+		int GetUsedCount() const;
+
+		// Returns count of all slots in pool
+		int GetCapacity() const;
+
+		// Returns true when object is placed in this pool's chunks
+		bool IsPoolObject(const _type* obj) const;
+
+	protected:
+		struct Chunk;
+
+		// -------------------------------------------------------
+		// Object slot. Storage is first, so object pointer is slot
+		// pointer
+		// -------------------------------------------------------
+		struct Slot
+		{
+			typename std::aligned_storage<sizeof(_type), std::alignment_of<_type>::value>::type data; // Object storage
+
+			Slot*  nextFree;    // Next free slot in free list
+			Chunk* chunk;       // Owner chunk
+			bool   constructed; // Is object constructed in storage
+			bool   used;        // Is slot taken from pool
+
+		public:
+			// Returns object pointer
+			_type* Object() { return reinterpret_cast<_type*>(&data); }
+		};
+
+		// ---------------------------
+		// Contiguous block of slots
+		// ---------------------------
+		struct Chunk
+		{
+			Slot* slots;     // Slots array
+			int   count;     // Count of slots
+			int   usedCount; // Count of taken slots
+		};
+
+		Vector<Chunk*> mChunks;    // Allocated chunks
+		Slot*          mFreeList;  // Head of free slots list
+		int            mChunkSize; // Cache resize size
+		int            mUsedCount; // Count of taken objects
+		int            mCapacity;  // Count of all slots
+
+	protected:
+		// Allocates new chunk and puts it's slots into free list
+		void AllocateChunk(int count);
+
+		// Pops free slot, allocates new chunk when no free slots
+		Slot* PopFreeSlot();
+
+		// Returns slot into free list
+		void PushFreeSlot(Slot* slot);
+
+		// Returns slot by object pointer
+		static Slot* GetSlot(_type* obj);
+	};
 
 	template<typename _type>
 	Pool<_type>::Pool(int initialCount /*= 5*/, int chunkSize /*= 5*/):
-		mChunkSize(chunkSize)
+		mFreeList(nullptr), mChunkSize(chunkSize), mUsedCount(0), mCapacity(0)
 	{
 		CreateObjects(initialCount);
 	}
@@ -47,10 +122,21 @@ namespace o2
 	template<typename _type>
 	Pool<_type>::~Pool()
 	{
-		for (int i = 0; i < mObjects.Count(); i++)
-			delete mObjects[i];
+		Assert(mUsedCount == 0, "Pool destroyed with taken objects");
+
+		for (auto chunk : mChunks)
+		{
+			for (int i = 0; i < chunk->count; i++)
+			{
+				if (chunk->slots[i].constructed)
+					chunk->slots[i].Object()->~_type();
+			}
 
-		mObjects.Clear();
+			mfree(chunk->slots);
+			delete chunk;
+		}
+
+		mChunks.Clear();
 	}
 
 	template<typename _type>
@@ -68,22 +154,204 @@ namespace o2
 	template<typename _type>
 	_type* Pool<_type>::Take()
 	{
-		if (mObjects.Count() == 0)
-			CreateObjects(mChunkSize);
+		Slot* slot = PopFreeSlot();
+
+		if (!slot->constructed)
+		{
+			new (&slot->data) _type();
+			slot->constructed = true;
+		}
 
-		return mObjects.PopBack();
+		return slot->Object();
 	}
 
 	template<typename _type>
 	void Pool<_type>::Free(_type* obj)
 	{
-		mObjects.Add(obj);
+#ifdef DEBUG
+		Assert(IsPoolObject(obj), "Object wasn't taken from this pool");
+#endif
+
+		PushFreeSlot(GetSlot(obj));
+	}
+
+	template<typename _type>
+	template<typename ... _args>
+	_type* Pool<_type>::Construct(_args&& ... args)
+	{
+		Slot* slot = PopFreeSlot();
+
+		if (slot->constructed)
+			slot->Object()->~_type();
+
+		new (&slot->data) _type(std::forward<_args>(args) ...);
+		slot->constructed = true;
+
+		return slot->Object();
+	}
+
+	template<typename _type>
+	void Pool<_type>::Destroy(_type* obj)
+	{
+#ifdef DEBUG
+		Assert(IsPoolObject(obj), "Object wasn't taken from this pool");
+#endif
+
+		Slot* slot = GetSlot(obj);
+
+		obj->~_type();
+		slot->constructed = false;
+
+		PushFreeSlot(slot);
 	}
 
 	template<typename _type>
 	void Pool<_type>::CreateObjects(int count)
 	{
-		for (int i = 0; i < count; i++)
-			mObjects.Add(mnew _type());
+		if (count <= 0)
+			return;
+
+		AllocateChunk(count);
+
+		Chunk* chunk = mChunks.Last();
+		for (int i = 0; i < chunk->count; i++)
+		{
+			new (&chunk->slots[i].data) _type();
+			chunk->slots[i].constructed = true;
+		}
+	}
+
+	template<typename _type>
+	int Pool<_type>::Trim()
+	{
+		int released = 0;
+
+		for (int i = mChunks.Count() - 1; i >= 0; i--)
+		{
+			Chunk* chunk = mChunks[i];
+			if (chunk->usedCount > 0)
+				continue;
+
+			for (int j = 0; j < chunk->count; j++)
+			{
+				if (chunk->slots[j].constructed)
+					chunk->slots[j].Object()->~_type();
+			}
+
+			released += chunk->count;
+			mCapacity -= chunk->count;
+
+			mfree(chunk->slots);
+			delete chunk;
+
+			mChunks.RemoveAt(i);
+		}
+
+		if (released == 0)
+			return 0;
+
+		// Rebuilding free list from remaining chunks
+		mFreeList = nullptr;
+		for (int i = mChunks.Count() - 1; i >= 0; i--)
+		{
+			Chunk* chunk = mChunks[i];
+			for (int j = chunk->count - 1; j >= 0; j--)
+			{
+				Slot* slot = &chunk->slots[j];
+				if (slot->used)
+					continue;
+
+				slot->nextFree = mFreeList;
+				mFreeList = slot;
+			}
+		}
+
+		return released;
+	}
+
+	template<typename _type>
+	int Pool<_type>::GetUsedCount() const
+	{
+		return mUsedCount;
+	}
+
+	template<typename _type>
+	int Pool<_type>::GetCapacity() const
+	{
+		return mCapacity;
+	}
+
+	template<typename _type>
+	bool Pool<_type>::IsPoolObject(const _type* obj) const
+	{
+		for (auto chunk : mChunks)
+		{
+			const char* chunkBegin = (const char*)chunk->slots;
+			const char* chunkEnd = (const char*)(chunk->slots + chunk->count);
+			const char* objPtr = (const char*)obj;
+
+			if (objPtr >= chunkBegin && objPtr < chunkEnd)
+				return (objPtr - chunkBegin) % sizeof(Slot) == 0;
+		}
+
+		return false;
+	}
+
+	template<typename _type>
+	void Pool<_type>::AllocateChunk(int count)
+	{
+		Chunk* chunk = mnew Chunk();
+		chunk->count = count;
+		chunk->usedCount = 0;
+		chunk->slots = (Slot*)mmalloc(sizeof(Slot)*count);
+
+		// Linking in reverse order, so slots are taken in memory order
+		for (int i = count - 1; i >= 0; i--)
+		{
+			Slot* slot = &chunk->slots[i];
+			slot->chunk = chunk;
+			slot->constructed = false;
+			slot->used = false;
+			slot->nextFree = mFreeList;
+			mFreeList = slot;
+		}
+
+		mChunks.Add(chunk);
+		mCapacity += count;
+	}
+
+	template<typename _type>
+	typename Pool<_type>::Slot* Pool<_type>::PopFreeSlot()
+	{
+		if (!mFreeList)
+			AllocateChunk(Math::Max(mChunkSize, 1));
+
+		Slot* slot = mFreeList;
+		mFreeList = slot->nextFree;
+
+		slot->used = true;
+		slot->chunk->usedCount++;
+		mUsedCount++;
+
+		return slot;
+	}
+
+	template<typename _type>
+	void Pool<_type>::PushFreeSlot(Slot* slot)
+	{
+		Assert(slot->used, "Object was already returned into pool");
+
+		slot->used = false;
+		slot->chunk->usedCount--;
+		mUsedCount--;
+
+		slot->nextFree = mFreeList;
+		mFreeList = slot;
+	}
+
+	template<typename _type>
+	typename Pool<_type>::Slot* Pool<_type>::GetSlot(_type* obj)
+	{
+		return reinterpret_cast<Slot*>(obj);
 	}
 }
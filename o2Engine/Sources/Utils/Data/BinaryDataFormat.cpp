@@ -0,0 +1,463 @@
+#include "BinaryDataFormat.h"
+
+#include <string.h>
+#include "Utils/Containers/HashDictionary.h"
+#include "Utils/Memory/MemoryManager.h"
+
+namespace o2
+{
+	namespace BinaryDataFormat
+	{
+		static const UInt8 mHeader[4] = { 'o', '2', 'D', 'B' }; // Binary data header
+		static const UInt8 mVersion = 2;                        // Current format version. Version 1 has no doubles
+		static const int   mMaxNodesDepth = 512;                // Max nesting depth of nodes, deeper data is corrupted
+
+		// Node value type
+		enum class ValueType: UInt8 { None, Int, Float, True, False, Text, Double };
+
+		// -------------------------------------
+		// Growing bytes buffer for data writing
+		// -------------------------------------
+		struct Writer
+		{
+			UInt8* data = nullptr; // Written data
+			UInt   size = 0;       // Written data size
+			UInt   capacity = 0;   // Allocated data size
+
+			// Frees data
+			~Writer()
+			{
+				if (data)
+					mfree(data);
+			}
+
+			// Reserves space for bytes count and returns pointer to it
+			UInt8* Extend(UInt bytes)
+			{
+				if (size + bytes > capacity)
+				{
+					capacity = Math::Max(capacity*2, size + bytes + 256);
+
+					UInt8* newData = (UInt8*)mmalloc(capacity);
+					if (data)
+					{
+						memcpy(newData, data, size);
+						mfree(data);
+					}
+
+					data = newData;
+				}
+
+				UInt8* res = data + size;
+				size += bytes;
+				return res;
+			}
+
+			// Writes bytes
+			void Write(const void* bytes, UInt count)
+			{
+				memcpy(Extend(count), bytes, count);
+			}
+
+			// Writes byte
+			void WriteByte(UInt8 value)
+			{
+				*Extend(1) = value;
+			}
+
+			// Writes unsigned integer by 7 bits in byte, high bit is continuation flag
+			void WriteVarInt(UInt64 value)
+			{
+				while (value >= 0x80)
+				{
+					WriteByte((UInt8)(value | 0x80));
+					value >>= 7;
+				}
+
+				WriteByte((UInt8)value);
+			}
+
+			// Writes signed integer as varint, with sign in lowest bit
+			void WriteSignedVarInt(Int64 value)
+			{
+				WriteVarInt(((UInt64)value << 1) ^ (UInt64)(value >> 63));
+			}
+
+			// Writes float in little endian
+			void WriteFloat(float value)
+			{
+				UInt bits;
+				memcpy(&bits, &value, sizeof(bits));
+
+				UInt8* dst = Extend(4);
+				for (int i = 0; i < 4; i++)
+					dst[i] = (UInt8)(bits >> (i*8));
+			}
+
+			// Writes double in little endian
+			void WriteDouble(double value)
+			{
+				UInt64 bits;
+				memcpy(&bits, &value, sizeof(bits));
+
+				UInt8* dst = Extend(8);
+				for (int i = 0; i < 8; i++)
+					dst[i] = (UInt8)(bits >> (i*8));
+			}
+
+			// Writes string as length and UTF-16 code units in little endian
+			void WriteString(const WString& value)
+			{
+				int length = value.Length();
+				WriteVarInt((UInt64)length);
+
+				const wchar_t* src = value.Data();
+				UInt8* dst = Extend((UInt)length*2);
+				for (int i = 0; i < length; i++)
+				{
+					dst[i*2] = (UInt8)(src[i] & 0xff);
+					dst[i*2 + 1] = (UInt8)((src[i] >> 8) & 0xff);
+				}
+			}
+		};
+
+		// -----------------------------------------------------
+		// Binary data reader. Sets error flag when data is over
+		// -----------------------------------------------------
+		struct Reader
+		{
+			const UInt8* data;  // Current reading position
+			const UInt8* end;   // End of data
+			bool         error; // Is data was corrupted
+
+			// Constructor
+			Reader(const void* data, UInt size):
+				data((const UInt8*)data), end((const UInt8*)data + size), error(false)
+			{}
+
+			// Returns pointer to bytes and moves position, or null when data is over
+			const UInt8* Take(UInt bytes)
+			{
+				if ((UInt)(end - data) < bytes)
+				{
+					error = true;
+					data = end;
+					return nullptr;
+				}
+
+				const UInt8* res = data;
+				data += bytes;
+				return res;
+			}
+
+			// Reads byte
+			UInt8 ReadByte()
+			{
+				const UInt8* src = Take(1);
+				return src ? *src : 0;
+			}
+
+			// Reads unsigned varint
+			UInt64 ReadVarInt()
+			{
+				UInt64 res = 0;
+				for (int shift = 0; shift < 64; shift += 7)
+				{
+					UInt8 byte = ReadByte();
+					res |= (UInt64)(byte & 0x7f) << shift;
+
+					if ((byte & 0x80) == 0)
+						return res;
+				}
+
+				error = true;
+				return 0;
+			}
+
+			// Reads signed varint
+			Int64 ReadSignedVarInt()
+			{
+				UInt64 value = ReadVarInt();
+				return (Int64)(value >> 1) ^ -(Int64)(value & 1);
+			}
+
+			// Reads count, which can't be greater than remaining bytes
+			int ReadCount()
+			{
+				UInt64 value = ReadVarInt();
+				if (value > (UInt64)(end - data))
+				{
+					error = true;
+					return 0;
+				}
+
+				return (int)value;
+			}
+
+			// Reads float in little endian
+			float ReadFloat()
+			{
+				const UInt8* src = Take(4);
+				if (!src)
+					return 0.0f;
+
+				UInt bits = (UInt)src[0] | ((UInt)src[1] << 8) | ((UInt)src[2] << 16) | ((UInt)src[3] << 24);
+
+				float res;
+				memcpy(&res, &bits, sizeof(res));
+				return res;
+			}
+
+			// Reads double in little endian
+			double ReadDouble()
+			{
+				const UInt8* src = Take(8);
+				if (!src)
+					return 0.0;
+
+				UInt64 bits = 0;
+				for (int i = 0; i < 8; i++)
+					bits |= (UInt64)src[i] << (i*8);
+
+				double res;
+				memcpy(&res, &bits, sizeof(res));
+				return res;
+			}
+
+			// Reads length-prefixed UTF-16 string
+			WString ReadString()
+			{
+				int length = ReadCount();
+
+				WString res;
+				const UInt8* src = Take((UInt)length*2);
+				if (!src)
+					return res;
+
+				res.Reserve(length + 1);
+				wchar_t* dst = res.Data();
+				for (int i = 0; i < length; i++)
+					dst[i] = (wchar_t)(src[i*2] | (src[i*2 + 1] << 8));
+
+				dst[length] = '\0';
+				return res;
+			}
+		};
+
+		typedef HashDictionary<WString, int> NamesDict;
+
+		// Writes text value with most compact type, which gives same text when loading
+		static void WriteTextValue(Writer& writer, const WString& value)
+		{
+			if (value == "true")
+			{
+				writer.WriteByte((UInt8)ValueType::True);
+				return;
+			}
+
+			if (value == "false")
+			{
+				writer.WriteByte((UInt8)ValueType::False);
+				return;
+			}
+
+			wchar_t first = value.Data()[0];
+			if ((first >= '0' && first <= '9') || first == '-')
+			{
+				int intValue = (int)value;
+				if ((WString)intValue == value)
+				{
+					writer.WriteByte((UInt8)ValueType::Int);
+					writer.WriteSignedVarInt(intValue);
+					return;
+				}
+
+				float floatValue = (float)value;
+				if ((WString)floatValue == value)
+				{
+					writer.WriteByte((UInt8)ValueType::Float);
+					writer.WriteFloat(floatValue);
+					return;
+				}
+			}
+
+			writer.WriteByte((UInt8)ValueType::Text);
+			writer.WriteString(value);
+		}
+
+		// Writes node value. Doubles, which are exact floats, are written as floats
+		static void WriteValue(Writer& writer, const DataNode& node)
+		{
+			switch (node.GetValueType())
+			{
+				case DataNode::ValueType::Empty:
+				writer.WriteByte((UInt8)ValueType::None);
+				break;
+
+				case DataNode::ValueType::Int:
+				writer.WriteByte((UInt8)ValueType::Int);
+				writer.WriteSignedVarInt((long long int)node);
+				break;
+
+				case DataNode::ValueType::Double:
+				{
+					double value = node;
+					if ((double)(float)value == value)
+					{
+						writer.WriteByte((UInt8)ValueType::Float);
+						writer.WriteFloat((float)value);
+					}
+					else
+					{
+						writer.WriteByte((UInt8)ValueType::Double);
+						writer.WriteDouble(value);
+					}
+
+					break;
+				}
+
+				case DataNode::ValueType::Bool:
+				writer.WriteByte((UInt8)((bool)node ? ValueType::True : ValueType::False));
+				break;
+
+				default:
+				WriteTextValue(writer, node.Data());
+				break;
+			}
+		}
+
+		// Writes node with children and adds node names into names table
+		static void WriteNode(Writer& writer, NamesDict& names, const DataNode& node)
+		{
+			WString name = node.GetName();
+
+			int nameIdx;
+			if (int* existingIdx = names.TryGet(name))
+				nameIdx = *existingIdx;
+			else
+			{
+				nameIdx = names.Count();
+				names.Add(name, nameIdx);
+			}
+
+			writer.WriteVarInt((UInt64)nameIdx);
+			WriteValue(writer, node);
+
+			writer.WriteVarInt((UInt64)node.GetChildNodes().Count());
+			for (auto child : node)
+				WriteNode(writer, names, *child);
+		}
+
+		// Reads node value
+		static void ReadValue(Reader& reader, DataNode& node)
+		{
+			ValueType type = (ValueType)reader.ReadByte();
+			switch (type)
+			{
+				case ValueType::None: break;
+				case ValueType::Int: node = (long long int)reader.ReadSignedVarInt(); break;
+				case ValueType::Float: node = reader.ReadFloat(); break;
+				case ValueType::Double: node = reader.ReadDouble(); break;
+				case ValueType::True: node = true; break;
+				case ValueType::False: node = false; break;
+				case ValueType::Text: node = reader.ReadString(); break;
+				default: reader.error = true; break;
+			}
+		}
+
+		// Reads node with children and adds it into parent. Returns false when data is corrupted
+		static bool ReadNode(Reader& reader, const Vector<WString>& names, DataNode& parent, int depth)
+		{
+			if (depth > mMaxNodesDepth)
+				reader.error = true;
+
+			UInt64 nameIdx = reader.ReadVarInt();
+			if (nameIdx >= (UInt64)names.Count())
+				reader.error = true;
+
+			if (reader.error)
+				return false;
+
+			const WString& name = names[(int)nameIdx];
+			DataNode* node = parent.AddNode(name.Data(), name.Length());
+			ReadValue(reader, *node);
+
+			int childrenCount = reader.ReadCount();
+			for (int i = 0; i < childrenCount && !reader.error; i++)
+			{
+				if (!ReadNode(reader, names, *node, depth + 1))
+					break;
+			}
+
+			return !reader.error;
+		}
+
+		bool IsBinaryData(const void* data, UInt size)
+		{
+			return size > sizeof(mHeader) && memcmp(data, mHeader, sizeof(mHeader)) == 0;
+		}
+
+		bool LoadDataDoc(const void* data, UInt size, DataNode& node)
+		{
+			if (!IsBinaryData(data, size))
+				return false;
+
+			Reader reader(data, size);
+			reader.Take(sizeof(mHeader));
+
+			UInt8 version = reader.ReadByte();
+			if (version == 0 || version > mVersion)
+				return false;
+
+			int namesCount = reader.ReadCount();
+			Vector<WString> names(namesCount);
+			for (int i = 0; i < namesCount && !reader.error; i++)
+				names.Add(reader.ReadString());
+
+			int initialNodesCount = node.GetChildNodes().Count();
+
+			int nodesCount = reader.ReadCount();
+			for (int i = 0; i < nodesCount && !reader.error; i++)
+			{
+				if (!ReadNode(reader, names, node, 1))
+					break;
+			}
+
+			if (reader.error)
+			{
+				while (node.GetChildNodes().Count() > initialNodesCount)
+					node.RemoveNode(node.GetChildNodes()[node.GetChildNodes().Count() - 1]);
+
+				return false;
+			}
+
+			return true;
+		}
+
+		UInt SaveDataDoc(const DataNode& node, UInt8*& data)
+		{
+			NamesDict names;
+			Writer nodesWriter;
+
+			nodesWriter.WriteVarInt((UInt64)node.GetChildNodes().Count());
+			for (auto child : node)
+				WriteNode(nodesWriter, names, *child);
+
+			Writer writer;
+			writer.Write(mHeader, sizeof(mHeader));
+			writer.WriteByte(mVersion);
+
+			writer.WriteVarInt((UInt64)names.Count());
+			for (auto kv : names)
+				writer.WriteString(kv.Key());
+
+			writer.Write(nodesWriter.data, nodesWriter.size);
+
+			UInt size = writer.size;
+			data = writer.data;
+			writer.data = nullptr;
+
+			return size;
+		}
+	}
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Utils/CommonTypes.h"
+#include "Utils/Data/DataNode.h"
+
+namespace o2
+{
+	// -----------------------------------------------------------------------------------------
+	// Compact binary data format. Data starts with header "o2DB" and format version. Next goes
+	// names table: count of names and names as length-prefixed UTF-16 strings, nodes refer names
+	// by index. Then count of root nodes and nodes. Each node is name index, value type byte,
+	// typed value and count of children followed by children. Integers are stored as varints
+	// -----------------------------------------------------------------------------------------
+	namespace BinaryDataFormat
+	{
+		// Returns true when data starts with binary format header
+		bool IsBinaryData(const void* data, UInt size);
+
+		// Loads nodes from binary data and adds them into node. Fails on nodes nested deeper than 512 levels
+		bool LoadDataDoc(const void* data, UInt size, DataNode& node);
+
+		// Saves node children into binary data, allocated by mmalloc. Returns data size
+		UInt SaveDataDoc(const DataNode& node, UInt8*& data);
+	}
+}
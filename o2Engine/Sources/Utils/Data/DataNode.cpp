@@ -3,36 +3,140 @@
 #include "Scene/Actor.h"
 #include "Scene/Component.h"
 #include "Scene/Scene.h"
+#include "Utils/Data/BinaryDataFormat.h"
 #include "Utils/Data/XmlDataFormat.h"
 #include "Utils/FileSystem/File.h"
 #include "Utils/Memory/MemoryManager.h"
 #include "Utils/Reflection/Type.h"
 #include "Utils/Serializable.h"
 
+#include <limits.h>
+#include <new>
+#include <string.h>
+#include <wchar.h>
+
 namespace o2
 {
+	// Returns string, copied from null terminated text
+	static WString MakeString(const wchar_t* text)
+	{
+		int length = (int)wcslen(text);
+
+		WString res;
+		res.Reserve(length + 1);
+		memcpy(res.Data(), text, (length + 1)*sizeof(wchar_t));
+
+		return res;
+	}
+
+	// Returns integer parsed from text until first not digit character. Fraction part is dropped, so
+	// number text gives same value as truncated number
+	static Int64 ParseInt(const wchar_t* text)
+	{
+		bool negative = *text == '-';
+		if (*text == '-' || *text == '+')
+			text++;
+
+		UInt64 res = 0;
+		for (; *text >= '0' && *text <= '9'; text++)
+			res = res*10 + (UInt64)(*text - '0');
+
+		return (Int64)(negative ? (UInt64)0 - res : res);
+	}
+
+	// Returns number parsed from text until first not number character
+	static double ParseFloat(const wchar_t* text)
+	{
+		double sign = 1.0;
+		if (*text == '-' || *text == '+')
+		{
+			sign = *text == '-' ? -1.0 : 1.0;
+			text++;
+		}
+
+		double integerPart = 0.0, fractionPart = 0.0, fractionDivisor = 1.0;
+		for (; *text >= '0' && *text <= '9'; text++)
+			integerPart = integerPart*10.0 + (double)(*text - '0');
+
+		if (*text == '.')
+		{
+			for (text++; *text >= '0' && *text <= '9'; text++)
+			{
+				fractionPart = fractionPart*10.0 + (double)(*text - '0');
+				fractionDivisor *= 10.0;
+			}
+		}
+
+		return sign*(integerPart + fractionPart/fractionDivisor);
+	}
+
+	// Returns is text a true value
+	static bool ParseBool(const wchar_t* text)
+	{
+		return wcscmp(text, L"true") == 0 || wcscmp(text, L"TRUE") == 0 || wcscmp(text, L"True") == 0;
+	}
+
+	int DataNode::ChildNodesArray::Count() const
+	{
+		return mCount;
+	}
+
+	bool DataNode::ChildNodesArray::IsEmpty() const
+	{
+		return mCount == 0;
+	}
+
+	DataNode* DataNode::ChildNodesArray::operator[](int idx) const
+	{
+		return mNodes[idx];
+	}
+
+	DataNode::Iterator DataNode::ChildNodesArray::begin() const
+	{
+		return mNodes;
+	}
+
+	DataNode::Iterator DataNode::ChildNodesArray::end() const
+	{
+		return mNodes + mCount;
+	}
+
 	DataNode::DataNode():
-		mParent(nullptr)
+		mName(nullptr), mValueType(ValueType::Empty), mParent(nullptr), mArena(nullptr), mOwnArena(false), mInArena(false)
 	{}
 
 	DataNode::DataNode(const DataNode& other) :
-		mName(other.mName), mData(other.mData), mParent(nullptr)
+		mName(nullptr), mValueType(ValueType::Empty), mParent(nullptr), mArena(nullptr), mOwnArena(false), mInArena(false)
 	{
+		SetName(other.GetNameData(), (int)wcslen(other.GetNameData()));
+		CopyValue(other);
+
 		for (auto child : other.mChildNodes)
-		{
-			DataNode* newNode = mnew DataNode(*child);
-			newNode->mParent = this;
-			mChildNodes.Add(newNode);
-		}
+			AddChild(mnew DataNode(*child));
 	}
 
 	DataNode::DataNode(const WString& name):
-		mName(name), mParent(nullptr)
-	{}
+		mName(nullptr), mValueType(ValueType::Empty), mParent(nullptr), mArena(nullptr), mOwnArena(false), mInArena(false)
+	{
+		SetName(name);
+	}
 
 	DataNode::~DataNode()
 	{
+		if (mOwnArena && !mArena->hasHeapNodes)
+		{
+			delete mArena;
+			return;
+		}
+
 		Clear();
+		FreeText(mName);
+
+		if (!mArena && mChildNodes.mNodes)
+			mfree(mChildNodes.mNodes);
+
+		if (mOwnArena)
+			delete mArena;
 	}
 
 	DataNode& DataNode::operator=(const DataNode& value)
@@ -43,132 +147,127 @@ namespace o2
 	DataNode& DataNode::SetValue(const DataNode& other)
 	{
 		for (auto child : mChildNodes)
-			delete child;
+			ReleaseChild(child);
 
-		mChildNodes.Clear();
+		mChildNodes.mCount = 0;
 
 		for (auto child : other.mChildNodes)
-			mChildNodes.Add(mnew DataNode(*child));
+		{
+			const wchar_t* childName = child->GetNameData();
+			AddNode(childName, (int)wcslen(childName))->SetValue(*child);
+		}
 
 		//mName = other.mName;
-		mData = other.mData;
+		CopyValue(other);
 
 		return *this;
 	}
 
 	DataNode& DataNode::SetValue(char* value)
 	{
-		mData = value;
-		return *this;
+		return SetValue(WString(value));
 	}
 
 	DataNode& DataNode::SetValue(wchar_t* value)
 	{
-		mData = value;
+		SetValueText(value, (int)wcslen(value));
 		return *this;
 	}
 
 	DataNode& DataNode::SetValue(int value)
 	{
-		mData = (WString)value;
-		return *this;
+		return SetValue((long long int)value);
 	}
 
 	DataNode& DataNode::SetValue(unsigned long value)
 	{
-		mData = (WString)(unsigned int)value;
-		return *this;
+		return SetValue((long long int)value);
 	}
 
 	DataNode& DataNode::SetValue(long long int value)
 	{
-		mData = (WString)(int)value;
+		ResetValue(ValueType::Int);
+		mValue.intValue = value;
 		return *this;
 	}
 
 	DataNode& DataNode::SetValue(UInt64 value)
 	{
-		mData = (WString)value;
-		return *this;
+		if (value > (UInt64)LLONG_MAX)
+			return SetValue((WString)value);
+
+		return SetValue((long long int)value);
 	}
 
 	DataNode& DataNode::SetValue(float value)
 	{
-		mData = (WString)value;
-		return *this;
+		return SetValue((double)value);
 	}
 
 	DataNode& DataNode::SetValue(double value)
 	{
-		mData = (WString)(float)value;
+		ResetValue(ValueType::Double);
+		mValue.doubleValue = value;
 		return *this;
 	}
 
 	DataNode& DataNode::SetValue(UInt value)
 	{
-		mData = (WString)value;
-		return *this;
+		return SetValue((long long int)value);
 	}
 
 
 	DataNode& DataNode::SetValue(bool value)
 	{
-		mData = (WString)value;
+		ResetValue(ValueType::Bool);
+		mValue.boolValue = value;
 		return *this;
 	}
 
 	DataNode& DataNode::SetValue(const String& value)
 	{
-		mData = value;
-		return *this;
+		return SetValue((WString)value);
 	}
 
 	DataNode& DataNode::SetValue(const WString& value)
 	{
-		mData = value;
+		SetValueText(value.Data(), value.Length());
 		return *this;
 	}
 
 	DataNode& DataNode::SetValue(const Vec2F& value)
 	{
-		mData = (WString)value;
-		return *this;
+		return SetValue((WString)value);
 	}
 
 	DataNode& DataNode::SetValue(const Vec2I& value)
 	{
-		mData = (WString)value;
-		return *this;
+		return SetValue((WString)value);
 	}
 
 	DataNode& DataNode::SetValue(const RectF& value)
 	{
-		mData = (WString)value;
-		return *this;
+		return SetValue((WString)value);
 	}
 
 	DataNode& DataNode::SetValue(const RectI& value)
 	{
-		mData = (WString)value;
-		return *this;
+		return SetValue((WString)value);
 	}
 
 	DataNode& DataNode::SetValue(const BorderF& value)
 	{
-		mData = (WString)value;
-		return *this;
+		return SetValue((WString)value);
 	}
 
 	DataNode& DataNode::SetValue(const BorderI& value)
 	{
-		mData = (WString)value;
-		return *this;
+		return SetValue((WString)value);
 	}
 
 	DataNode& DataNode::SetValue(const Color4& value)
 	{
-		mData = (WString)value;
-		return *this;
+		return SetValue((WString)value);
 	}
 
 // 	DataNode& DataNode::SetValue(IObject& other)
@@ -179,8 +278,7 @@ namespace o2
 
 	DataNode& DataNode::SetValue(const UID& value)
 	{
-		mData = (String)value;
-		return *this;
+		return SetValue((String)value);
 	}
 
 	DataNode& DataNode::SetValueRaw(const IObject& object)
@@ -235,31 +333,25 @@ namespace o2
 				if (usedConverter)
 					continue;
 
-				DataNode* newFieldNode = mnew DataNode();
-				newFieldNode->SetName(field->GetName());
+				DataNode* newFieldNode = AddNode(field->GetName());
 
 				newFieldNode->SetValueDelta(*(IObject*)field->GetValuePtr(objectPtr), 
 								      		*(IObject*)field->GetValuePtr(sourcePtr));
 
-				if (!newFieldNode->IsEmpty())
-					AddNode(newFieldNode);
-				else
-					delete newFieldNode;                 
+				if (newFieldNode->IsEmpty())
+					RemoveNode(newFieldNode);
 
 				continue;
 			}
 
 			if (!field->IsValueEquals(objectPtr, sourcePtr))
 			{
-				DataNode* newFieldNode = mnew DataNode();
-				newFieldNode->SetName(field->GetName());
+				DataNode* newFieldNode = AddNode(field->GetName());
 
 				field->SerializeFromObject(objectPtr, *newFieldNode); 
 				
-				if (!newFieldNode->IsEmpty())
-					AddNode(newFieldNode);
-				else
-					delete newFieldNode;
+				if (newFieldNode->IsEmpty())
+					RemoveNode(newFieldNode);
 			}
 		}
 
@@ -268,117 +360,123 @@ namespace o2
 
 	void DataNode::DataNode::GetValue(wchar_t*& value) const
 	{
-		memcpy(value, mData.Data(), sizeof(wchar_t)*mData.Length() + 1);
+		WString text = Data();
+		memcpy(value, text.Data(), sizeof(wchar_t)*(text.Length() + 1));
 	}
 
 	void DataNode::GetValue(bool& value) const
 	{
-		value = (bool)mData;
+		value = GetBoolValue();
 	}
 
 	void DataNode::GetValue(int& value) const
 	{
-		value = (int)mData;
+		value = (int)GetIntValue();
 	}
 
 	void DataNode::GetValue(float& value) const
 	{
-		value = (float)mData;
+		value = (float)GetDoubleValue();
+	}
+
+	void DataNode::GetValue(double& value) const
+	{
+		value = GetDoubleValue();
 	}
 
 	void DataNode::GetValue(UInt& value) const
 	{
-		value = (UInt)mData;
+		value = (UInt)GetIntValue();
 	}
 
 	void DataNode::GetValue(UInt64& value) const
 	{
-		value = (UInt64)mData;
+		value = (UInt64)GetIntValue();
 	}
 
 	void DataNode::GetValue(String& value) const
 	{
-		value = mData;
+		value = Data();
 	}
 
 	void DataNode::GetValue(WString& value) const
 	{
-		value = mData;
+		value = Data();
 	}
 
 	void DataNode::GetValue(Vec2F& value) const
 	{
-		value = (Vec2F)mData;
+		value = (Vec2F)Data();
 	}
 
 	void DataNode::GetValue(Vec2I& value) const
 	{
-		value = (Vec2I)mData;
+		value = (Vec2I)Data();
 	}
 
 	void DataNode::GetValue(RectF& value) const
 	{
-		value = (RectF)mData;
+		value = (RectF)Data();
 	}
 
 	void DataNode::GetValue(RectI& value) const
 	{
-		value = (RectI)mData;
+		value = (RectI)Data();
 	}
 
 	void DataNode::GetValue(BorderF& value) const
 	{
-		value = (BorderF)mData;
+		value = (BorderF)Data();
 	}
 
 	void DataNode::GetValue(BorderI& value) const
 	{
-		value = (BorderI)mData;
+		value = (BorderI)Data();
 	}
 
 	void DataNode::GetValue(Color4& value) const
 	{
-		value = (Color4)mData;
+		value = (Color4)Data();
 	}
 
 	void DataNode::GetValue(char& value) const
 	{
-		value = (char)(int)mData;
+		value = (char)GetIntValue();
 	}
 
 	void DataNode::GetValue(unsigned char& value) const
 	{
-		value = (unsigned char)(unsigned int)mData;
+		value = (unsigned char)GetIntValue();
 	}
 
 	void DataNode::GetValue(wchar_t& value) const
 	{
-		value = (wchar_t)(int)mData;
+		value = (wchar_t)GetIntValue();
 	}
 
 	void DataNode::GetValue(short& value) const
 	{
-		value = (short)(int)mData;
+		value = (short)GetIntValue();
 	}
 
 	void DataNode::GetValue(unsigned short& value) const
 	{
-		value = (unsigned short)(unsigned int)mData;
+		value = (unsigned short)GetIntValue();
 	}
 
 	void DataNode::GetValue(long& value) const
 	{
-		value = (long)(int)mData;
+		value = (long)GetIntValue();
 	}
 
 	void DataNode::GetValue(unsigned long& value) const
 	{
-		value = (unsigned long)(unsigned int)mData;
+		value = (unsigned long)GetIntValue();
 	}
 
 	void DataNode::GetValue(long long int& value) const
 	{
-		value = (long long int)(int)mData;
+		value = (long long int)GetIntValue();
 	}
 
 	void DataNode::GetValue(DataNode& other) const
@@ -388,7 +486,7 @@ namespace o2
 
 	void DataNode::GetValue(UID& value) const
 	{
-		value = mData;
+		value = Data();
 	}
 
 	void DataNode::GetValueDelta(IObject& object, const IObject& source) const
@@ -472,7 +570,7 @@ namespace o2
 
 	bool DataNode::operator==(const DataNode& other) const
 	{
-		if (mName != other.mName || mData != other.mData || mChildNodes.Count() != other.mChildNodes.Count())
+		if (wcscmp(GetNameData(), other.GetNameData()) != 0 || !IsValueEquals(other) || mChildNodes.Count() != other.mChildNodes.Count())
 			return false;
 		
 		for (int i = 0; i < mChildNodes.Count(); i++)
@@ -514,7 +612,7 @@ namespace o2
 
 		for (auto child : mChildNodes)
 		{
-			if (child->mName == pathPart)
+			if (wcscmp(child->GetNameData(), pathPart.Data()) == 0)
 			{
 				if (delPos == -1)
 					return child;
@@ -535,108 +633,163 @@ namespace o2
 
 			DataNode* node = GetNode(namePart);
 			if (!node)
-			{
-				node = mnew DataNode();
-				node->SetName(namePart);
-				node->mParent = this;
-				mChildNodes.Add(node);
-			}
+				node = AddNode(namePart.Data(), namePart.Length());
 
 			return node->AddNode(name.SubStr(delPos + 1));
 		}
 
-		DataNode* newNode = mnew DataNode();
-		newNode->SetName(name);
-		newNode->mParent = this;
-		mChildNodes.Add(newNode);
+		return AddNode(name.Data(), name.Length());
+	}
+
+	DataNode* DataNode::AddNode(const wchar_t* name, int nameLength)
+	{
+		DataNode* newNode;
+		if (mArena)
+		{
+			newNode = new (mArena->memory.Allocate(sizeof(DataNode), alignof(DataNode))) DataNode();
+			newNode->mArena = mArena;
+			newNode->mInArena = true;
+		}
+		else
+			newNode = mnew DataNode();
+
+		newNode->SetName(name, nameLength);
+		AddChild(newNode);
 
 		return newNode;
 	}
 
 	DataNode* DataNode::AddNode(DataNode* node)
 	{
-		mChildNodes.Add(node);
-		node->mParent = this;
+		// Node from other arena document is freed with that document, so it's copied into this one
+		if (node->mInArena && node->mArena != mArena)
+		{
+			const wchar_t* name = node->GetNameData();
+			DataNode* newNode = AddNode(name, (int)wcslen(name));
+			newNode->SetValue(*node);
+			return newNode;
+		}
+
+		if (mArena && !node->mInArena)
+			mArena->hasHeapNodes = true;
+
+		AddChild(node);
 		return node;
 	}
 
 	bool DataNode::RemoveNode(DataNode* node)
 	{
-		if (!mChildNodes.Contains(node))
-			return false;
-
-		mChildNodes.Remove(node);
-		delete node;
+		for (int i = mChildNodes.mCount - 1; i >= 0; i--)
+		{
+			if (mChildNodes.mNodes[i] == node)
+			{
+				RemoveChildAt(i);
+				return true;
+			}
+		}
 
-		return true;
+		return false;
 	}
 
 	bool DataNode::RemoveNode(const WString& name)
 	{
-		int idx = mChildNodes.FindIdx([&](DataNode* x) { return x->mName == name; });
-		if (idx < 0)
-			return false;
-
-		DataNode* node = mChildNodes.Get(idx);
-		mChildNodes.RemoveAt(idx);
-		delete node;
+		for (int i = 0; i < mChildNodes.mCount; i++)
+		{
+			if (wcscmp(mChildNodes.mNodes[i]->GetNameData(), name.Data()) == 0)
+			{
+				RemoveChildAt(i);
+				return true;
+			}
+		}
 
-		return true;
+		return false;
 	}
 
 	WString DataNode::GetName() const
 	{
-		return mName;
+		return MakeString(GetNameData());
 	}
 
 	void DataNode::SetName(const WString& name)
 	{
-		mName = name;
+		SetName(name.Data(), name.Length());
 	}
 
-	const DataNode::DataNodesVec& DataNode::GetChildNodes() const
+	const DataNode::ChildNodesArray& DataNode::GetChildNodes() const
 	{
 		return mChildNodes;
 	}
 
+	void DataNode::EnableArena()
+	{
+		if (mArena)
+			return;
+
+		Clear();
+
+		if (mChildNodes.mNodes)
+		{
+			mfree(mChildNodes.mNodes);
+			mChildNodes.mNodes = nullptr;
+			mChildNodes.mCapacity = 0;
+		}
+
+		wchar_t* name = mName;
+		mName = nullptr;
+
+		mArena = mnew DocumentArena();
+		mOwnArena = true;
+
+		if (name)
+		{
+			SetName(name, (int)wcslen(name));
+			mfree(name);
+		}
+	}
+
+	bool DataNode::IsArenaEnabled() const
+	{
+		return mArena != nullptr;
+	}
+
 	DataNode::Iterator DataNode::Begin()
 	{
-		return mChildNodes.Begin();
+		return mChildNodes.begin();
 	}
 
 	DataNode::ConstIterator DataNode::Begin() const
 	{
-		return mChildNodes.Begin();
+		return mChildNodes.begin();
 	}
 
 	DataNode::Iterator DataNode::End()
 	{
-		return mChildNodes.End();
+		return mChildNodes.end();
 	}
 
 	DataNode::ConstIterator DataNode::End() const
 	{
-		return mChildNodes.End();
+		return mChildNodes.end();
 	}
 
 	DataNode::Iterator DataNode::begin()
 	{
-		return mChildNodes.Begin();
+		return mChildNodes.begin();
 	}
 
 	DataNode::ConstIterator DataNode::begin() const
 	{
-		return mChildNodes.Begin();
+		return mChildNodes.begin();
 	}
 
 	DataNode::Iterator DataNode::end()
 	{
-		return mChildNodes.End();
+		return mChildNodes.end();
 	}
 
 	DataNode::ConstIterator DataNode::end() const
 	{
-		return mChildNodes.End();
+		return mChildNodes.end();
 	}
 
 	void DataNode::RegDataConverter(IDataNodeTypeConverter* converter)
@@ -644,29 +797,230 @@ namespace o2
 		mDataConverters.Add(converter);
 	}
 
-	WString& DataNode::Data()
+	WString DataNode::Data() const
+	{
+		switch (mValueType)
+		{
+			case ValueType::Int:
+			{
+				Int64 value = mValue.intValue;
+				if (value >= INT_MIN && value <= INT_MAX)
+					return (WString)(int)value;
+
+				if (value > 0)
+					return (WString)(UInt64)value;
+
+				WString res;
+				res += '-';
+				res += (WString)((UInt64)0 - (UInt64)value);
+				return res;
+			}
+
+			case ValueType::Double: return (WString)(float)mValue.doubleValue;
+			case ValueType::Bool: return (WString)mValue.boolValue;
+			case ValueType::ShortString: return MakeString(mValue.shortString);
+			case ValueType::HeapString: return MakeString(mValue.heapString);
+			default: return WString();
+		}
+	}
+
+	DataNode::ValueType DataNode::GetValueType() const
+	{
+		return mValueType;
+	}
+
+	wchar_t* DataNode::AllocateText(const wchar_t* text, int length)
+	{
+		wchar_t* res = mArena ? mArena->memory.Allocate<wchar_t>(length + 1) :
+			(wchar_t*)mmalloc((length + 1)*sizeof(wchar_t));
+
+		memcpy(res, text, length*sizeof(wchar_t));
+		res[length] = '\0';
+
+		return res;
+	}
+
+	void DataNode::FreeText(wchar_t* text)
+	{
+		if (text && !mArena)
+			mfree(text);
+	}
+
+	void DataNode::SetName(const wchar_t* name, int length)
 	{
-		return mData;
+		FreeText(mName);
+		mName = length > 0 ? AllocateText(name, length) : nullptr;
 	}
 
-	const WString& DataNode::Data() const
+	const wchar_t* DataNode::GetNameData() const
 	{
-		return mData;
+		return mName ? mName : L"";
+	}
+
+	void DataNode::AddChild(DataNode* node)
+	{
+		if (mChildNodes.mCount == mChildNodes.mCapacity)
+		{
+			int newCapacity = Math::Max(mChildNodes.mCapacity*2, 4);
+			DataNode** newNodes = mArena ? mArena->memory.Allocate<DataNode*>(newCapacity) :
+				(DataNode**)mmalloc(newCapacity*sizeof(DataNode*));
+
+			if (mChildNodes.mNodes)
+			{
+				memcpy(newNodes, mChildNodes.mNodes, mChildNodes.mCount*sizeof(DataNode*));
+
+				if (!mArena)
+					mfree(mChildNodes.mNodes);
+			}
+
+			mChildNodes.mNodes = newNodes;
+			mChildNodes.mCapacity = newCapacity;
+		}
+
+		mChildNodes.mNodes[mChildNodes.mCount++] = node;
+		node->mParent = this;
+	}
+
+	void DataNode::RemoveChildAt(int idx)
+	{
+		DataNode* node = mChildNodes.mNodes[idx];
+
+		mChildNodes.mCount--;
+		memmove(mChildNodes.mNodes + idx, mChildNodes.mNodes + idx + 1, (mChildNodes.mCount - idx)*sizeof(DataNode*));
+
+		ReleaseChild(node);
+	}
+
+	void DataNode::ReleaseChild(DataNode* node)
+	{
+		if (!node->mInArena)
+			delete node;
+		else if (node->mArena->hasHeapNodes)
+			node->~DataNode();
+	}
+
+	void DataNode::ResetValue(ValueType type /*= ValueType::Empty*/)
+	{
+		if (mValueType == ValueType::HeapString)
+			FreeText(mValue.heapString);
+
+		mValueType = type;
+	}
+
+	void DataNode::CopyValue(const DataNode& other)
+	{
+		if (this == &other)
+			return;
+
+		if (other.mValueType == ValueType::HeapString)
+		{
+			SetValueText(other.mValue.heapString, (int)wcslen(other.mValue.heapString));
+			return;
+		}
+
+		ResetValue(other.mValueType);
+		mValue = other.mValue;
+	}
+
+	void DataNode::SetValueText(const wchar_t* text, int length)
+	{
+		ResetValue();
+
+		if (length == 0)
+			return;
+
+		if (length < mShortStringSize)
+		{
+			mValueType = ValueType::ShortString;
+			memcpy(mValue.shortString, text, length*sizeof(wchar_t));
+			mValue.shortString[length] = '\0';
+		}
+		else
+		{
+			mValueType = ValueType::HeapString;
+			mValue.heapString = AllocateText(text, length);
+		}
+	}
+
+	const wchar_t* DataNode::GetValueText() const
+	{
+		if (mValueType == ValueType::ShortString)
+			return mValue.shortString;
+
+		if (mValueType == ValueType::HeapString)
+			return mValue.heapString;
+
+		return nullptr;
+	}
+
+	Int64 DataNode::GetIntValue() const
+	{
+		switch (mValueType)
+		{
+			case ValueType::Int: return mValue.intValue;
+			case ValueType::Double: return (Int64)mValue.doubleValue;
+			case ValueType::Bool: return mValue.boolValue ? 1 : 0;
+			case ValueType::ShortString:
+			case ValueType::HeapString: return ParseInt(GetValueText());
+			default: return 0;
+		}
+	}
+
+	double DataNode::GetDoubleValue() const
+	{
+		switch (mValueType)
+		{
+			case ValueType::Int: return (double)mValue.intValue;
+			case ValueType::Double: return mValue.doubleValue;
+			case ValueType::Bool: return mValue.boolValue ? 1.0 : 0.0;
+			case ValueType::ShortString:
+			case ValueType::HeapString: return ParseFloat(GetValueText());
+			default: return 0.0;
+		}
+	}
+
+	bool DataNode::GetBoolValue() const
+	{
+		switch (mValueType)
+		{
+			case ValueType::Int: return mValue.intValue != 0;
+			case ValueType::Double: return mValue.doubleValue != 0.0;
+			case ValueType::Bool: return mValue.boolValue;
+			case ValueType::ShortString:
+			case ValueType::HeapString: return ParseBool(GetValueText());
+			default: return false;
+		}
+	}
+
+	bool DataNode::IsValueEquals(const DataNode& other) const
+	{
+		if (mValueType != other.mValueType)
+			return Data() == other.Data();
+
+		switch (mValueType)
+		{
+			case ValueType::Int: return mValue.intValue == other.mValue.intValue;
+			case ValueType::Double: return mValue.doubleValue == other.mValue.doubleValue;
+			case ValueType::Bool: return mValue.boolValue == other.mValue.boolValue;
+			case ValueType::ShortString:
+			case ValueType::HeapString: return wcscmp(GetValueText(), other.GetValueText()) == 0;
+			default: return true;
+		}
 	}
 
 	bool DataNode::IsEmpty() const
 	{
-		return mData.IsEmpty() && mChildNodes.IsEmpty();
+		return mValueType == ValueType::Empty && mChildNodes.IsEmpty();
 	}
 
 	void DataNode::Clear()
 	{
-		mData.Clear();
+		ResetValue();
 
 		for (auto child : mChildNodes)
-			delete child;
+			ReleaseChild(child);
 
-		mChildNodes.Clear();
+		mChildNodes.mCount = 0;
 	}
 
 	bool DataNode::LoadFromFile(const String& fileName)
@@ -676,12 +1030,13 @@ namespace o2
 		if (!file.IsOpened())
 			return false;
 
-		WString data;
-		data.Reserve(file.GetDataSize() + 1);
-		auto sz = file.ReadFullData(data.Data());
-		data[sz / sizeof(wchar_t)] = '\0';
+		void* data = mmalloc(file.GetDataSize() + 1);
+		UInt size = file.ReadFullData(data);
 
-		return LoadFromData(data);
+		bool res = LoadFromData(data, size);
+		mfree(data);
+
+		return res;
 	}
 
 	bool DataNode::LoadFromData(const WString& data)
@@ -689,17 +1044,34 @@ namespace o2
 		return XmlDataFormat::LoadDataDoc(data, *this);
 	}
 
-	bool DataNode::SaveToFile(const String& fileName, Format format /*= Format::Xml*/) const
+	bool DataNode::LoadFromData(const void* data, UInt size)
 	{
-		WString data = SaveAsWString(format);
+		if (BinaryDataFormat::IsBinaryData(data, size))
+			return BinaryDataFormat::LoadDataDoc(data, size, *this);
 
+		return XmlDataFormat::LoadDataDoc(data, size, *this);
+	}
+
+	bool DataNode::SaveToFile(const String& fileName, Format format /*= Format::Xml*/) const
+	{
 		OutFile file(fileName);
 		if (!file.IsOpened())
 			return false;
 
+		if (format == Format::Binary)
+		{
+			UInt8* data = nullptr;
+			UInt size = BinaryDataFormat::SaveDataDoc(*this, data);
+			file.WriteData(data, size);
+			mfree(data);
+
+			return true;
+		}
+
+		WString data = SaveAsWString(format);
 		file.WriteData(data.Data(), data.Length()*sizeof(wchar_t));
 
-		return false;
+		return true;
 	}
 
 	WString DataNode::SaveAsWString(Format format /*= Format::Xml*/) const
@@ -2,6 +2,7 @@
 
 #include "Utils/Containers/Dictionary.h"
 #include "Utils/Containers/Vector.h"
+#include "Utils/Memory/MemoryArena.h"
 #include "Utils/String.h"
 #include "Utils/UID.h"
 #include "Utils/Property.h"
@@ -31,17 +32,49 @@ namespace o2
 		virtual bool IsConvertsType(const Type* type) const { return false; }
 	};
 
-	// -------------------
-	// Tree-like data node
-	// -------------------
+	// ------------------------------------------------------------------------------------------
+	// Tree-like data node. Root node can enable arena document mode: then nodes, names, values
+	// and children arrays of the tree are allocated from one arena, owned by root, and are freed
+	// at once with it
+	// ------------------------------------------------------------------------------------------
 	class DataNode
 	{
 	public:
 		enum class Format { Xml, JSON, Binary };
+		enum class ValueType { Empty, Int, Double, Bool, ShortString, HeapString };
 
 		typedef Vector<DataNode*> DataNodesVec;
-		typedef DataNodesVec::Iterator Iterator;
-		typedef DataNodesVec::ConstIterator ConstIterator;
+		typedef DataNode** Iterator;
+		typedef DataNode* const* ConstIterator;
+
+		// -----------------------------------------------------------------------------------
+		// Children nodes array. Memory is allocated from arena when node is in arena document
+		// -----------------------------------------------------------------------------------
+		class ChildNodesArray
+		{
+		public:
+			// Returns count of nodes
+			int Count() const;
+
+			// Returns true when there are no nodes
+			bool IsEmpty() const;
+
+			// Returns node by index
+			DataNode* operator[](int idx) const;
+
+			// Begin iterator (for range based "for")
+			Iterator begin() const;
+
+			// End iterator (for range based "for")
+			Iterator end() const;
+
+		protected:
+			DataNode** mNodes = nullptr; // Nodes array
+			int        mCount = 0;       // Count of nodes
+			int        mCapacity = 0;    // Size of nodes array
+
+			friend class DataNode;
+		};
 
 	protected:
 		// --------------------
@@ -205,6 +238,9 @@ namespace o2
 		// Gets value as float
 		void GetValue(float& value) const;
 
+		// Gets value as double
+		void GetValue(double& value) const;
+
 		// Gets value as unsigned integer
 		void GetValue(UInt& value) const;
 
@@ -330,7 +366,11 @@ namespace o2
 		// Add new node with name
 		DataNode* AddNode(const WString& name);
 
-		// Add node
+		// Add new node with name without path parsing
+		DataNode* AddNode(const wchar_t* name, int nameLength);
+
+		// Add node. Node must be allocated separately, it's deleted with parent. Node from other arena
+		// document isn't adopted: it's copied into this document and copy is returned
 		DataNode* AddNode(DataNode* node);
 
 		// Removes node
@@ -345,14 +385,20 @@ namespace o2
 		// Sets name of node
 		void SetName(const WString& name);
 
-		// Returns data reference
-		WString& Data();
+		// Returns value converted to text
+		WString Data() const;
 
-		// Returns constant data reference
-		const WString& Data() const;
+		// Returns type of stored value
+		ValueType GetValueType() const;
 
 		// Returns constant reference to children list
-		const DataNode::DataNodesVec& GetChildNodes() const;
+		const ChildNodesArray& GetChildNodes() const;
+
+		// Clears node and makes it root of arena document. Does nothing when node is already in arena document
+		void EnableArena();
+
+		// Returns is node in arena document
+		bool IsArenaEnabled() const;
 
 		// Loads data structure from file
 		bool LoadFromFile(const String& fileName);
@@ -360,10 +406,13 @@ namespace o2
 		// Loads data structure from string
 		bool LoadFromData(const WString& data);
 
+		// Loads data structure from raw data. Binary format is detected by data header, other data is loaded as xml
+		bool LoadFromData(const void* data, UInt size);
+
 		// Saves data to file with specified format
 		bool SaveToFile(const String& fileName, Format format = Format::Xml) const;
 
-		// Saves data to string
+		// Saves data to string. Binary format can't be stored in string, xml is used instead
 		WString SaveAsWString(Format format = Format::Xml) const;
 
 		// Begin iterator
@@ -423,18 +472,93 @@ namespace o2
 		template<typename T2>
 		struct IsSupport<Property<T2>>: IsSupport<T2> {};
 
+	protected:
+		static const int mShortStringSize = 24/sizeof(wchar_t); // Size of string, stored inside node, including terminator
+
+		// --------------------------------------------------------------
+		// Node value storage. Stored value is defined by node value type
+		// --------------------------------------------------------------
+		union Value
+		{
+			Int64    intValue;                      // Integer value
+			double   doubleValue;                   // Floating point value
+			bool     boolValue;                     // Boolean value
+			wchar_t  shortString[mShortStringSize]; // Null terminated short string
+			wchar_t* heapString;                    // Null terminated string, allocated by AllocateText
+		};
+
+		// --------------------------------------------------------------------------------------
+		// Arena of document. Separately allocated nodes, added into arena document, are released
+		// by tree traversal, other memory is freed at once
+		// --------------------------------------------------------------------------------------
+		struct DocumentArena
+		{
+			MemoryArena memory;               // Memory of nodes, names, values and children arrays
+			bool        hasHeapNodes = false; // Is separately allocated nodes were added into document
+		};
+
 	protected:
 		static Vector<IDataNodeTypeConverter*> mDataConverters; // Data converters
 
-		WString      mName;       // Name of node
-		WString      mData;       // Node data
-		DataNode*    mParent;     // Node parent
-		DataNodesVec mChildNodes; // Children nodes
+		wchar_t*        mName;       // Null terminated name of node, null when name is empty
+		ValueType       mValueType;  // Type of stored value
+		Value           mValue;      // Node value
+		DataNode*       mParent;     // Node parent
+		ChildNodesArray mChildNodes; // Children nodes
+		DocumentArena*  mArena;      // Arena of document, null when node memory is allocated separately
+		bool            mOwnArena;   // Is node root of arena document
+		bool            mInArena;    // Is node allocated from arena
 
 	protected:
 		// Registers basic engine converters
 		static void RegBasicConverters(); 
 
+		// Copies text into arena or into memory, allocated by mmalloc when node isn't in arena document
+		wchar_t* AllocateText(const wchar_t* text, int length);
+
+		// Frees text, which isn't allocated from arena
+		void FreeText(wchar_t* text);
+
+		// Sets name of node
+		void SetName(const wchar_t* name, int length);
+
+		// Returns name of node, empty string when name is empty
+		const wchar_t* GetNameData() const;
+
+		// Adds node into children array
+		void AddChild(DataNode* node);
+
+		// Removes child node by index and releases it
+		void RemoveChildAt(int idx);
+
+		// Releases child node: separately allocated nodes are deleted, arena nodes are destroyed only when
+		// there are separately allocated nodes in document
+		void ReleaseChild(DataNode* node);
+
+		// Frees value string and sets value type
+		void ResetValue(ValueType type = ValueType::Empty);
+
+		// Copies value from other node
+		void CopyValue(const DataNode& other);
+
+		// Sets value as text. Empty text makes value empty
+		void SetValueText(const wchar_t* text, int length);
+
+		// Returns text of string value or null for other types
+		const wchar_t* GetValueText() const;
+
+		// Returns value as integer. Double is truncated, text is parsed until first not digit character
+		Int64 GetIntValue() const;
+
+		// Returns value as double. Text is parsed
+		double GetDoubleValue() const;
+
+		// Returns value as boolean. Text is parsed
+		bool GetBoolValue() const;
+
+		// Returns is values equals. Values with different types are compared by text
+		bool IsValueEquals(const DataNode& other) const;
+
 		friend class Application;
 	};
 
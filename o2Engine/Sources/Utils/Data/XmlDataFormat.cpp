@@ -1,51 +1,581 @@
 #include "XmlDataFormat.h"
 
+#include <string.h>
+#include <wchar.h>
+
 namespace o2
 {
 	namespace XmlDataFormat
 	{
-		bool LoadDataDoc(const WString& data, DataNode& node)
+		static const int mMaxElementsDepth = 512; // Max nesting depth of elements, deeper data isn't loaded, as in binary format
+
+		// -----------------------------
+		// Wide characters string reader
+		// -----------------------------
+		struct WideDecoder
 		{
-			pugi::xml_document xmlDoc;
-			auto res = xmlDoc.load_buffer(data.Data(), data.Length()*sizeof(wchar_t));
+			const wchar_t* data; // Current reading position
+			const wchar_t* end;  // End of data
 
-			if (res.status != pugi::status_ok)
-				return false;
+			// Returns next character or -1 at the end
+			int Next()
+			{
+				return data < end ? (int)*data++ : -1;
+			}
+		};
+
+		// ------------------------------------------------------------------------------------------
+		// UTF-16 data reader with specified bytes order. Surrogates are combined for 32 bits wchar_t
+		// ------------------------------------------------------------------------------------------
+		struct Utf16Decoder
+		{
+			const UInt8* data;      // Current reading position
+			const UInt8* end;       // End of data
+			bool         bigEndian; // Is high byte first
 
-			for (pugi::xml_node_iterator it = xmlDoc.begin(); it != xmlDoc.end(); ++it)
+			// Returns next character or -1 at the end
+			int Next()
 			{
-				if (it->type() != pugi::node_element)
-					continue;
+				int res = NextUnit();
+				if (res >= 0xD800 && res < 0xDC00 && sizeof(wchar_t) > 2 && end - data >= 2)
+				{
+					const UInt8* lowPos = data;
+					int low = NextUnit();
+					if (low >= 0xDC00 && low < 0xE000)
+						return 0x10000 + ((res - 0xD800) << 10) + (low - 0xDC00);
+
+					data = lowPos;
+				}
 
-				DataNode* newNode = mnew DataNode();
-				LoadDataNode(*it, *newNode);
-				node.AddNode(newNode);
+				return res;
 			}
 
-			return true;
-		}
+			// Returns next code unit or -1 at the end
+			int NextUnit()
+			{
+				if (end - data < 2)
+					return -1;
+
+				int res = bigEndian ? (data[0] << 8) | data[1] : data[0] | (data[1] << 8);
+				data += 2;
+				return res;
+			}
+		};
 
-		void XmlDataFormat::LoadDataNode(const pugi::xml_node& xmlNode, DataNode& dataNode)
+		// -------------------------------------------------------------------------------------------
+		// UTF-8 data reader. Characters out of 16 bits are returned as surrogates for 16 bits wchar_t
+		// -------------------------------------------------------------------------------------------
+		struct Utf8Decoder
 		{
-			dataNode.SetName(xmlNode.name());
-			dataNode = (wchar_t*)xmlNode.child_value();
+			const UInt8* data;    // Current reading position
+			const UInt8* end;     // End of data
+			int          pending; // Low surrogate of last character, or -1
 
-			for (pugi::xml_attribute_iterator it = xmlNode.attributes_begin(); it != xmlNode.attributes_end(); ++it)
+			// Returns next character or -1 at the end
+			int Next()
 			{
-				DataNode* newNode = mnew DataNode(it->name());
-				*newNode = (wchar_t*)it->value();
-				dataNode.AddNode(newNode);
+				if (pending >= 0)
+				{
+					int res = pending;
+					pending = -1;
+					return res;
+				}
+
+				if (data >= end)
+					return -1;
+
+				UInt8 lead = *data++;
+				if (lead < 0x80)
+					return lead;
+
+				int extraBytes = lead >= 0xF0 ? 3 : lead >= 0xE0 ? 2 : lead >= 0xC0 ? 1 : 0;
+				UInt code = lead & (0x3F >> extraBytes);
+				for (; extraBytes > 0 && data < end && (*data & 0xC0) == 0x80; extraBytes--)
+					code = (code << 6) | (*data++ & 0x3F);
+
+				if (code >= 0x10000 && sizeof(wchar_t) == 2)
+				{
+					code -= 0x10000;
+					pending = 0xDC00 | (code & 0x3FF);
+					return 0xD800 | (code >> 10);
+				}
+
+				return (int)code;
+			}
+		};
+
+		// -----------------------------------------------------------------------------------------
+		// Streaming xml reader. Builds data nodes directly while reading characters, without
+		// intermediate document. Attributes are loaded as children nodes, first not empty text of
+		// element is node value. Declarations, comments and doctype are skipped. Escapes, line ends
+		// and attributes whitespaces are processed as in pugixml with default parsing options.
+		// Elements nested deeper than mMaxElementsDepth are syntax error
+		// -----------------------------------------------------------------------------------------
+		template<typename _decoder>
+		class XmlReader
+		{
+		public:
+			// Constructor
+			XmlReader(const _decoder& decoder):
+				mDecoder(decoder)
+			{
+				Next();
+			}
+
+			// Reads root elements into node. Returns false on syntax error or when there are no elements
+			bool Read(DataNode& node)
+			{
+				bool hasElements = false;
+
+				while (mChar >= 0)
+				{
+					if (mChar != '<')
+					{
+						Next();
+						continue;
+					}
+
+					Next();
+
+					if (mChar == '?' || mChar == '!')
+					{
+						if (!SkipMarkup())
+							return false;
+
+						continue;
+					}
+
+					if (!ReadElement(node, 0))
+						return false;
+
+					hasElements = true;
+				}
+
+				return hasElements;
 			}
 
-			for (auto node:xmlNode)
+		protected:
+			_decoder        mDecoder; // Characters source
+			int             mChar;    // Current character, -1 at the end
+			Vector<wchar_t> mBuffer;  // Last read name or text, null terminated
+			Vector<wchar_t> mNames;   // Names of opened elements, each is null terminated
+
+		protected:
+			// Moves to next character
+			void Next()
 			{
-				if (node.type() != pugi::node_element)
-					continue;
+				mChar = mDecoder.Next();
+			}
 
-				DataNode* newNode = mnew DataNode();
-				LoadDataNode(node, *newNode);
-				dataNode.AddNode(newNode);
+			// Returns is character a whitespace
+			static bool IsSpace(int c)
+			{
+				return c == ' ' || c == '\t' || c == '\n' || c == '\r';
 			}
+
+			// Skips whitespaces
+			void SkipSpaces()
+			{
+				while (IsSpace(mChar))
+					Next();
+			}
+
+			// Skips characters and checks that next is specified
+			bool Expect(const char* str)
+			{
+				for (; *str; str++)
+				{
+					if (mChar != *str)
+						return false;
+
+					Next();
+				}
+
+				return true;
+			}
+
+			// Reads characters until terminator, including it. When collect, characters before terminator are
+			// placed into buffer with normalized line ends. Terminator must be not longer than 3 characters
+			bool ReadUntil(const char* terminator, bool collect)
+			{
+				int length = (int)strlen(terminator);
+				int window[3] = { -1, -1, -1 };
+
+				mBuffer.Clear();
+				while (mChar >= 0)
+				{
+					int c = mChar;
+					Next();
+
+					if (c == '\r')
+					{
+						if (mChar == '\n')
+							Next();
+
+						c = '\n';
+					}
+
+					if (collect)
+						mBuffer.Add((wchar_t)c);
+
+					bool matched = true;
+					for (int i = 0; i < length - 1; i++)
+					{
+						window[i] = window[i + 1];
+						matched = matched && window[i] == terminator[i];
+					}
+
+					window[length - 1] = c;
+					if (matched && c == terminator[length - 1])
+					{
+						if (collect)
+						{
+							for (int i = 0; i < length; i++)
+								mBuffer.PopBack();
+
+							mBuffer.Add('\0');
+						}
+
+						return true;
+					}
+				}
+
+				return false;
+			}
+
+			// Skips declaration, processing instruction, comment, doctype or CDATA after '<'
+			bool SkipMarkup()
+			{
+				if (mChar == '?')
+					return ReadUntil("?>", false);
+
+				Next();
+
+				if (mChar == '-')
+					return Expect("--") && ReadUntil("-->", false);
+
+				if (mChar == '[')
+					return Expect("[CDATA[") && ReadUntil("]]>", false);
+
+				int depth = 0;
+				while (mChar >= 0)
+				{
+					if (mChar == '[')
+						depth++;
+					else if (mChar == ']')
+						depth--;
+					else if (mChar == '>' && depth <= 0)
+					{
+						Next();
+						return true;
+					}
+
+					Next();
+				}
+
+				return false;
+			}
+
+			// Reads element or attribute name into buffer
+			bool ReadName()
+			{
+				mBuffer.Clear();
+				while (mChar >= 0 && !IsSpace(mChar) && mChar != '>' && mChar != '/' && mChar != '=' && mChar != '<')
+				{
+					mBuffer.Add((wchar_t)mChar);
+					Next();
+				}
+
+				mBuffer.Add('\0');
+				return mBuffer.Count() > 1;
+			}
+
+			// Reads character or entity reference after '&'. Unknown references are left as is
+			void ReadReference()
+			{
+				Next();
+
+				wchar_t name[12];
+				int length = 0;
+				while (length < 10 && ((mChar >= '0' && mChar <= '9') || (mChar >= 'a' && mChar <= 'z') ||
+									   (mChar >= 'A' && mChar <= 'Z') || mChar == '#'))
+				{
+					name[length++] = (wchar_t)mChar;
+					Next();
+				}
+
+				name[length] = '\0';
+
+				if (mChar == ';')
+				{
+					int code = -1;
+					if (name[0] == '#')
+					{
+						bool hex = name[1] == 'x';
+						code = 0;
+						for (int i = hex ? 2 : 1; i < length; i++)
+						{
+							wchar_t c = name[i];
+							int digit = c >= '0' && c <= '9' ? c - '0' : hex && c >= 'a' && c <= 'f' ? c - 'a' + 10 :
+								hex && c >= 'A' && c <= 'F' ? c - 'A' + 10 : -1;
+
+							if (digit < 0)
+							{
+								code = -1;
+								break;
+							}
+
+							code = code*(hex ? 16 : 10) + digit;
+						}
+					}
+					else if (wcscmp(name, L"lt") == 0) code = '<';
+					else if (wcscmp(name, L"gt") == 0) code = '>';
+					else if (wcscmp(name, L"amp") == 0) code = '&';
+					else if (wcscmp(name, L"apos") == 0) code = '\'';
+					else if (wcscmp(name, L"quot") == 0) code = '"';
+
+					if (code >= 0x10000 && sizeof(wchar_t) == 2)
+					{
+						code -= 0x10000;
+						mBuffer.Add((wchar_t)(0xD800 | (code >> 10)));
+						mBuffer.Add((wchar_t)(0xDC00 | (code & 0x3FF)));
+						Next();
+						return;
+					}
+					else if (code >= 0)
+					{
+						mBuffer.Add((wchar_t)code);
+						Next();
+						return;
+					}
+				}
+
+				mBuffer.Add('&');
+				for (int i = 0; i < length; i++)
+					mBuffer.Add(name[i]);
+			}
+
+			// Reads text until terminator character into buffer. Returns is text not empty
+			bool ReadText(int terminator, bool attribute)
+			{
+				bool notEmpty = false;
+
+				mBuffer.Clear();
+				while (mChar >= 0 && mChar != terminator)
+				{
+					if (mChar == '&')
+					{
+						ReadReference();
+						notEmpty = true;
+						continue;
+					}
+
+					int c = mChar;
+					Next();
+
+					if (c == '\r')
+					{
+						if (mChar == '\n')
+							Next();
+
+						c = '\n';
+					}
+
+					if (attribute && (c == '\n' || c == '\t'))
+						c = ' ';
+
+					notEmpty = notEmpty || !IsSpace(c);
+					mBuffer.Add((wchar_t)c);
+				}
+
+				mBuffer.Add('\0');
+				return notEmpty;
+			}
+
+			// Returns is buffer equals to string
+			bool IsBufferEquals(const wchar_t* str) const
+			{
+				return wcscmp(mBuffer.Data(), str) == 0;
+			}
+
+			// Reads element after '<' with attributes and children and adds it into parent. Returns false on syntax error
+			// or when depth is greater than mMaxElementsDepth
+			bool ReadElement(DataNode& parent, int depth)
+			{
+				if (depth > mMaxElementsDepth || !ReadName())
+					return false;
+
+				DataNode* node = parent.AddNode(mBuffer.Data(), mBuffer.Count() - 1);
+
+				while (true)
+				{
+					SkipSpaces();
+
+					if (mChar == '/')
+					{
+						Next();
+						return Expect(">");
+					}
+
+					if (mChar == '>')
+					{
+						Next();
+						return ReadContent(node, depth);
+					}
+
+					if (!ReadName())
+						break;
+
+					DataNode* attribute = node->AddNode(mBuffer.Data(), mBuffer.Count() - 1);
+
+					SkipSpaces();
+					if (!Expect("="))
+						break;
+
+					SkipSpaces();
+					int quote = mChar;
+					if (quote != '"' && quote != '\'')
+						break;
+
+					Next();
+					ReadText(quote, true);
+					if (!Expect(quote == '"' ? "\"" : "'"))
+						break;
+
+					attribute->SetValue(mBuffer.Data());
+
+					if (!IsSpace(mChar) && mChar != '/' && mChar != '>')
+						break;
+				}
+
+				return false;
+			}
+
+			// Reads element content until end tag, which must have same name with node. Returns false on syntax error
+			bool ReadContent(DataNode* node, int depth)
+			{
+				int nameOffset = mNames.Count();
+				for (int i = 0; i < mBuffer.Count(); i++)
+					mNames.Add(mBuffer[i]);
+
+				bool hasValue = false;
+
+				while (mChar >= 0)
+				{
+					if (mChar != '<')
+					{
+						if (ReadText('<', false) && !hasValue)
+						{
+							node->SetValue(mBuffer.Data());
+							hasValue = true;
+						}
+
+						continue;
+					}
+
+					Next();
+
+					if (mChar == '/')
+					{
+						Next();
+						if (!ReadName() || !IsBufferEquals(mNames.Data() + nameOffset))
+							break;
+
+						while (mNames.Count() > nameOffset)
+							mNames.PopBack();
+
+						SkipSpaces();
+						return Expect(">");
+					}
+
+					if (mChar == '!')
+					{
+						Next();
+
+						if (mChar == '[')
+						{
+							if (!Expect("[CDATA[") || !ReadUntil("]]>", true))
+								break;
+
+							if (!hasValue)
+							{
+								node->SetValue(mBuffer.Data());
+								hasValue = true;
+							}
+
+							continue;
+						}
+
+						if (mChar == '-')
+						{
+							if (!Expect("--") || !ReadUntil("-->", false))
+								break;
+
+							continue;
+						}
+
+						break;
+					}
+
+					if (mChar == '?')
+					{
+						if (!ReadUntil("?>", false))
+							break;
+
+						continue;
+					}
+
+					if (!ReadElement(*node, depth + 1))
+						break;
+				}
+
+				return false;
+			}
+		};
+
+		// Reads all nodes and adds them into node. Removes added nodes on error
+		template<typename _decoder>
+		bool ReadDataDoc(const _decoder& decoder, DataNode& node)
+		{
+			int nodesCount = node.GetChildNodes().Count();
+
+			XmlReader<_decoder> reader(decoder);
+			if (reader.Read(node))
+				return true;
+
+			while (node.GetChildNodes().Count() > nodesCount)
+				node.RemoveNode(node.GetChildNodes()[node.GetChildNodes().Count() - 1]);
+
+			return false;
+		}
+
+		bool LoadDataDoc(const WString& data, DataNode& node)
+		{
+			WideDecoder decoder = { data.Data(), data.Data() + data.Length() };
+			return ReadDataDoc(decoder, node);
+		}
+
+		bool LoadDataDoc(const void* data, UInt size, DataNode& node)
+		{
+			const UInt8* bytes = (const UInt8*)data;
+			const UInt8* end = bytes + size;
+
+			if (size >= 2 && bytes[0] == 0xFF && bytes[1] == 0xFE)
+				return ReadDataDoc(Utf16Decoder { bytes + 2, end, false }, node);
+
+			if (size >= 2 && bytes[0] == 0xFE && bytes[1] == 0xFF)
+				return ReadDataDoc(Utf16Decoder { bytes + 2, end, true }, node);
+
+			if (size >= 3 && bytes[0] == 0xEF && bytes[1] == 0xBB && bytes[2] == 0xBF)
+				return ReadDataDoc(Utf8Decoder { bytes + 3, end, -1 }, node);
+
+			if (size >= 2 && bytes[0] == '<' && bytes[1] == 0)
+				return ReadDataDoc(Utf16Decoder { bytes, end, false }, node);
+
+			if (size >= 2 && bytes[0] == 0 && bytes[1] == '<')
+				return ReadDataDoc(Utf16Decoder { bytes, end, true }, node);
+
+			return ReadDataDoc(Utf8Decoder { bytes, end, -1 }, node);
 		}
 
 		String SaveDataDoc(const DataNode& node)
@@ -71,7 +601,7 @@ namespace o2
 			{
 				pugi::xml_node newNode = xmlDoc.append_child(docNode->GetName().Data());
 
-				if (!docNode->Data().IsEmpty())
+				if (docNode->GetValueType() != DataNode::ValueType::Empty)
 					newNode.append_child(pugi::node_pcdata).set_value((wchar_t*)docNode->Data());
 
 				SaveDataNode(newNode, *docNode);
@@ -97,7 +627,7 @@ namespace o2
 				{
 					pugi::xml_node newNode = xmlNode.append_child((pugi::char_t*)docNode->GetName().Data());
 
-					if (!docNode->Data().IsEmpty())
+					if (docNode->GetValueType() != DataNode::ValueType::Empty)
 						newNode.append_child(pugi::node_pcdata).set_value((wchar_t*)docNode->Data());
 
 					SaveDataNode(newNode, *docNode);
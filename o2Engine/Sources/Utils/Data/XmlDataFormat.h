@@ -9,7 +9,7 @@ namespace o2
 	namespace XmlDataFormat
 	{
 		bool LoadDataDoc(const WString& data, DataNode& node);
-		void LoadDataNode(const pugi::xml_node& xmlNode, DataNode& dataNode);
+		bool LoadDataDoc(const void* data, UInt size, DataNode& node);
 
 		String SaveDataDoc(const DataNode& node);
 		void SaveDataNode(pugi::xml_node& xmlNode, const DataNode& dataNode);
@@ -125,6 +125,11 @@ namespace o2
 		return false;
 	}
 
+	RectF DragHandle::GetCursorAreaBounds() const
+	{
+		return mRegularSprite ? mRegularSprite->GetUnderPointBounds() : RectF();
+	}
+
 	Vec2F DragHandle::ScreenToLocal(const Vec2F& point)
 	{
 		return screenToLocalTransformFunc(point);
@@ -689,6 +694,7 @@ CLASS_META(o2::DragHandle)
 
 	PUBLIC_FUNCTION(void, Draw);
 	PUBLIC_FUNCTION(bool, IsUnderPoint, const Vec2F&);
+	PUBLIC_FUNCTION(RectF, GetCursorAreaBounds);
 	PUBLIC_FUNCTION(void, SetPosition, const Vec2F&);
 	PUBLIC_FUNCTION(const Vec2F&, GetScreenPosition);
 	PUBLIC_FUNCTION(void, SetDragPosition, const Vec2F&);
@@ -55,6 +55,9 @@ namespace o2
 		// Returns true if point is above this
 		bool IsUnderPoint(const Vec2F& point);
 
+		// Returns regular sprite rectangle, out of which point can't be above this
+		RectF GetCursorAreaBounds() const;
+
 		// Sets position
 		void SetPosition(const Vec2F& position);
 
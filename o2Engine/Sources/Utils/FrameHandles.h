@@ -38,6 +38,9 @@ namespace o2
 		// Returns true if point is in this object
 		bool IsUnderPoint(const Vec2F& point);
 
+		// Returns frame axis aligned rectangle
+		RectF GetCursorAreaBounds() const;
+
 		// Sets pivot editing available
 		void SetPivotEnabled(bool enabled);
 
@@ -4,12 +4,14 @@
 
 namespace o2
 {
-	Curve::Curve()
+	Curve::Curve():
+		mLookupTableSamples(0), mLookupTableBegin(0.0f), mLookupTableInvStep(0.0f)
 	{
 		InitializeProperties();
 	}
 
-	Curve::Curve(float beginCoef, float beginCoefPosition, float endCoef, float endCoefPosition)
+	Curve::Curve(float beginCoef, float beginCoefPosition, float endCoef, float endCoefPosition):
+		mLookupTableSamples(0), mLookupTableBegin(0.0f), mLookupTableInvStep(0.0f)
 	{
 		mKeys.Add(Key(0.0f, 0.0f, 0.0f, 0.0f, beginCoef, Math::Clamp01(beginCoefPosition)));
 		mKeys.Add(Key(1.0f, 1.0f, 1.0f - endCoef, -(1.0f - Math::Clamp01(endCoefPosition)), 0.0f, 0.0f));
@@ -17,14 +19,16 @@ namespace o2
 		InitializeProperties();
 	}
 
-	Curve::Curve(Vector<Vec2F> values, bool smooth /*= true*/)
+	Curve::Curve(Vector<Vec2F> values, bool smooth /*= true*/):
+		mLookupTableSamples(0), mLookupTableBegin(0.0f), mLookupTableInvStep(0.0f)
 	{
 		AppendKeys(values, smooth);
 		InitializeProperties();
 	}
 
 	Curve::Curve(const Curve& other):
-		mKeys(other.mKeys)
+		mKeys(other.mKeys), mLookupTableSamples(other.mLookupTableSamples), mLookupTable(other.mLookupTable),
+		mLookupTableBegin(other.mLookupTableBegin), mLookupTableInvStep(other.mLookupTableInvStep)
 	{
 		InitializeProperties();
 	}
@@ -49,6 +53,7 @@ namespace o2
 	Curve& Curve::operator=(const Curve& other)
 	{
 		mKeys = other.mKeys;
+		mLookupTableSamples = other.mLookupTableSamples;
 		UpdateApproximation();
 		onKeysChanged();
 		return *this;
@@ -60,51 +65,46 @@ namespace o2
 		return *this;
 	}
 
-	float Curve::Evaluate(float position)
+	float Curve::Evaluate(float position) const
 	{
-		int count = mKeys.Count();
+		if (!mLookupTable.IsEmpty())
+			return EvaluateLookupTable(position);
 
-		if (count == 1)
-			return mKeys[0].value;
-		else if (count == 0)
-			return 0.0f;
-
-		int begi = -1, endi = -1;
+		return EvaluateApproximation(position);
+	}
 
-		for (int i = 1; i < count; i++)
+	void Curve::Evaluate(const float* positions, float* values, int count) const
+	{
+		if (mLookupTable.IsEmpty())
 		{
-			begi = i - 1;
-			endi = i;
+			for (int i = 0; i < count; i++)
+				values[i] = EvaluateApproximation(positions[i]);
 
-			if (mKeys[i].position > position)
-				break;
+			return;
 		}
 
-		if (begi < 0)
-			return 0.0f;
-
-		Key& beginKey = mKeys[begi];
-		Key& endKey = mKeys[endi];
-
-		int segBeg = 0;
-		int segEnd = 1;
+		const float* table = mLookupTable.Data();
+		int lastSegment = mLookupTable.Count() - 2;
+		float maxSamplePosition = (float)(mLookupTable.Count() - 1);
 
-		for (int i = 1; i < Key::mApproxValuesCount; i++)
+		for (int i = 0; i < count; i++)
 		{
-			segBeg = i - 1;
-			segEnd = i;
+			float samplePosition = Math::Clamp((positions[i] - mLookupTableBegin)*mLookupTableInvStep, 0.0f, maxSamplePosition);
+			int idx = Math::Min((int)samplePosition, lastSegment);
 
-			if (endKey.mApproxValues[i].x > position)
-				break;
+			values[i] = table[idx] + (table[idx + 1] - table[idx])*(samplePosition - (float)idx);
 		}
+	}
 
-		Vec2F begs = endKey.mApproxValues[segBeg];
-		Vec2F ends = endKey.mApproxValues[segEnd];
-
-		float dist = ends.x - begs.x;
-		float coef = (position - begs.x)/dist;
+	void Curve::SetLookupTableSamples(int samplesCount)
+	{
+		mLookupTableSamples = samplesCount > 0 ? Math::Max(samplesCount, 2) : 0;
+		UpdateLookupTable();
+	}
 
-		return Math::Lerp(begs.y, ends.y, coef);
+	int Curve::GetLookupTableSamples() const
+	{
+		return mLookupTableSamples;
 	}
 
 	void Curve::MoveKeys(float offset)
@@ -447,6 +447,7 @@ namespace o2
 	void Curve::RemoveAllKeys()
 	{
 		mKeys.Clear();
+		UpdateLookupTable();
 		onKeysChanged();
 	}
 
@@ -612,9 +613,63 @@ namespace o2
 			}
 		}
 
+		UpdateLookupTable();
 		onKeysChanged();
 	}
 
+	void Curve::UpdateLookupTable()
+	{
+		mLookupTable.Clear();
+
+		if (mLookupTableSamples == 0 || mKeys.Count() < 2)
+			return;
+
+		float begin = mKeys[0].position;
+		float length = mKeys.Last().position - begin;
+		if (length < FLT_EPSILON)
+			return;
+
+		float step = length/(float)(mLookupTableSamples - 1);
+
+		mLookupTableBegin = begin;
+		mLookupTableInvStep = 1.0f/step;
+
+		mLookupTable.Reserve(mLookupTableSamples);
+		for (int i = 0; i < mLookupTableSamples; i++)
+			mLookupTable.Add(EvaluateApproximation(begin + step*(float)i));
+	}
+
+	float Curve::EvaluateApproximation(float position) const
+	{
+		int count = mKeys.Count();
+
+		if (count == 1)
+			return mKeys[0].value;
+		else if (count == 0)
+			return 0.0f;
+
+		const Key& endKey = mKeys[FindSegmentEndKey(mKeys.Data(), count, position)];
+
+		int segEnd = FindApproxSegmentEnd(endKey.mApproxValues, Key::mApproxValuesCount, position);
+		Vec2F begs = endKey.mApproxValues[segEnd - 1];
+		Vec2F ends = endKey.mApproxValues[segEnd];
+
+		float dist = ends.x - begs.x;
+		float coef = (position - begs.x)/dist;
+
+		return Math::Lerp(begs.y, ends.y, coef);
+	}
+
+	float Curve::EvaluateLookupTable(float position) const
+	{
+		int lastSegment = mLookupTable.Count() - 2;
+		float samplePosition = Math::Clamp((position - mLookupTableBegin)*mLookupTableInvStep, 0.0f,
+										   (float)(lastSegment + 1));
+		int idx = Math::Min((int)samplePosition, lastSegment);
+
+		return Math::Lerp(mLookupTable[idx], mLookupTable[idx + 1], samplePosition - (float)idx);
+	}
+
 	Curve::KeysVec Curve::GetKeysNonContant()
 	{
 		return mKeys;
@@ -782,8 +837,12 @@ CLASS_META(o2::Curve)
 	PUBLIC_FIELD(length);
 	PUBLIC_FIELD(onKeysChanged);
 	PROTECTED_FIELD(mKeys).SERIALIZABLE_ATTRIBUTE();
+	PROTECTED_FIELD(mLookupTableSamples);
 
 	PUBLIC_FUNCTION(float, Evaluate, float);
+	PUBLIC_FUNCTION(void, Evaluate, const float*, float*, int);
+	PUBLIC_FUNCTION(void, SetLookupTableSamples, int);
+	PUBLIC_FUNCTION(int, GetLookupTableSamples);
 	PUBLIC_FUNCTION(void, MoveKeys, float);
 	PUBLIC_FUNCTION(void, MoveKeysFrom, float, float);
 	PUBLIC_FUNCTION(void, AppendCurve, const Curve&);
@@ -821,6 +880,9 @@ CLASS_META(o2::Curve)
 	PUBLIC_FUNCTION(RectF, GetRect);
 	PROTECTED_FUNCTION(void, CheckSmoothKeys);
 	PROTECTED_FUNCTION(void, UpdateApproximation);
+	PROTECTED_FUNCTION(void, UpdateLookupTable);
+	PROTECTED_FUNCTION(float, EvaluateApproximation, float);
+	PROTECTED_FUNCTION(float, EvaluateLookupTable, float);
 	PROTECTED_FUNCTION(KeysVec, GetKeysNonContant);
 	PROTECTED_FUNCTION(void, OnDeserialized, const DataNode&);
 	PROTECTED_FUNCTION(void, InternalSmoothKeyAt, int, float);
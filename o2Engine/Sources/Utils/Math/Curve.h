@@ -8,9 +8,10 @@
 
 namespace o2
 {
-	// ------------
-	// Bezier curve
-	// ------------
+	// -----------------------------------------------------------------------------------------
+	// Bezier curve. Evaluates by approximation points with binary search of keys. Optionally
+	// curve can be resampled uniformly into lookup table, then evaluation takes constant time
+	// -----------------------------------------------------------------------------------------
 	class Curve: public ISerializable
 	{
 	public:
@@ -49,7 +50,17 @@ namespace o2
 		Curve& operator+=(const Curve& other);
 
 		// Returns value by position
-		float Evaluate(float position);
+		float Evaluate(float position) const;
+
+		// Evaluates values by positions array
+		void Evaluate(const float* positions, float* values, int count) const;
+
+		// Sets count of lookup table samples, zero disables lookup table. Lookup table approximates
+		// curve between first and last keys, positions outside are clamped
+		void SetLookupTableSamples(int samplesCount);
+
+		// Returns count of lookup table samples, zero when lookup table is disabled
+		int GetLookupTableSamples() const;
 
 		// Moves all keys positions to offset
 		void MoveKeys(float offset);
@@ -239,7 +250,12 @@ namespace o2
 		};
 
 	protected:
-		KeysVec mKeys; // Curve keys @SERIALIZABLE
+		KeysVec       mKeys;               // Curve keys @SERIALIZABLE
+
+		int           mLookupTableSamples; // Count of lookup table samples, zero when disabled
+		Vector<float> mLookupTable;        // Uniformly resampled values from first to last key
+		float         mLookupTableBegin;   // First lookup table sample position
+		float         mLookupTableInvStep; // Inverted distance between lookup table samples
 
 	protected:
 		// Checks all smooth keys and updates supports points
@@ -248,6 +264,15 @@ namespace o2
 	    // Updates approximation
 		void UpdateApproximation();
 
+		// Resamples curve into lookup table, when it is enabled
+		void UpdateLookupTable();
+
+		// Returns value by position from approximation points
+		float EvaluateApproximation(float position) const;
+
+		// Returns value by position from lookup table
+		float EvaluateLookupTable(float position) const;
+
 		// Returns keys (for property)
 		KeysVec GetKeysNonContant();
 
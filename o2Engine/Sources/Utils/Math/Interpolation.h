@@ -86,4 +86,39 @@ namespace o2
 	{
 		return Bezier(a, b, c, d, SolveBezier(a.x, b.x, c.x, d.x, x)).y;
 	}
+
+	// Returns index of segment end key by binary search: first key with position greater than specified,
+	// clamped to [1, count - 1]. Keys must be sorted by position, count must be at least 2
+	template<typename _key_type>
+	inline int FindSegmentEndKey(const _key_type* keys, int count, float position)
+	{
+		int left = 1, right = count - 1;
+		while (left < right)
+		{
+			int middle = (left + right)/2;
+			if (keys[middle].position > position)
+				right = middle;
+			else
+				left = middle + 1;
+		}
+
+		return left;
+	}
+
+	// Returns index of approximation segment end point by binary search: first point with x greater than
+	// position, clamped to [1, count - 1]. Points must be sorted by x, count must be at least 2
+	inline int FindApproxSegmentEnd(const Vec2F* points, int count, float position)
+	{
+		int left = 1, right = count - 1;
+		while (left < right)
+		{
+			int middle = (left + right)/2;
+			if (points[middle].x > position)
+				right = middle;
+			else
+				left = middle + 1;
+		}
+
+		return left;
+	}
 }
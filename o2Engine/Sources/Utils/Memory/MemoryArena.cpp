@@ -0,0 +1,71 @@
+#include "MemoryArena.h"
+
+#include "Utils/Math/Math.h"
+#include "Utils/Memory/MemoryManager.h"
+
+namespace o2
+{
+	MemoryArena::MemoryArena(UInt firstBlockSize /*= 4096*/):
+		mBlock(nullptr), mPosition(nullptr), mEnd(nullptr), mNextBlockSize(firstBlockSize), mBlocksSize(0),
+		mBlocksCount(0)
+	{}
+
+	MemoryArena::~MemoryArena()
+	{
+		Clear();
+	}
+
+	void* MemoryArena::Allocate(UInt size, UInt align /*= sizeof(void*)*/)
+	{
+		UInt8* res = (UInt8*)(((size_t)mPosition + align - 1) & ~(size_t)(align - 1));
+		if (!mBlock || res + size > mEnd)
+		{
+			AllocateBlock(size, align);
+			res = (UInt8*)(((size_t)mPosition + align - 1) & ~(size_t)(align - 1));
+		}
+
+		mPosition = res + size;
+		return res;
+	}
+
+	void MemoryArena::Clear()
+	{
+		while (mBlock)
+		{
+			Block* prev = mBlock->prev;
+			mfree(mBlock);
+			mBlock = prev;
+		}
+
+		mPosition = nullptr;
+		mEnd = nullptr;
+		mBlocksSize = 0;
+		mBlocksCount = 0;
+	}
+
+	UInt MemoryArena::GetBlocksSize() const
+	{
+		return mBlocksSize;
+	}
+
+	int MemoryArena::GetBlocksCount() const
+	{
+		return mBlocksCount;
+	}
+
+	void MemoryArena::AllocateBlock(UInt size, UInt align)
+	{
+		UInt blockSize = Math::Max(mNextBlockSize, size + align);
+		mNextBlockSize = Math::Min(mNextBlockSize*2, (UInt)mMaxBlockSize);
+
+		Block* block = (Block*)mmalloc(sizeof(Block) + blockSize);
+		block->prev = mBlock;
+		block->size = blockSize;
+
+		mBlock = block;
+		mPosition = (UInt8*)(block + 1);
+		mEnd = mPosition + blockSize;
+		mBlocksSize += blockSize;
+		mBlocksCount++;
+	}
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "Utils/CommonTypes.h"
+
+namespace o2
+{
+	// -----------------------------------------------------------------------------------------
+	// Bump allocator. Allocates memory from blocks by moving position pointer. Allocations can't
+	// be freed separately, all memory is freed at once on clearing or destruction. Each next
+	// block is twice larger than previous, up to maximum block size. Not thread safe
+	// -----------------------------------------------------------------------------------------
+	class MemoryArena
+	{
+	public:
+		// Constructor with first block size
+		MemoryArena(UInt firstBlockSize = 4096);
+
+		// Destructor. Frees all blocks
+		~MemoryArena();
+
+		// Allocates memory with specified alignment. Alignment must be power of two
+		void* Allocate(UInt size, UInt align = sizeof(void*));
+
+		// Allocates uninitialized array of values
+		template<typename _type>
+		_type* Allocate(int count);
+
+		// Frees all allocated memory
+		void Clear();
+
+		// Returns total size of allocated blocks
+		UInt GetBlocksSize() const;
+
+		// Returns count of allocated blocks
+		int GetBlocksCount() const;
+
+	protected:
+		static const UInt mMaxBlockSize = 1024*1024; // Maximum size of block, except blocks for large allocations
+
+		// -----------------------------------------------
+		// Memory block header. Block memory follows header
+		// -----------------------------------------------
+		struct Block
+		{
+			Block* prev; // Previous allocated block
+			UInt   size; // Size of block memory after header
+		};
+
+	protected:
+		Block* mBlock;         // Last allocated block
+		UInt8* mPosition;      // Position of next allocation in last block
+		UInt8* mEnd;           // End of last block memory
+		UInt   mNextBlockSize; // Size of next allocated block
+		UInt   mBlocksSize;    // Total size of allocated blocks
+		int    mBlocksCount;   // Count of allocated blocks
+
+	protected:
+		// Allocates new block, which can contain size bytes with alignment
+		void AllocateBlock(UInt size, UInt align);
+	};
+
+	template<typename _type>
+	_type* MemoryArena::Allocate(int count)
+	{
+		return (_type*)Allocate(sizeof(_type)*(UInt)count, alignof(_type));
+	}
+}
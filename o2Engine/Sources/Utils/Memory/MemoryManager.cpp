@@ -1,6 +1,7 @@
 #include "MemoryManager.h"
 
 #include <algorithm>
+#include <cstring>
 
 #include "Utils/Assert.h"
 #include "Utils/Log/ConsoleLogStream.h"
@@ -11,7 +12,8 @@ void* operator new(size_t size, const char* location, int line)
 	void* memory = ::operator new(size);
 
 #if ENALBE_MEMORY_MANAGE == true
-o2::MemoryManager::mInstance->OnMemoryAllocate(memory, size, location, line);
+	if (o2::MemoryManager::mInstance)
+		o2::MemoryManager::mInstance->OnMemoryAllocate(memory, size, location, line);
 #endif
 
 	return memory;
@@ -20,7 +22,8 @@ o2::MemoryManager::mInstance->OnMemoryAllocate(memory, size, location, line);
 void operator delete(void* allocMemory)
 {
 #if ENALBE_MEMORY_MANAGE == true
-	o2::MemoryManager::mInstance->OnMemoryRelease(allocMemory);
+	if (o2::MemoryManager::mInstance)
+		o2::MemoryManager::mInstance->OnMemoryRelease(allocMemory);
 #endif
 
 	free(allocMemory);
@@ -36,7 +39,8 @@ void* _mmalloc(size_t size, const char* location, int line)
 	void* memory = ::operator new(size);
 
 #if ENALBE_MEMORY_MANAGE == true
-	o2::MemoryManager::mInstance->OnMemoryAllocate(memory, size, location, line);
+	if (o2::MemoryManager::mInstance)
+		o2::MemoryManager::mInstance->OnMemoryAllocate(memory, size, location, line);
 #endif
 
 	return memory;
@@ -45,7 +49,8 @@ void* _mmalloc(size_t size, const char* location, int line)
 void _mfree(void* allocMemory)
 {
 #if ENALBE_MEMORY_MANAGE == true
-	o2::MemoryManager::mInstance->OnMemoryRelease(allocMemory);
+	if (o2::MemoryManager::mInstance)
+		o2::MemoryManager::mInstance->OnMemoryRelease(allocMemory);
 #endif
 
 	free(allocMemory);
@@ -54,12 +59,32 @@ void _mfree(void* allocMemory)
 namespace o2
 {
 	MemoryManager::MemoryManager():
-		mTotalBytes(0)
-	{}
+		mSitesCount(1), mUsedSiteSlots(0), mTotalBytes(0), mPeakBytes(0), mAllocationsCount(0)
+	{
+		for (auto& site : mSites)
+		{
+			site.liveBytes = 0;
+			site.liveCount = 0;
+			site.peakBytes = 0;
+			site.totalCount = 0;
+		}
+
+		mSites[0].source = "<other sites>";
+
+		for (auto& slot : mSiteSlots)
+		{
+			slot.source = nullptr;
+			slot.line = 0;
+			slot.site = 0;
+		}
+	}
 
 	MemoryManager::~MemoryManager()
 	{
 		DumpInfo();
+
+		for (auto& shard : mShards)
+			free(shard.allocs);
 	}
 
 	MemoryManager& MemoryManager::Instance()
@@ -72,83 +97,304 @@ namespace o2
 		mInstance = new MemoryManager();
 	}
 
+	size_t MemoryManager::GetTotalBytes() const
+	{
+		return (size_t)mTotalBytes.load(std::memory_order_relaxed);
+	}
+
+	size_t MemoryManager::GetPeakBytes() const
+	{
+		return (size_t)mPeakBytes.load(std::memory_order_relaxed);
+	}
+
+	int MemoryManager::GetAllocationsCount() const
+	{
+		return mAllocationsCount.load(std::memory_order_relaxed);
+	}
+
+	MemoryManager::AllocSiteStatsVec MemoryManager::GetAllocSitesStats() const
+	{
+		AllocSiteStatsVec res;
+
+		int sitesCount = mSitesCount.load(std::memory_order_acquire);
+		for (int i = 0; i < sitesCount; i++)
+		{
+			const AllocSite& site = mSites[i];
+
+			AllocSiteStats stats;
+			stats.source = site.source;
+			stats.line = site.line;
+			stats.liveBytes = (size_t)site.liveBytes.load(std::memory_order_relaxed);
+			stats.liveCount = site.liveCount.load(std::memory_order_relaxed);
+			stats.peakBytes = (size_t)site.peakBytes.load(std::memory_order_relaxed);
+			stats.totalCount = site.totalCount.load(std::memory_order_relaxed);
+
+			if (stats.totalCount > 0)
+				res.push_back(stats);
+		}
+
+		std::sort(res.begin(), res.end(), [](const AllocSiteStats& a, const AllocSiteStats& b) { return b < a; });
+
+		return res;
+	}
+
+	MemoryManager::AllocSiteStats MemoryManager::GetAllocSiteStats(const char* source, int line) const
+	{
+		AllocSiteStats res;
+		res.source = source;
+		res.line = line;
+
+		int sitesCount = mSitesCount.load(std::memory_order_acquire);
+		for (int i = 1; i < sitesCount; i++)
+		{
+			const AllocSite& site = mSites[i];
+			if (site.line != line || strcmp(site.source, source) != 0)
+				continue;
+
+			res.liveBytes = (size_t)site.liveBytes.load(std::memory_order_relaxed);
+			res.liveCount = site.liveCount.load(std::memory_order_relaxed);
+			res.peakBytes = (size_t)site.peakBytes.load(std::memory_order_relaxed);
+			res.totalCount = site.totalCount.load(std::memory_order_relaxed);
+			break;
+		}
+
+		return res;
+	}
+
+	void MemoryManager::ResetStats()
+	{
+		int sitesCount = mSitesCount.load(std::memory_order_acquire);
+		for (int i = 0; i < sitesCount; i++)
+		{
+			AllocSite& site = mSites[i];
+			site.peakBytes = site.liveBytes.load(std::memory_order_relaxed);
+			site.totalCount = site.liveCount.load(std::memory_order_relaxed);
+		}
+
+		mPeakBytes = mTotalBytes.load(std::memory_order_relaxed);
+	}
+
 	void MemoryManager::OnMemoryAllocate(void* memory, size_t size, const char* source, int line)
 	{
+		int siteIdx = GetSiteIndex(source, line);
+		AllocSite& site = mSites[siteIdx];
+
+		Int64 siteBytes = site.liveBytes.fetch_add((Int64)size, std::memory_order_relaxed) + (Int64)size;
+		site.liveCount.fetch_add(1, std::memory_order_relaxed);
+		site.totalCount.fetch_add(1, std::memory_order_relaxed);
+		UpdateMax(site.peakBytes, siteBytes);
+
+		Int64 totalBytes = mTotalBytes.fetch_add((Int64)size, std::memory_order_relaxed) + (Int64)size;
+		mAllocationsCount.fetch_add(1, std::memory_order_relaxed);
+		UpdateMax(mPeakBytes, totalBytes);
+
 		AllocInfo info;
 		info.memory = memory;
 		info.size = size;
-		info.sourceLine = line;
-		info.source = source;
-		mAllocs[memory] = info;
-		mTotalBytes += size;
+		info.site = siteIdx;
+
+		AllocsShard& shard = GetShard(memory);
+		std::lock_guard<std::mutex> guard(shard.lock);
+		InsertAlloc(shard, info);
 	}
 
 	void MemoryManager::OnMemoryRelease(void* memory)
 	{
-		AllocsInfosMap::iterator fnd = mAllocs.find(memory);
-		if (fnd != mAllocs.end())
+		if (!memory)
+			return;
+
+		AllocInfo info;
+		AllocsShard& shard = GetShard(memory);
 		{
-			mTotalBytes -= (*fnd).second.size;
-			mAllocs.erase(fnd);
+			std::lock_guard<std::mutex> guard(shard.lock);
+			if (!RemoveAlloc(shard, memory, info))
+				return;
 		}
+
+		AllocSite& site = mSites[info.site];
+		site.liveBytes.fetch_sub((Int64)info.size, std::memory_order_relaxed);
+		site.liveCount.fetch_sub(1, std::memory_order_relaxed);
+
+		mTotalBytes.fetch_sub((Int64)info.size, std::memory_order_relaxed);
+		mAllocationsCount.fetch_sub(1, std::memory_order_relaxed);
 	}
 
-	void MemoryManager::DumpInfo()
+	int MemoryManager::GetSiteIndex(const char* source, int line)
 	{
-		printf("========MemoryManager::DumpInfo==========\n");
+		const int mask = mSiteSlotsCount - 1;
+		int start = (int)((HashPointer(source) ^ (UInt64)line*0x9E3779B97F4A7C15ULL) >> 32) & mask;
 
-		printf("Total managed allocations: %f MB\n", (float)mTotalBytes / 1024.0f / 1024.0f);
+		// Fast lock free path: site was already registered with this source pointer
+		for (int i = start; ; i = (i + 1) & mask)
+		{
+			const char* slotSource = mSiteSlots[i].source.load(std::memory_order_acquire);
+			if (!slotSource)
+				break;
+
+			if (slotSource == source && mSiteSlots[i].line == line)
+				return mSiteSlots[i].site;
+		}
+
+		std::lock_guard<std::mutex> guard(mSitesLock);
 
-		struct allocSrc
+		int slotIdx = start;
+		for (; ; slotIdx = (slotIdx + 1) & mask)
 		{
-			char source[128];
-			int line = 0;
-			int size = 0;
-			int count = 0;
+			const char* slotSource = mSiteSlots[slotIdx].source.load(std::memory_order_relaxed);
+			if (!slotSource)
+				break;
 
-			bool operator<(const allocSrc& other) const
+			if (slotSource == source && mSiteSlots[slotIdx].line == line)
+				return mSiteSlots[slotIdx].site;
+		}
+
+		// Same site can be already registered from other translation unit with other source pointer
+		int sitesCount = mSitesCount.load(std::memory_order_relaxed);
+		int siteIdx = -1;
+		for (int i = 1; i < sitesCount; i++)
+		{
+			if (mSites[i].line == line && strcmp(mSites[i].source, source) == 0)
 			{
-				return size < other.size;
+				siteIdx = i;
+				break;
 			}
-		};
-		std::vector<allocSrc> allocs;
+		}
+
+		if (siteIdx < 0)
+		{
+			if (sitesCount == mMaxSites)
+				return 0;
+
+			siteIdx = sitesCount;
+			mSites[siteIdx].source = source;
+			mSites[siteIdx].line = line;
+			mSitesCount.store(sitesCount + 1, std::memory_order_release);
+		}
+
+		// Keeping at least one slot empty, so lookup always stops
+		if (mUsedSiteSlots + 1 >= mSiteSlotsCount)
+			return siteIdx;
 
-		int i = 0;
-		for (auto it = mAllocs.begin(); it != mAllocs.end(); ++it, i++)
+		mUsedSiteSlots++;
+
+		mSiteSlots[slotIdx].line = line;
+		mSiteSlots[slotIdx].site = siteIdx;
+		mSiteSlots[slotIdx].source.store(source, std::memory_order_release);
+
+		return siteIdx;
+	}
+
+	MemoryManager::AllocsShard& MemoryManager::GetShard(void* memory)
+	{
+		return mShards[(HashPointer(memory) >> 58) & (mShardsCount - 1)];
+	}
+
+	void MemoryManager::InsertAlloc(AllocsShard& shard, const AllocInfo& info)
+	{
+		if ((shard.count + 1)*2 > shard.capacity)
 		{
-			auto& info = (*it).second;
+			int newCapacity = shard.capacity > 0 ? shard.capacity*2 : 256;
+			AllocInfo* newAllocs = (AllocInfo*)calloc(newCapacity, sizeof(AllocInfo));
 
-			bool found = false;
-			for (auto& allc : allocs)
+			for (int i = 0; i < shard.capacity; i++)
 			{
-				if (allc.line == info.sourceLine && strcmp(allc.source, info.source) == 0)
-				{
-					allc.size += info.size;
-					allc.count++;
-					found = true;
-					break;
-				}
+				if (!shard.allocs[i].memory)
+					continue;
+
+				int slot = (int)HashPointer(shard.allocs[i].memory) & (newCapacity - 1);
+				while (newAllocs[slot].memory)
+					slot = (slot + 1) & (newCapacity - 1);
+
+				newAllocs[slot] = shard.allocs[i];
 			}
 
-			if (!found)
-			{
-				allocSrc allc;
-				allc.line = info.sourceLine;
-				strncpy(allc.source, info.source, 127);
-				allc.size = info.size;
-				allc.count = 1;
+			free(shard.allocs);
+			shard.allocs = newAllocs;
+			shard.capacity = newCapacity;
+		}
+
+		int mask = shard.capacity - 1;
+		int slot = (int)HashPointer(info.memory) & mask;
+		while (shard.allocs[slot].memory && shard.allocs[slot].memory != info.memory)
+			slot = (slot + 1) & mask;
 
-				allocs.push_back(allc);
+		if (!shard.allocs[slot].memory)
+			shard.count++;
+
+		shard.allocs[slot] = info;
+	}
+
+	bool MemoryManager::RemoveAlloc(AllocsShard& shard, void* memory, AllocInfo& info)
+	{
+		if (shard.count == 0)
+			return false;
+
+		int mask = shard.capacity - 1;
+		int slot = (int)HashPointer(memory) & mask;
+		while (shard.allocs[slot].memory != memory)
+		{
+			if (!shard.allocs[slot].memory)
+				return false;
+
+			slot = (slot + 1) & mask;
+		}
+
+		info = shard.allocs[slot];
+		shard.count--;
+
+		// Backward shift deletion, keeps probe sequences without tombstones
+		int hole = slot;
+		for (int next = (hole + 1) & mask; shard.allocs[next].memory; next = (next + 1) & mask)
+		{
+			int home = (int)HashPointer(shard.allocs[next].memory) & mask;
+			bool inRange = hole <= next ? (home > hole && home <= next) : (home > hole || home <= next);
+			if (!inRange)
+			{
+				shard.allocs[hole] = shard.allocs[next];
+				hole = next;
 			}
 		}
 
-		std::sort(allocs.begin(), allocs.end());
+		shard.allocs[hole].memory = nullptr;
+
+		return true;
+	}
+
+	UInt64 MemoryManager::HashPointer(const void* memory)
+	{
+		UInt64 x = (UInt64)memory;
+		x ^= x >> 33;
+		x *= 0xff51afd7ed558ccdULL;
+		x ^= x >> 33;
+		return x;
+	}
+
+	void MemoryManager::UpdateMax(std::atomic<Int64>& maxValue, Int64 value)
+	{
+		Int64 current = maxValue.load(std::memory_order_relaxed);
+		while (value > current && !maxValue.compare_exchange_weak(current, value, std::memory_order_relaxed))
+		{}
+	}
 
+	void MemoryManager::DumpInfo()
+	{
+		printf("========MemoryManager::DumpInfo==========\n");
+
+		printf("Total managed allocations: %f MB in %i allocs, peak %f MB\n",
+			   (float)GetTotalBytes() / 1024.0f / 1024.0f, GetAllocationsCount(),
+			   (float)GetPeakBytes() / 1024.0f / 1024.0f);
+
+		AllocSiteStatsVec allocs = GetAllocSitesStats();
 		for (int i = 0; i < (int)allocs.size(); i++)
 		{
-			printf("%i: %s : %i - %i bytes (%f MB) in %i allocs\n",
-				   i, allocs[i].source, allocs[i].line, allocs[i].size,
-				   (float)allocs[i].size / 1024.0f / 1024.0f, allocs[i].count);
+			auto& site = allocs[i];
+			if (site.liveCount == 0)
+				continue;
+
+			printf("%i: %s : %i - %i bytes (%f MB) in %i allocs, peak %f MB, total %llu allocs\n",
+				   i, site.source, site.line, (int)site.liveBytes,
+				   (float)site.liveBytes / 1024.0f / 1024.0f, site.liveCount,
+				   (float)site.peakBytes / 1024.0f / 1024.0f, site.totalCount);
 		}
 
 		printf("========END==========\n");
@@ -1,7 +1,8 @@
 #pragma once
 
+#include <atomic>
+#include <mutex>
 #include <vector>
-#include <map>
 
 #include "EngineSettings.h"
 #include "Utils/CommonTypes.h"
@@ -37,11 +38,30 @@ namespace o2
 {
 	class LogStream;
 
-	// ------------------------------------------------------------------
-	// Memory manager, using for collecting garbage, tracing memory leaks
-	// ------------------------------------------------------------------
+	// -------------------------------------------------------------------------------
+	// Memory manager, using for tracing memory leaks and allocations statistics.
+	// Allocations are registered in sharded hash tables, counters are aggregated
+	// per allocation source code site. Thread safe
+	// -------------------------------------------------------------------------------
 	class MemoryManager
 	{
+	public:
+		// ----------------------------------
+		// Allocation source site statistics
+		// ----------------------------------
+		struct AllocSiteStats
+		{
+			const char* source = nullptr; // Allocation source code file
+			int         line = 0;         // Allocation source code line
+			size_t      liveBytes = 0;    // Currently allocated bytes
+			int         liveCount = 0;    // Currently allocated blocks count
+			size_t      peakBytes = 0;    // Maximum of allocated bytes
+			UInt64      totalCount = 0;   // Total allocations count since start or ResetStats
+
+			bool operator<(const AllocSiteStats& other) const { return liveBytes < other.liveBytes; }
+		};
+		typedef std::vector<AllocSiteStats> AllocSiteStatsVec;
+
 	public:
 		// Constructor
 		MemoryManager();
@@ -55,26 +75,90 @@ namespace o2
 		// Initializes memory manager
 		static void Initialize();
 
+		// Returns total managed allocated bytes
+		size_t GetTotalBytes() const;
+
+		// Returns maximum of total managed allocated bytes
+		size_t GetPeakBytes() const;
+
+		// Returns count of live managed allocations
+		int GetAllocationsCount() const;
+
+		// Returns statistics of all allocation sites, sorted by live bytes descending
+		AllocSiteStatsVec GetAllocSitesStats() const;
+
+		// Returns statistics of allocation site
+		AllocSiteStats GetAllocSiteStats(const char* source, int line) const;
+
+		// Resets peaks and total allocations counters to current values
+		void ResetStats();
+
 		// Collects information about allocated memory and prints into console
 		void DumpInfo();
 
 	protected:
-		// ----------------------
-		// Allocation information
-		// ----------------------
+		// -------------------------------------------------------------
+		// Allocation site counters. Same file and line from different
+		// translation units can have different source pointers, they
+		// are collapsed into one site
+		// -------------------------------------------------------------
+		struct AllocSite
+		{
+			const char*         source = nullptr; // Allocation source code file
+			int                 line = 0;         // Allocation source code line
+			std::atomic<Int64>  liveBytes;        // Currently allocated bytes
+			std::atomic<int>    liveCount;        // Currently allocated blocks count
+			std::atomic<Int64>  peakBytes;        // Maximum of allocated bytes
+			std::atomic<UInt64> totalCount;       // Total allocations count
+		};
+
+		// -----------------------------------------------------------------
+		// Site lookup table slot. Key is source pointer and line, published
+		// with release store of source, so reading doesn't need lock
+		// -----------------------------------------------------------------
+		struct SiteSlot
+		{
+			std::atomic<const char*> source; // Allocation source code file pointer
+			int                      line;   // Allocation source code line
+			int                      site;   // Index of site in mSites
+		};
+
+		// -------------------------------------------
+		// Registered allocation, open-addressing entry
+		// -------------------------------------------
 		struct AllocInfo
 		{
-			const char* source;     // Allocation source code file
-			int         sourceLine; // Allocation source code line
-			size_t      size;       // Allocated size in bytes
-			void*       memory;     // Pointer to allocated memory
+			void*  memory; // Pointer to allocated memory, nullptr when entry is empty
+			size_t size;   // Allocated size in bytes
+			int    site;   // Index of allocation site
 		};
-		typedef std::map<void*, AllocInfo> AllocsInfosMap;
+
+		// ------------------------------------------------------------
+		// Allocations shard. Open-addressing table guarded by own lock
+		// ------------------------------------------------------------
+		struct AllocsShard
+		{
+			std::mutex lock;               // Shard lock
+			AllocInfo* allocs = nullptr;   // Allocations table, allocated with calloc
+			int        capacity = 0;       // Size of allocations table, power of two
+			int        count = 0;          // Count of registered allocations
+		};
+
+		static const int mShardsCount = 64;      // Count of allocations shards, power of two
+		static const int mMaxSites = 8192;       // Maximum count of different allocation sites
+		static const int mSiteSlotsCount = 16384;// Size of sites lookup table, power of two
 
 		static MemoryManager* mInstance; // Instance pointer
 
-		AllocsInfosMap mAllocs;          // Allocations info
-		size_t         mTotalBytes;      // Total managed allocated bytes
+		AllocsShard         mShards[mShardsCount];       // Allocations shards
+		AllocSite           mSites[mMaxSites];           // Allocation sites. First site collects overflowed sites
+		std::atomic<int>    mSitesCount;                 // Count of used sites
+		SiteSlot            mSiteSlots[mSiteSlotsCount]; // Sites lookup table by source pointer and line
+		int                 mUsedSiteSlots;              // Count of used slots in mSiteSlots
+		std::mutex          mSitesLock;                  // Lock for adding new sites
+		std::atomic<Int64>  mTotalBytes;                 // Total managed allocated bytes
+		std::atomic<Int64>  mPeakBytes;                  // Maximum of total managed allocated bytes
+		std::atomic<int>    mAllocationsCount;           // Count of live managed allocations
 
 	protected:
 		// It is called when memory was allocated and registers allocation
@@ -83,6 +167,24 @@ namespace o2
 		// It is called when memory releasing, unregisters allocation
 		void OnMemoryRelease(void* memory);
 
+		// Returns index of site by source and line, adds new site when not found
+		int GetSiteIndex(const char* source, int line);
+
+		// Returns shard for memory pointer
+		AllocsShard& GetShard(void* memory);
+
+		// Inserts allocation into shard table, grows table when needed. Shard must be locked
+		void InsertAlloc(AllocsShard& shard, const AllocInfo& info);
+
+		// Removes allocation from shard table and returns it's info. Returns false when not found. Shard must be locked
+		bool RemoveAlloc(AllocsShard& shard, void* memory, AllocInfo& info);
+
+		// Returns hash of memory pointer
+		static UInt64 HashPointer(const void* memory);
+
+		// Updates atomic maximum value
+		static void UpdateMax(std::atomic<Int64>& maxValue, Int64 value);
+
 		friend void* ::operator new(size_t size, const char* location, int line);
 		friend void  ::operator delete(void* allocMemory);
 		friend void* ::_mmalloc(size_t size, const char* location, int line);
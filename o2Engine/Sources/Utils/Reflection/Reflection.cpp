@@ -43,6 +43,10 @@ namespace o2
 			if (type->mInitializeFunc)
 				type->mInitializeFunc(type);
 		}
+
+		// Base types are known only when all types are initialized
+		for (auto type : mInstance->mTypes)
+			type->UpdateAllBaseTypesIds();
 	}
 
 	const Vector<Type*>& Reflection::GetTypes()
@@ -52,33 +56,26 @@ namespace o2
 
 	void* Reflection::CreateTypeSample(const String& typeName)
 	{
-		for (auto type : mInstance->mTypes)
-		{
-			if (type->GetName() == typeName)
-				return type->CreateSample();
-		}
+		Type* type = nullptr;
+		if (mInstance->mTypesByName.TryGetValue(typeName, type))
+			return type->CreateSample();
 
 		return nullptr;
 	}
 
 	const Type* Reflection::GetType(TypeId id)
 	{
-		for (auto type : mInstance->mTypes)
-		{
-			if (type->ID() == id)
-				return type;
-		}
+		Type* type = nullptr;
+		mInstance->mTypesById.TryGetValue(id, type);
 
-		return nullptr;
+		return type;
 	}
 
 	const Type* Reflection::GetType(const String& name)
 	{
-		for (auto type : mInstance->mTypes)
-		{
-			if (type->GetName() == name)
-				return type;
-		}
+		Type* type = nullptr;
+		if (mInstance->mTypesByName.TryGetValue(name, type))
+			return type;
 
 		if (name[name.Length() - 1] == '*')
 		{
@@ -95,8 +92,19 @@ namespace o2
 		FundamentalTypeContainer<void>::type->mId = mInstance->mLastGivenTypeId++;
 		Type::Dummy::type->mId = mInstance->mLastGivenTypeId++;
 
-		mInstance->mTypes.Add(FundamentalTypeContainer<void>::type);
-		mInstance->mTypes.Add(Type::Dummy::type);
+		AddType(FundamentalTypeContainer<void>::type);
+		AddType(Type::Dummy::type);
+	}
+
+	void Reflection::AddType(Type* type)
+	{
+		Reflection& instance = Instance();
+		instance.mTypes.Add(type);
+
+		if (!instance.mTypesByName.ContainsKey(type->mName))
+			instance.mTypesByName.Add(type->mName, type);
+
+		instance.mTypesById.Add(type->mId, type);
 	}
 
 	const Type* Reflection::InitializePointerType(const Type* type)
@@ -109,7 +117,7 @@ namespace o2
 
 		type->mPtrType = newType;
 
-		mInstance->mTypes.Add(newType);
+		AddType(newType);
 
 		return newType;
 	}
@@ -4,6 +4,7 @@
 #include "Utils/Containers/Pair.h"
 #include "Utils/Containers/Vector.h"
 #include "Utils/Containers/Dictionary.h"
+#include "Utils/Containers/HashDictionary.h"
 #include "Utils/StringDef.h"
 
 // Reflection access macros
@@ -87,8 +88,10 @@ namespace o2
 	protected:
 		static Reflection* mInstance;        // Reflection instance
 
-		Vector<Type*>      mTypes;           // All registered types
-		UInt               mLastGivenTypeId; // Last given type index
+		Vector<Type*>                 mTypes;           // All registered types
+		HashDictionary<String, Type*> mTypesByName;     // Registered types by name
+		HashDictionary<TypeId, Type*> mTypesById;       // Registered types by id
+		UInt                          mLastGivenTypeId; // Last given type index
 
 	protected:
 		// Constructor. Initializes dummy type
@@ -100,6 +103,9 @@ namespace o2
 		// Initializes fundamental types
 		static void InitializeFundamentalTypes();
 
+		// Adds type into types list and name and id indexes
+		static void AddType(Type* type);
+
 		friend class Type;
 	};
 }
@@ -163,7 +169,7 @@ namespace o2
 		res->mInitializeFunc = &_type::InitializeType;
 		res->mId = Reflection::Instance().mLastGivenTypeId++;
 
-		Reflection::Instance().mTypes.Add(res);
+		AddType(res);
 
 		//printf("Reflection::InitializeType(%s): instance:%x - %i\n", name, mInstance, Reflection::Instance().mTypes.Count());
 
@@ -177,7 +183,7 @@ namespace o2
 
 		res->mInitializeFunc = &FundamentalType<_type>::InitializeType;
 		res->mId = Reflection::Instance().mLastGivenTypeId++;
-		Reflection::Instance().mTypes.Add(res);
+		AddType(res);
 
 		return res;
 	}
@@ -189,7 +195,7 @@ namespace o2
 
 		res->mInitializeFunc = nullptr;
 		res->mId = Reflection::Instance().mLastGivenTypeId++;
-		Reflection::Instance().mTypes.Add(res);
+		AddType(res);
 		res->mEntries.Add(func());
 
 		return res;
@@ -200,13 +206,14 @@ namespace o2
 	{
 		String typeName = "o2::Property<" + TypeOf(_value_type).GetName() + ">";
 
-		if (auto fnd = mInstance->mTypes.FindMatch([&](auto x) { return x->mName == typeName; }))
+		Type* fnd = nullptr;
+		if (mInstance->mTypesByName.TryGetValue(typeName, fnd))
 			return (PropertyType*)fnd;
 
 		TPropertyType<_value_type>* newType = new TPropertyType<_value_type>();
 		newType->mId = mInstance->mLastGivenTypeId++;
 
-		mInstance->mTypes.Add(newType);
+		AddType(newType);
 
 		return newType;
 	}
@@ -216,13 +223,14 @@ namespace o2
 	{
 		String typeName = "o2::Vector<" + TypeOf(_element_type).GetName() + ">";
 
-		if (auto fnd = mInstance->mTypes.FindMatch([&](auto x) { return x->mName == typeName; }))
+		Type* fnd = nullptr;
+		if (mInstance->mTypesByName.TryGetValue(typeName, fnd))
 			return (VectorType*)fnd;
 
 		TVectorType<_element_type>* newType = new TVectorType<_element_type>();
 		newType->mId = mInstance->mLastGivenTypeId++;
 
-		mInstance->mTypes.Add(newType);
+		AddType(newType);
 
 		return newType;
 	}
@@ -232,7 +240,8 @@ namespace o2
 	{
 		String typeName = "o2::Dictionary<" + TypeOf(_key_type).GetName() + ", " + TypeOf(_value_type).GetName() + ">";
 
-		if (auto fnd = mInstance->mTypes.FindMatch([&](auto x) { return x->mName == typeName; }))
+		Type* fnd = nullptr;
+		if (mInstance->mTypesByName.TryGetValue(typeName, fnd))
 			return (DictionaryType*)fnd;
 
 		_key_type* x = nullptr;
@@ -240,7 +249,7 @@ namespace o2
 		DictionaryType* newType = new DictionaryType(x, y);
 		newType->mId = mInstance->mLastGivenTypeId++;
 
-		mInstance->mTypes.Add(newType);
+		AddType(newType);
 
 		return newType;
 	}
@@ -251,13 +260,14 @@ namespace o2
 		const Type* type = &TypeOf(_return_type);
 		String typeName = "o2::Accessor<" + type->mName + "*, const o2::String&>";
 
-		if (auto fnd = mInstance->mTypes.FindMatch([&](auto x) { return x->mName == typeName; }))
+		Type* fnd = nullptr;
+		if (mInstance->mTypesByName.TryGetValue(typeName, fnd))
 			return (StringPointerAccessorType<_return_type>*)fnd;
 
 		StringPointerAccessorType<_return_type>* newType = new StringPointerAccessorType<_return_type>();
 		newType->mId = mInstance->mLastGivenTypeId++;
 
-		mInstance->mTypes.Add(newType);
+		AddType(newType);
 
 		return newType;
 	}
@@ -1,5 +1,6 @@
 #include "Type.h"
 
+#include <algorithm>
 #include "Utils/Data/DataNode.h"
 #include "Utils/IObject.h"
 #include "Utils/Reflection/Reflection.h"
@@ -47,11 +48,11 @@ namespace o2
 		if (mId == other.mId)
 			return true;
 
+		if (!mAllBaseTypesIds.IsEmpty())
+			return std::binary_search(mAllBaseTypesIds.Data(), mAllBaseTypesIds.Data() + mAllBaseTypesIds.Count(), other.mId);
+
 		for (auto type : mBaseTypes)
 		{
-			if (type->mId == mId)
-				return true;
-
 			if (type->IsBasedOn(other))
 				return true;
 		}
@@ -77,6 +78,32 @@ namespace o2
 		return mBaseTypes;
 	}
 
+	const Type::TypesIdsVec& Type::GetAllBaseTypesIds() const
+	{
+		return mAllBaseTypesIds;
+	}
+
+	void Type::UpdateAllBaseTypesIds()
+	{
+		mAllBaseTypesIds.Clear();
+		mAllBaseTypesIds.Add(mId);
+		CollectBaseTypesIds(mAllBaseTypesIds);
+
+		// Same base type can be reached by different paths
+		TypeId* begin = mAllBaseTypesIds.Data();
+		std::sort(begin, begin + mAllBaseTypesIds.Count());
+		mAllBaseTypesIds.Resize((int)(std::unique(begin, begin + mAllBaseTypesIds.Count()) - begin));
+	}
+
+	void Type::CollectBaseTypesIds(TypesIdsVec& ids) const
+	{
+		for (auto baseType : mBaseTypes)
+		{
+			ids.Add(baseType->mId);
+			baseType->CollectBaseTypesIds(ids);
+		}
+	}
+
 	const Type::FieldInfosVec& Type::GetFields() const
 	{
 		return mFields;
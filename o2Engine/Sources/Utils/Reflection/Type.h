@@ -62,6 +62,7 @@ namespace o2
 		typedef Vector<FieldInfo*> FieldInfosVec;
 		typedef Vector<FunctionInfo*> FunctionsInfosVec;
 		typedef Vector<Type*> TypesVec;
+		typedef Vector<TypeId> TypesIdsVec;
 
 	public:
 		// Default constructor
@@ -97,6 +98,9 @@ namespace o2
 		// Returns vector of base types
 		const TypesVec& GetBaseTypes() const;
 
+		// Returns sorted ids of this and all base types with their bases. Calculated at types initialization
+		const TypesIdsVec& GetAllBaseTypesIds() const;
+
 		// Returns fields informations array
 		const FieldInfosVec& GetFields() const;
 
@@ -138,18 +142,25 @@ namespace o2
 		struct Dummy { static Type* type; };
 
 	protected:
-		TypeId                mId;            // Id of type
-		String                mName;          // Name of object type
-		TypesVec              mBaseTypes;     // Base types ids
-		FieldInfosVec         mFields;        // Fields information
-		FunctionsInfosVec     mFunctions;     // Functions informations
-		ITypeSampleCreator*   mSampleCreator; // Template type agent
-		mutable Type*         mPtrType;       // Pointer type from this
-		int                   mSize;          // Size of type in bytes
-
-		void(*mInitializeFunc)(Type*);    // Type initializing function
+		TypeId                mId;              // Id of type
+		String                mName;            // Name of object type
+		TypesVec              mBaseTypes;       // Base types ids
+		TypesIdsVec           mAllBaseTypesIds; // Sorted ids of this and all base types. Empty until types initialized
+		FieldInfosVec         mFields;          // Fields information
+		FunctionsInfosVec     mFunctions;       // Functions informations
+		ITypeSampleCreator*   mSampleCreator;   // Template type agent
+		mutable Type*         mPtrType;         // Pointer type from this
+		int                   mSize;            // Size of type in bytes
+
+		void(*mInitializeFunc)(Type*);          // Type initializing function
 
 	protected:
+		// Calculates sorted ids of this and all base types
+		void UpdateAllBaseTypesIds();
+
+		// Adds ids of base types with their bases into ids
+		void CollectBaseTypesIds(TypesIdsVec& ids) const;
+
 		// Searches field recursively by pointer
 		virtual FieldInfo* SearchFieldPath(void* obj, void* target, const String& path, String& res,
 										   Vector<void*>& passedObjects) const;
@@ -796,6 +807,7 @@ namespace o2
 		Type*& baseType = X::type;
 
 		type->mBaseTypes.Add(baseType);
+		type->mAllBaseTypesIds.Clear();
 	}
 
 	template<typename _type>
@@ -4,21 +4,22 @@
 
 namespace o2
 {
-	Task::Task()
+	Task::Task():
+		mIndex(-1)
 	{
-		mId = o2Tasks.mLastTaskId++;
-		o2Tasks.mTasks.Add(this);
+		o2Tasks.AddTask(this);
 	}
 
-	Task::Task(const Task& other)
+	Task::Task(const Task& other):
+		mIndex(-1)
 	{
-		mId = o2Tasks.mLastTaskId++;
-		o2Tasks.mTasks.Add(this);
+		o2Tasks.AddTask(this);
 	}
 
 	Task::~Task()
 	{
-		o2Tasks.mTasks.Remove(this);
+		if (mIndex >= 0)
+			o2Tasks.RemoveTask(this);
 	}
 
 	void Task::Update(float dt)
@@ -34,6 +35,11 @@ namespace o2
 		return mId;
 	}
 
+	void Task::Release()
+	{
+		delete this;
+	}
+
 	void FunctionalTask::Update(float dt)
 	{
 		update(dt);
@@ -44,6 +50,11 @@ namespace o2
 		return isDone();
 	}
 
+	void FunctionalTask::Release()
+	{
+		o2Tasks.mFunctionalTasksPool.Destroy(this);
+	}
+
 	TimeTask::TimeTask(float time /*= 1.0f*/):
 		Task(), mRemainingTime(time)
 	{}
@@ -64,9 +75,15 @@ namespace o2
 
 	void FunctionalTimeTask::Update(float dt)
 	{
+		TimeTask::Update(dt);
 		update(dt);
 	}
 
+	void FunctionalTimeTask::Release()
+	{
+		o2Tasks.mFunctionalTimeTasksPool.Destroy(this);
+	}
+
 	DelayedTask::DelayedTask(float delay /*= 0.0f*/):
 		Task(), mRemainingToCallTime(delay)
 	{}
@@ -95,4 +112,8 @@ namespace o2
 		doTask();
 	}
 
+	void FunctionalDelayedTask::Release()
+	{
+		o2Tasks.mFunctionalDelayedTasksPool.Destroy(this);
+	}
 }
\ No newline at end of file
@@ -17,7 +17,7 @@ namespace o2
 		Task(const Task& other);
 
 		// Destructor. Removes from tasks manager
-		~Task();
+		virtual ~Task();
 
 		// Updates task
 		virtual void Update(float dt);
@@ -29,7 +29,12 @@ namespace o2
 		int ID() const;
 
 	protected:
-		int mId; // Task identificator
+		int mId;    // Task identificator
+		int mIndex; // Index in tasks manager's tasks array, -1 when task isn't registered
+
+	protected:
+		// It is called by tasks manager, when task is done or stopped. Deletes task
+		virtual void Release();
 
 		friend class TaskManager;
 	};
@@ -45,6 +50,10 @@ namespace o2
 
 		void Update(float dt);
 		bool IsDone() const;
+
+	protected:
+		// Destroys task and returns it's slot into tasks manager's pool
+		void Release();
 	};
 
 	// ----------
@@ -72,12 +81,18 @@ namespace o2
 
 		FunctionalTimeTask(float time = 1.0f);
 		void Update(float dt);
+
+	protected:
+		// Destroys task and returns it's slot into tasks manager's pool
+		void Release();
+
+		friend class TaskManager;
 	};
 
 	// ------------
 	// Delayed task
 	// ------------
-	class DelayedTask: Task
+	class DelayedTask: public Task
 	{
 	public:
 		DelayedTask(float delay = 0.0f);
@@ -95,7 +110,7 @@ namespace o2
 	// -----------------------
 	// Functional delayed task
 	// -----------------------
-	class FunctionalDelayedTask: DelayedTask
+	class FunctionalDelayedTask: public DelayedTask
 	{
 	public:
 		Function<void()> doTask;
@@ -104,5 +119,10 @@ namespace o2
 
 	protected:
 		void DoTask();
+
+		// Destroys task and returns it's slot into tasks manager's pool
+		void Release();
+
+		friend class TaskManager;
 	};
 }
@@ -1,6 +1,7 @@
 #include "TaskManager.h"
 
 #include "Utils/AnimationTask.h"
+#include "Utils/Math/Math.h"
 #include "Utils/Task.h"
 
 namespace o2
@@ -9,72 +10,488 @@ namespace o2
 
 	void TaskManager::StopTask(int id)
 	{
-		for (auto task : mTasks)
-		{
-			if (task->mId == id)
-			{
-				delete task;
-				return;
-			}
-		}
+		if (Task** task = mTasksByIds.TryGet(id))
+			ReleaseTask(*task);
 	}
 
 	void TaskManager::StopAllTasks()
 	{
-		auto tasks = mTasks;
-		for (auto task : tasks)
-			delete task;
+		while (!mTasks.IsEmpty())
+			ReleaseTask(mTasks.Last());
 	}
 
 	Task* TaskManager::FindTask(int id)
 	{
-		return mTasks.FindMatch([&](auto x) { return x->mId == id; });
+		if (Task** task = mTasksByIds.TryGet(id))
+			return *task;
+
+		return nullptr;
 	}
 
 	void TaskManager::Run(const Function<void(float)>& update, const Function<bool()> isDone)
 	{
-		auto task = mnew FunctionalTask();
+		FunctionalTask* task = mFunctionalTasksPool.Construct();
 		task->update = update;
 		task->isDone = isDone;
 	}
 
 	void TaskManager::Run(const Function<void(float)>& update, float time)
 	{
-		auto task = mnew FunctionalTimeTask(time);
+		FunctionalTimeTask* task = mFunctionalTimeTasksPool.Construct(time);
 		task->update = update;
 	}
 
 	void TaskManager::Invoke(const Function<void()> func, float delay)
 	{
-		auto task = mnew FunctionalDelayedTask(delay);
+		FunctionalDelayedTask* task = mFunctionalDelayedTasksPool.Construct(delay);
 		task->doTask = func;
 	}
 
 	TaskManager::TaskManager():
-		mLastTaskId(0)
-	{}
+		mLastTaskId(0), mFunctionalTasksPool(0, 64), mFunctionalTimeTasksPool(0, 64), mFunctionalDelayedTasksPool(0, 64),
+		mDeterministic(false), mMainThreadId(std::this_thread::get_id()), mQueuedJobsCount(0),
+		mStopWorkers(false), mActiveJobsCount(0), mLastAsyncJobId(0), mNextJobsQueue(0)
+	{
+		mWorkersCount = Math::Max((int)std::thread::hardware_concurrency() - 1, 0);
+	}
 
 	TaskManager::~TaskManager()
 	{
 		StopAllTasks();
+		WaitAllJobs();
+		StopWorkers();
 	}
 
 	void TaskManager::Update(float dt)
 	{
-		TasksVec doneTasks;
-		for (auto task : mTasks)
+		while (ProcessMainThreadJob());
+		ReleaseCompletedJobs();
+
+		// Done task is replaced by last task, which is updated at same index. Tasks can be started
+		// and stopped while updating, so updated task is checked that it is still at it's index
+		for (int i = 0; i < mTasks.Count();)
 		{
+			Task* task = mTasks[i];
 			task->Update(dt);
+
+			if (i >= mTasks.Count() || mTasks[i] != task)
+				continue;
+
 			if (task->IsDone())
-				doneTasks.Add(task);
+				ReleaseTask(task);
+			else
+				i++;
 		}
-
-		for (auto doneTask : doneTasks)
-			delete doneTask;
 	}
 
 	void TaskManager::Play(const Animation& animation, float delay /*= 0.0f*/)
 	{
 		mnew AnimationTask(animation, delay);
 	}
+
+	void TaskManager::ParallelFor(int count, int rangeSize, const RangeFunc& func)
+	{
+		if (count <= 0)
+			return;
+
+		rangeSize = Math::Max(rangeSize, 1);
+
+		if (mDeterministic || mWorkersCount == 0 || count <= rangeSize || std::this_thread::get_id() != mMainThreadId)
+		{
+			for (int begin = 0; begin < count; begin += rangeSize)
+				func(begin, Math::Min(begin + rangeSize, count));
+
+			return;
+		}
+
+		StartWorkers();
+
+		int jobsCount = (count + rangeSize - 1)/rangeSize;
+		std::atomic<int> remaining(jobsCount);
+
+		// Counter is increased before pushing, so it is never lower than count of jobs in queues
+		mQueuedJobsCount += jobsCount;
+
+		// Ranges are distributed over queues by blocks, so neighbor ranges are processed by one thread
+		int queuesCount = mQueues.Count();
+		for (int i = 0; i < jobsCount; i++)
+		{
+			Job job;
+			job.func = &func;
+			job.begin = i*rangeSize;
+			job.end = Math::Min(job.begin + rangeSize, count);
+			job.remaining = &remaining;
+			job.asyncJob = nullptr;
+
+			JobsQueue* queue = mQueues[i*queuesCount/jobsCount];
+			std::lock_guard<std::mutex> guard(queue->lock);
+			queue->jobs.push_back(job);
+		}
+
+		{
+			std::lock_guard<std::mutex> guard(mWorkersLock);
+		}
+		mWorkersSignal.notify_all();
+
+		// Async jobs aren't taken here, they can be much longer than ranges
+		Job job;
+		while (remaining > 0)
+		{
+			if (TryGetJob(0, job, true))
+				ProcessJob(job);
+			else
+				std::this_thread::yield();
+		}
+	}
+
+	int TaskManager::RunAsync(const Function<void()>& func, const JobsIdsVec& dependencies /*= JobsIdsVec()*/)
+	{
+		Assert(std::this_thread::get_id() == mMainThreadId, "Async jobs must be started from main thread");
+
+		if (!mDeterministic)
+			StartWorkers();
+
+		AsyncJob* job = mnew AsyncJob();
+		job->func = func;
+		job->dependenciesCount = 0;
+		job->completed = false;
+
+		mActiveJobsCount++;
+
+		std::lock_guard<std::mutex> guard(mAsyncJobsLock);
+
+		job->id = ++mLastAsyncJobId;
+
+		// Released dependencies are completed
+		for (int dependencyId : dependencies)
+		{
+			if (AsyncJob** dependency = mAsyncJobs.TryGet(dependencyId))
+			{
+				if (!(*dependency)->completed)
+				{
+					(*dependency)->dependents.Add(job);
+					job->dependenciesCount++;
+				}
+			}
+		}
+
+		mAsyncJobs.Add(job->id, job);
+
+		if (job->dependenciesCount == 0)
+			PushAsyncJob(job);
+
+		return job->id;
+	}
+
+	void TaskManager::ContinueOnMainThread(int jobId, const Function<void()>& func)
+	{
+		AsyncJob* job = nullptr;
+		{
+			std::lock_guard<std::mutex> guard(mAsyncJobsLock);
+			if (AsyncJob** jobPtr = mAsyncJobs.TryGet(jobId))
+				job = *jobPtr;
+		}
+
+		// Continuations list is used only on main thread
+		if (job)
+			job->continuations.Add(func);
+		else
+			func();
+	}
+
+	bool TaskManager::IsJobCompleted(int jobId)
+	{
+		if (jobId <= 0)
+			return true;
+
+		std::lock_guard<std::mutex> guard(mAsyncJobsLock);
+
+		if (AsyncJob** job = mAsyncJobs.TryGet(jobId))
+			return (*job)->completed;
+
+		return jobId <= mLastAsyncJobId;
+	}
+
+	void TaskManager::WaitJob(int jobId)
+	{
+		Job job;
+		while (!IsJobCompleted(jobId))
+		{
+			if (ProcessMainThreadJob())
+				continue;
+
+			if (!mQueues.IsEmpty() && TryGetJob(0, job))
+				ProcessJob(job);
+			else
+				std::this_thread::yield();
+		}
+	}
+
+	void TaskManager::WaitAllJobs()
+	{
+		Job job;
+		while (mActiveJobsCount > 0)
+		{
+			if (ProcessMainThreadJob())
+				continue;
+
+			if (!mQueues.IsEmpty() && TryGetJob(0, job))
+				ProcessJob(job);
+			else
+				std::this_thread::yield();
+		}
+
+		ReleaseCompletedJobs();
+	}
+
+	void TaskManager::SetWorkersCount(int count)
+	{
+		count = Math::Max(count, 0);
+		if (count == mWorkersCount)
+			return;
+
+		WaitAllJobs();
+		StopWorkers();
+		mWorkersCount = count;
+	}
+
+	int TaskManager::GetWorkersCount() const
+	{
+		return mWorkersCount;
+	}
+
+	void TaskManager::SetDeterministic(bool deterministic)
+	{
+		if (deterministic == mDeterministic)
+			return;
+
+		WaitAllJobs();
+		mDeterministic = deterministic;
+	}
+
+	bool TaskManager::IsDeterministic() const
+	{
+		return mDeterministic;
+	}
+
+	void TaskManager::StartWorkers()
+	{
+		if (!mWorkers.IsEmpty() || mWorkersCount == 0)
+			return;
+
+		mStopWorkers = false;
+
+		for (int i = 0; i < mWorkersCount + 1; i++)
+			mQueues.Add(mnew JobsQueue());
+
+		for (int i = 0; i < mWorkersCount; i++)
+			mWorkers.Add(mnew std::thread(&TaskManager::WorkerLoop, this, i + 1));
+	}
+
+	void TaskManager::StopWorkers()
+	{
+		if (mWorkers.IsEmpty())
+			return;
+
+		{
+			std::lock_guard<std::mutex> guard(mWorkersLock);
+			mStopWorkers = true;
+		}
+		mWorkersSignal.notify_all();
+
+		for (auto worker : mWorkers)
+		{
+			worker->join();
+			delete worker;
+		}
+
+		for (auto queue : mQueues)
+			delete queue;
+
+		mWorkers.Clear();
+		mQueues.Clear();
+	}
+
+	void TaskManager::AddTask(Task* task)
+	{
+		task->mId = mLastTaskId++;
+		task->mIndex = mTasks.Count();
+
+		mTasks.Add(task);
+		mTasksByIds.Add(task->mId, task);
+	}
+
+	void TaskManager::RemoveTask(Task* task)
+	{
+		Task* lastTask = mTasks.Last();
+		mTasks[task->mIndex] = lastTask;
+		lastTask->mIndex = task->mIndex;
+		mTasks.PopBack();
+
+		mTasksByIds.RemoveUnordered(task->mId);
+		task->mIndex = -1;
+	}
+
+	void TaskManager::ReleaseTask(Task* task)
+	{
+		RemoveTask(task);
+		task->Release();
+	}
+
+	void TaskManager::WorkerLoop(int queueIdx)
+	{
+		Job job;
+		while (!mStopWorkers)
+		{
+			if (TryGetJob(queueIdx, job))
+			{
+				ProcessJob(job);
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(mWorkersLock);
+			mWorkersSignal.wait(lock, [&]() { return mStopWorkers || mQueuedJobsCount > 0; });
+		}
+	}
+
+	bool TaskManager::TryGetJob(int queueIdx, Job& job, bool rangesOnly /*= false*/)
+	{
+		if (mQueuedJobsCount == 0)
+			return false;
+
+		JobsQueue* ownQueue = mQueues[queueIdx];
+		{
+			std::lock_guard<std::mutex> guard(ownQueue->lock);
+			if (!ownQueue->jobs.empty() && !(rangesOnly && ownQueue->jobs.front().asyncJob))
+			{
+				job = ownQueue->jobs.front();
+				ownQueue->jobs.pop_front();
+				mQueuedJobsCount--;
+				return true;
+			}
+		}
+
+		// Own queue is empty, stealing from back of other queues
+		int queuesCount = mQueues.Count();
+		for (int i = 1; i < queuesCount; i++)
+		{
+			JobsQueue* queue = mQueues[(queueIdx + i)%queuesCount];
+			std::lock_guard<std::mutex> guard(queue->lock);
+			if (!queue->jobs.empty() && !(rangesOnly && queue->jobs.back().asyncJob))
+			{
+				job = queue->jobs.back();
+				queue->jobs.pop_back();
+				mQueuedJobsCount--;
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void TaskManager::ProcessJob(const Job& job)
+	{
+		if (job.asyncJob)
+		{
+			job.asyncJob->func();
+			CompleteAsyncJob(job.asyncJob);
+			return;
+		}
+
+		(*job.func)(job.begin, job.end);
+		(*job.remaining)--;
+	}
+
+	void TaskManager::PushAsyncJob(AsyncJob* job)
+	{
+		if (mDeterministic || mWorkers.IsEmpty())
+		{
+			mMainThreadJobs.push_back(job);
+			return;
+		}
+
+		// Main thread's queue is skipped, main thread takes async jobs only when waits them
+		int queueIdx = mNextJobsQueue%mWorkers.Count() + 1;
+		mNextJobsQueue = queueIdx;
+
+		Job queueJob;
+		queueJob.func = nullptr;
+		queueJob.begin = 0;
+		queueJob.end = 0;
+		queueJob.remaining = nullptr;
+		queueJob.asyncJob = job;
+
+		mQueuedJobsCount++;
+
+		{
+			std::lock_guard<std::mutex> guard(mQueues[queueIdx]->lock);
+			mQueues[queueIdx]->jobs.push_back(queueJob);
+		}
+
+		{
+			std::lock_guard<std::mutex> guard(mWorkersLock);
+		}
+		mWorkersSignal.notify_one();
+	}
+
+	bool TaskManager::ProcessMainThreadJob()
+	{
+		AsyncJob* job;
+		{
+			std::lock_guard<std::mutex> guard(mAsyncJobsLock);
+			if (mMainThreadJobs.empty())
+				return false;
+
+			job = mMainThreadJobs.front();
+			mMainThreadJobs.pop_front();
+		}
+
+		job->func();
+		CompleteAsyncJob(job);
+
+		return true;
+	}
+
+	void TaskManager::CompleteAsyncJob(AsyncJob* job)
+	{
+		{
+			std::lock_guard<std::mutex> guard(mAsyncJobsLock);
+
+			job->completed = true;
+			mCompletedJobs.Add(job);
+
+			for (auto dependent : job->dependents)
+			{
+				if (--dependent->dependenciesCount == 0)
+					PushAsyncJob(dependent);
+			}
+		}
+
+		mActiveJobsCount--;
+	}
+
+	void TaskManager::ReleaseCompletedJobs()
+	{
+		AsyncJobsVec completedJobs;
+		{
+			std::lock_guard<std::mutex> guard(mAsyncJobsLock);
+			if (mCompletedJobs.IsEmpty())
+				return;
+
+			completedJobs = mCompletedJobs;
+			mCompletedJobs.Clear();
+
+			for (auto job : completedJobs)
+				mAsyncJobs.RemoveUnordered(job->id);
+		}
+
+		// Continuations can start new jobs
+		for (auto job : completedJobs)
+		{
+			for (auto& continuation : job->continuations)
+				continuation();
+
+			delete job;
+		}
+	}
 }
\ No newline at end of file
@@ -1,24 +1,42 @@
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include "Utils/Containers/HashDictionary.h"
+#include "Utils/Containers/Pool.h"
 #include "Utils/Containers/Vector.h"
 #include "Utils/Singleton.h"
 #include "Utils/Delegates.h"
+#include "Utils/Task.h"
 
 // Task manager access macros
 #define o2Tasks o2::TaskManager::Instance()
 
 namespace o2
 {
-	class Task;
 	class Animation;
 
-	// -----------------------
-	// Tasks manager singleton
-	// -----------------------
+	template<typename _type>
+	class JobFuture;
+
+	// -----------------------------------------------------------------------------------------
+	// Tasks manager singleton. Updates main thread tasks every frame and processes parallel
+	// and async jobs on workers threads. Each worker has own jobs queue, free worker steals
+	// jobs from other queues. Thread, which waits jobs completion, processes jobs too.
+	// Async job starts when all it's dependencies are completed, main thread continuations
+	// are called in Update after job completion. Async jobs are created, continued and released
+	// only on main thread
+	// -----------------------------------------------------------------------------------------
 	class TaskManager: public Singleton<TaskManager>
 	{
 	public:
 		typedef Vector<Task*> TasksVec;
+		typedef Function<void(int, int)> RangeFunc;
+		typedef Vector<int> JobsIdsVec;
 
 	public:
 		// Stops task with specified id
@@ -45,10 +63,116 @@ namespace o2
 		// Plays animation task
 		void Play(const Animation& animation, float delay = 0.0f);
 
+		// Calls func(begin, end) for ranges of [0, count) with rangeSize length on workers and waits completion.
+		// Ranges are processed in order on calling thread in deterministic mode, without workers or when called
+		// not from main thread
+		void ParallelFor(int count, int rangeSize, const RangeFunc& func);
+
+		// Runs function on worker after completion of dependencies jobs and returns job id.
+		// In deterministic mode or without workers jobs are processed in order on main thread in Update
+		int RunAsync(const Function<void()>& func, const JobsIdsVec& dependencies = JobsIdsVec());
+
+		// Runs function on worker after completion of dependencies jobs and returns future of it's result
+		template<typename _type>
+		JobFuture<_type> RunAsyncWithResult(const Function<_type()>& func, const JobsIdsVec& dependencies = JobsIdsVec());
+
+		// Calls function on main thread in Update after job completion. Calls immediately, if job is already released
+		void ContinueOnMainThread(int jobId, const Function<void()>& func);
+
+		// Returns is async job completed. Ids less or equal zero are not jobs and always completed
+		bool IsJobCompleted(int jobId);
+
+		// Waits async job completion, processes other jobs meanwhile. Main thread continuations are not called.
+		// Returns immediately for ids less or equal zero
+		void WaitJob(int jobId);
+
+		// Waits completion of all async jobs and calls their main thread continuations
+		void WaitAllJobs();
+
+		// Sets count of workers threads. Workers are started at first parallel jobs. Waits all async jobs
+		void SetWorkersCount(int count);
+
+		// Returns count of workers threads
+		int GetWorkersCount() const;
+
+		// Sets deterministic mode: parallel jobs are processed in order on calling thread, async jobs are
+		// processed in order of their readiness on main thread. Waits all async jobs
+		void SetDeterministic(bool deterministic);
+
+		// Returns is deterministic mode enabled
+		bool IsDeterministic() const;
+
+	protected:
+		// ------------------------------------------------------------------------------
+		// Async job state. Dependencies counters and dependents are guarded by async jobs
+		// lock, functions are copied and destroyed only on main thread
+		// ------------------------------------------------------------------------------
+		struct AsyncJob
+		{
+			int                      id;                // Job id
+			Function<void()>         func;              // Job function
+			Vector<Function<void()>> continuations;     // Main thread continuations
+			Vector<AsyncJob*>        dependents;        // Jobs, waiting this job
+			int                      dependenciesCount; // Count of not completed dependencies
+			bool                     completed;         // Is job completed
+		};
+
+		// -------------------------------------------------------------------------
+		// Queued job: range of indexes for range function or async job, when it set
+		// -------------------------------------------------------------------------
+		struct Job
+		{
+			const RangeFunc*  func;      // Range function
+			int               begin;     // First index in range
+			int               end;       // End index of range, not included
+			std::atomic<int>* remaining; // Count of remaining jobs of ParallelFor call
+			AsyncJob*         asyncJob;  // Async job, processed instead of range function
+		};
+
+		// ---------------------------------------------------
+		// Jobs queue of worker. Owner takes jobs from front,
+		// other workers steal jobs from back
+		// ---------------------------------------------------
+		struct JobsQueue
+		{
+			std::mutex      lock; // Queue lock
+			std::deque<Job> jobs; // Queued jobs
+		};
+
+		typedef Vector<JobsQueue*> JobsQueuesVec;
+		typedef Vector<std::thread*> ThreadsVec;
+		typedef HashDictionary<int, AsyncJob*> AsyncJobsDict;
+		typedef Vector<AsyncJob*> AsyncJobsVec;
+		typedef HashDictionary<int, Task*> TasksDict;
+
 	protected:
-		TasksVec mTasks;      // All tasks array
-		int      mLastTaskId; // Last given task id
-		
+		TasksVec                       mTasks;                      // All tasks array. Task stores it's index
+		TasksDict                      mTasksByIds;                 // All tasks by ids
+		int                            mLastTaskId;                 // Last given task id
+
+		Pool<FunctionalTask>           mFunctionalTasksPool;        // Functional tasks pool
+		Pool<FunctionalTimeTask>       mFunctionalTimeTasksPool;    // Functional timed tasks pool
+		Pool<FunctionalDelayedTask>    mFunctionalDelayedTasksPool; // Functional delayed tasks pool
+
+		int                            mWorkersCount;               // Count of workers threads
+		bool                           mDeterministic;              // Is parallel jobs processing on calling thread in order
+		std::thread::id                mMainThreadId;               // Main thread id. Parallel jobs are distributed only from it
+
+		ThreadsVec                     mWorkers;                    // Started workers threads
+		JobsQueuesVec                  mQueues;                     // Jobs queues. First queue is main thread's, next are workers
+		std::atomic<int>               mQueuedJobsCount;            // Count of jobs in all queues
+		std::atomic<bool>              mStopWorkers;                // Is workers must be stopped
+		std::mutex                     mWorkersLock;                // Lock for sleeping workers signal
+		std::condition_variable        mWorkersSignal;              // New jobs or stopping signal for sleeping workers
+
+		std::mutex                     mAsyncJobsLock;              // Lock for async jobs dependencies and completed jobs list
+		AsyncJobsDict                  mAsyncJobs;                  // Not released async jobs by ids
+		AsyncJobsVec                   mCompletedJobs;              // Completed jobs, waiting for continuations and releasing
+		std::deque<AsyncJob*>          mMainThreadJobs;             // Ready async jobs, processed on main thread in deterministic mode
+		std::atomic<int>               mActiveJobsCount;            // Count of not completed async jobs
+		int                            mLastAsyncJobId;             // Last given async job id
+		int                            mNextJobsQueue;              // Index of next worker queue for ready async job
+
 	protected:
 		// Default constructor
 		TaskManager();
@@ -56,7 +180,121 @@ namespace o2
 		// Destructor. Destroys all tasks
 		~TaskManager();
 
+		// Starts workers threads, if they aren't started yet
+		void StartWorkers();
+
+		// Stops workers and waits for their completion
+		void StopWorkers();
+
+		// Gives id to task and adds it into tasks array
+		void AddTask(Task* task);
+
+		// Removes task from tasks array by replacing it with last task
+		void RemoveTask(Task* task);
+
+		// Removes task and releases it: pooled tasks are returned into pools, others are deleted
+		void ReleaseTask(Task* task);
+
+		// Worker thread function
+		void WorkerLoop(int queueIdx);
+
+		// Takes job from own queue or steals from others. Skips async jobs when rangesOnly.
+		// Returns false when all queues are empty
+		bool TryGetJob(int queueIdx, Job& job, bool rangesOnly = false);
+
+		// Processes job and marks it completed
+		void ProcessJob(const Job& job);
+
+		// Puts ready async job into worker queue or main thread queue. Must be called under async jobs lock
+		void PushAsyncJob(AsyncJob* job);
+
+		// Processes one queued job on main thread. Returns false when there are no jobs
+		bool ProcessMainThreadJob();
+
+		// Marks async job completed and pushes ready dependents
+		void CompleteAsyncJob(AsyncJob* job);
+
+		// Calls main thread continuations of completed jobs and releases them
+		void ReleaseCompletedJobs();
+
 		friend class Task;
+		friend class FunctionalTask;
+		friend class FunctionalTimeTask;
+		friend class FunctionalDelayedTask;
 		friend class Application;
 	};
+
+	// ----------------------------------------------------------------
+	// Result of async job. Result is available after job completion
+	// ----------------------------------------------------------------
+	template<typename _type>
+	class JobFuture
+	{
+	public:
+		// Default constructor, without job
+		JobFuture();
+
+		// Returns job id
+		int GetJobId() const;
+
+		// Returns is future created by job
+		bool IsValid() const;
+
+		// Returns is job completed
+		bool IsReady() const;
+
+		// Waits job completion and returns result. Future must be valid
+		const _type& Get() const;
+
+	protected:
+		int                    mJobId;  // Async job id
+		std::shared_ptr<_type> mResult; // Result storage, shared with job function
+
+		friend class TaskManager;
+	};
+
+	template<typename _type>
+	JobFuture<_type> TaskManager::RunAsyncWithResult(const Function<_type()>& func,
+													 const JobsIdsVec& dependencies /*= JobsIdsVec()*/)
+	{
+		JobFuture<_type> res;
+		res.mResult = std::make_shared<_type>();
+
+		auto result = res.mResult;
+		res.mJobId = RunAsync([=]() { *result = func(); }, dependencies);
+
+		return res;
+	}
+
+	template<typename _type>
+	JobFuture<_type>::JobFuture():
+		mJobId(0)
+	{}
+
+	template<typename _type>
+	int JobFuture<_type>::GetJobId() const
+	{
+		return mJobId;
+	}
+
+	template<typename _type>
+	bool JobFuture<_type>::IsValid() const
+	{
+		return mJobId > 0 && mResult;
+	}
+
+	template<typename _type>
+	bool JobFuture<_type>::IsReady() const
+	{
+		return TaskManager::Instance().IsJobCompleted(mJobId);
+	}
+
+	template<typename _type>
+	const _type& JobFuture<_type>::Get() const
+	{
+		Assert(IsValid(), "Getting result of invalid job future");
+
+		TaskManager::Instance().WaitJob(mJobId);
+		return *mResult;
+	}
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Utils/Containers/Hash.h"
 #include "Utils/String.h"
 
 namespace o2
@@ -98,4 +99,16 @@ namespace o2
 			return *this;
 		}
 	};
+
+	// --------
+	// UID hash
+	// --------
+	template<>
+	struct Hash<UID>
+	{
+		UInt operator()(const UID& value) const
+		{
+			return HashBytes(value.data, 16);
+		}
+	};
 }
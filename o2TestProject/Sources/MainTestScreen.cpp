@@ -34,8 +34,17 @@ void MainTestScreen::Load()
 	uiTest->layout.offsetBottom = -70.0f;
 	uiTest->onClick += [&]() { mApplication->GoToScreen("UITestScreen"); };
 
+	auto performanceTest = o2UI.CreateButton("Performance");
+	performanceTest->name = "PerformanceTestBtn";
+	performanceTest->layout.anchorTop = 1.0f;
+	performanceTest->layout.anchorBottom = 1.0f;
+	performanceTest->layout.offsetTop = -80.0f;
+	performanceTest->layout.offsetBottom = -110.0f;
+	performanceTest->onClick += [&]() { mApplication->GoToScreen("PerformanceTestScreen"); };
+
 	root->AddChild(textTest);
 	root->AddChild(uiTest);
+	root->AddChild(performanceTest);
 }
 
 void MainTestScreen::Unload()
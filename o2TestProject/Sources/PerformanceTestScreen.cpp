@@ -0,0 +1,1074 @@
+#include "PerformanceTestScreen.h"
+
+#include "Render\FontRef.h"
+#include "Render\Particle.h"
+#include "Render\ParticlesBuffer.h"
+#include "Render\Render.h"
+#include "Render\VectorFont.h"
+#include "Render\RenderCommandList.h"
+#include "Render\Text.h"
+#include "Events\CursorEventsListener.h"
+#include "Events\EventSystem.h"
+#include "TestApplication.h"
+#include "UI\UIManager.h"
+#include "UI\VerticalLayout.h"
+#include "Utils\Containers\HashDictionary.h"
+#include "Utils\Data\BinaryDataFormat.h"
+#include "Utils\Data\DataNode.h"
+#include "Utils\Task.h"
+#include "Utils\TaskManager.h"
+#include "Utils\Debug.h"
+#include "Utils\Memory\MemoryManager.h"
+#include "Utils\Timer.h"
+
+PerformanceTestScreen::PerformanceTestScreen(TestApplication* application):
+	ITestScreen(application)
+{
+}
+
+PerformanceTestScreen::~PerformanceTestScreen()
+{
+}
+
+void PerformanceTestScreen::Load()
+{
+	mTextureA = TextureRef(Vec2I(4, 4));
+	mTextureB = TextureRef(Vec2I(4, 4));
+
+	const int spritesCountX = 80, spritesCountY = 50;
+	Vec2F resolution = (Vec2I)o2Render.resolution;
+	Vec2F spriteSize = resolution/Vec2F((float)spritesCountX, (float)spritesCountY);
+	Vec2F origin = (spriteSize - resolution)*0.5f;
+
+	for (int y = 0; y < spritesCountY; y++)
+	{
+		for (int x = 0; x < spritesCountX; x++)
+		{
+			Sprite* sprite = mnew Sprite((x + y)%2 == 0 ? mTextureA : mTextureB, RectI(0, 0, 4, 4));
+			sprite->size = spriteSize;
+			sprite->position = origin + Vec2F(spriteSize.x*x, spriteSize.y*y);
+			mSprites.Add(sprite);
+		}
+	}
+
+	CheckHashDictionary();
+	MeasureDrawCommandsBatching();
+	CheckDrawCommandsBatching();
+	MeasureParticlesUpdate();
+	MeasureTasksBookkeeping();
+	CheckCurvesEvaluation();
+	CheckBinaryData();
+	CheckXmlData();
+	MeasureDataArena();
+	MeasureGlyphsLookup();
+	MeasureGlyphsInsertion();
+	MeasureTextUpdate();
+	MeasureCursorListenersSearch();
+	MeasureWidgetsLayout();
+}
+
+void PerformanceTestScreen::Unload()
+{
+	for (auto sprite : mSprites)
+		delete sprite;
+
+	mSprites.Clear();
+
+	o2Render.SetCommandsRecording(false);
+}
+
+void PerformanceTestScreen::Update(float dt)
+{
+	mFramesTime += dt;
+	mFramesCount++;
+
+	if (mFramesTime > 2.0f)
+	{
+		o2Debug.Log("Stress scene: %i sprites, recording %sc: draw calls %i, frame time %f ms", mSprites.Count(),
+					o2Render.IsCommandsRecording() ? "on" : "off", o2Render.GetDrawCallsCount(),
+					mFramesTime/(float)mFramesCount*1000.0f);
+
+		mFramesTime = 0.0f;
+		mFramesCount = 0;
+	}
+
+	if (o2Input.IsKeyPressed('B'))
+	{
+		o2Render.SetCommandsRecording(!o2Render.IsCommandsRecording());
+		mFramesTime = 0.0f;
+		mFramesCount = 0;
+	}
+
+	if (o2Input.IsKeyPressed(VK_ESCAPE))
+		mApplication->GoToScreen("MainTestScreen");
+}
+
+void PerformanceTestScreen::Draw()
+{
+	for (auto sprite : mSprites)
+		sprite->Draw();
+}
+
+String PerformanceTestScreen::GetId() const
+{
+	return "PerformanceTestScreen";
+}
+
+void PerformanceTestScreen::CheckHashDictionary()
+{
+	const int keysCount = 1000, measureKeysCount = 100000;
+
+	// Few distinct hashes, so keys form long probing clusters
+	struct CollidingHash
+	{
+		UInt operator()(int value) const { return (UInt)(value%7); }
+	};
+
+	// Adding with many rehashes
+	HashDictionary<int, int, CollidingHash> dictionary;
+	for (int i = 0; i < keysCount; i++)
+		dictionary.Add(i, i*10);
+
+	bool added = dictionary.Count() == keysCount;
+	for (int i = 0; i < keysCount; i++)
+		added = added && dictionary.ContainsKey(i) && dictionary.Get(i) == i*10;
+
+	// Removing every third key keeps order of others
+	for (int i = 0; i < keysCount; i += 3)
+		dictionary.Remove(i);
+
+	bool removed = dictionary.Count() == keysCount - (keysCount + 2)/3;
+	for (int i = 0; i < keysCount; i++)
+		removed = removed && dictionary.ContainsKey(i) == (i%3 != 0);
+
+	int prevKey = -1;
+	for (auto kv : dictionary)
+	{
+		removed = removed && kv.Key() > prevKey && kv.Key()%3 != 0 && kv.Value() == kv.Key()*10;
+		prevKey = kv.Key();
+	}
+
+	// Removed keys added back go to the end with new values
+	for (int i = 0; i < keysCount; i += 3)
+		dictionary.Add(i, -i);
+
+	bool readded = dictionary.Count() == keysCount;
+	for (int i = 0; i < keysCount; i++)
+		readded = readded && dictionary.Get(i) == (i%3 == 0 ? -i : i*10);
+
+	int firstReaddedIdx = keysCount - (keysCount + 2)/3;
+	for (int i = firstReaddedIdx; i < keysCount; i++)
+		readded = readded && dictionary.GetIdx(i).mKey == (i - firstReaddedIdx)*3;
+
+	// Unordered and ordered removing mixed
+	for (int i = 0; i < keysCount; i++)
+	{
+		if (i%4 == 0)
+			dictionary.RemoveUnordered(i);
+		else if (i%4 == 1)
+			dictionary.Remove(i);
+	}
+
+	bool mixedRemoved = dictionary.Count() == keysCount/2;
+	for (int i = 0; i < keysCount; i++)
+		mixedRemoved = mixedRemoved && dictionary.ContainsKey(i) == (i%4 >= 2);
+
+	int iteratedCount = 0;
+	for (auto kv : dictionary)
+	{
+		mixedRemoved = mixedRemoved && kv.Key()%4 >= 2;
+		iteratedCount++;
+	}
+
+	mixedRemoved = mixedRemoved && iteratedCount == keysCount/2;
+
+	bool passed = added && removed && readded && mixedRemoved;
+
+	o2Debug.Log("Hash dictionary check %sc: %i colliding keys, adding %sc, removing %sc, adding back %sc, mixed "
+				"removing %sc", passed ? "passed" : "FAILED", keysCount, added ? "ok" : "failed",
+				removed ? "ok" : "failed", readded ? "ok" : "failed", mixedRemoved ? "ok" : "failed");
+
+	// Removing half of keys with keeping order
+	HashDictionary<int, int> measureDictionary(measureKeysCount);
+	for (int i = 0; i < measureKeysCount; i++)
+		measureDictionary.Add(i, i);
+
+	Timer timer;
+
+	for (int i = 0; i < measureKeysCount; i += 2)
+		measureDictionary.Remove(i);
+
+	float removeTime = timer.GetDeltaTime();
+
+	int orderedCount = 0;
+	for (auto kv : measureDictionary)
+		orderedCount++;
+
+	float compactTime = timer.GetDeltaTime();
+
+	o2Debug.Log("Hash dictionary removing %i of %i keys: %f ms, first iteration after removing %f ms (%i left)",
+				measureKeysCount/2, measureKeysCount, removeTime*1000.0f, compactTime*1000.0f, orderedCount);
+}
+
+void PerformanceTestScreen::MeasureDrawCommandsBatching()
+{
+	const int quadsCount = 10000, measureIterations = 10;
+
+	RenderCommandList::State stateA(mTextureA.operator->(), RenderCommandList::PrimitiveType::Triangles, false, RectI());
+	RenderCommandList::State stateB(mTextureB.operator->(), RenderCommandList::PrimitiveType::Triangles, false, RectI());
+	UInt16 indexes[] = { 0, 1, 2, 0, 2, 3 };
+
+	RenderCommandList commandList;
+	Timer timer;
+	float buildTime = 0.0f;
+
+	for (int i = 0; i < measureIterations; i++)
+	{
+		commandList.Clear();
+
+		// Separate quads with interleaved textures: each quad breaks immediate drawing batch
+		for (int j = 0; j < quadsCount; j++)
+		{
+			float x = (float)(j%100)*10.0f, y = (float)(j/100)*10.0f;
+			Vertex2 vertices[] = { Vertex2(x, y, 0xffffffff, 0.0f, 0.0f),
+			                       Vertex2(x + 8.0f, y, 0xffffffff, 1.0f, 0.0f),
+			                       Vertex2(x + 8.0f, y + 8.0f, 0xffffffff, 1.0f, 1.0f),
+			                       Vertex2(x, y + 8.0f, 0xffffffff, 0.0f, 1.0f) };
+
+			commandList.AddMesh(j%2 == 0 ? stateA : stateB, (float)j, vertices, 4, indexes, 6);
+		}
+
+		timer.Reset();
+		commandList.BuildBatches(USHRT_MAX - 1, USHRT_MAX - 1);
+		buildTime += timer.GetTime();
+	}
+
+	o2Debug.Log("Draw commands batching: %i quads, draw calls without batching %i, with batching %i, "
+				"batches building %f ms", quadsCount, commandList.GetCommandsCount(), commandList.GetBatchesCount(),
+				buildTime/(float)measureIterations*1000.0f);
+}
+
+void PerformanceTestScreen::CheckDrawCommandsBatching()
+{
+	const int quadsCount = 2000;
+	const UInt maxVertexCount = 400, maxIndexCount = 600;
+
+	RenderCommandList::State states[] = {
+		RenderCommandList::State(mTextureA.operator->(), RenderCommandList::PrimitiveType::Triangles, false, RectI()),
+		RenderCommandList::State(mTextureB.operator->(), RenderCommandList::PrimitiveType::Triangles, false, RectI()),
+		RenderCommandList::State(mTextureA.operator->(), RenderCommandList::PrimitiveType::Triangles, true,
+								 RectI(0, 0, 100, 100)) };
+	UInt16 indexes[] = { 0, 1, 2, 0, 2, 3 };
+
+	// Random overlapping quads, some of them are recorded later than commands with greater depth
+	RenderCommandList commandList;
+	for (int i = 0; i < quadsCount; i++)
+	{
+		float x = Math::Random(0.0f, 300.0f), y = Math::Random(0.0f, 300.0f), size = Math::Random(5.0f, 30.0f);
+		Vertex2 vertices[] = { Vertex2(x, y, 0xffffffff, 0.0f, 0.0f),
+		                       Vertex2(x + size, y, 0xffffffff, 1.0f, 0.0f),
+		                       Vertex2(x + size, y + size, 0xffffffff, 1.0f, 1.0f),
+		                       Vertex2(x, y + size, 0xffffffff, 0.0f, 1.0f) };
+
+		float depth = i%10 == 0 ? (float)(i - Math::Random(0, 20)) : (float)i;
+		commandList.AddMesh(states[Math::Random(0, 300)%3], depth, vertices, 4, indexes, 6);
+	}
+
+	commandList.BuildBatches(maxVertexCount, maxIndexCount);
+
+	auto& commands = commandList.GetCommands();
+	Vector<int> drawPositions;
+	drawPositions.Resize(commands.Count());
+	for (auto& position : drawPositions)
+		position = -1;
+
+	bool statesKept = true, limitsKept = true, allDrawnOnce = true;
+	int drawPosition = 0;
+	for (auto& batch : commandList.GetBatches())
+	{
+		UInt vertexCount = 0, indexCount = 0;
+		for (int i = batch.firstCommand; i >= 0; i = commands[i].nextInBatch)
+		{
+			statesKept = statesKept && commands[i].state == batch.state;
+			allDrawnOnce = allDrawnOnce && drawPositions[i] < 0;
+
+			drawPositions[i] = drawPosition++;
+			vertexCount += commands[i].vertexCount;
+			indexCount += commands[i].indexCount;
+		}
+
+		limitsKept = limitsKept && vertexCount <= maxVertexCount && indexCount <= maxIndexCount;
+	}
+
+	allDrawnOnce = allDrawnOnce && drawPosition == commands.Count();
+
+	// Overlapping commands must be drawn by increasing depth
+	int orderErrors = 0;
+	for (int i = 0; i < commands.Count(); i++)
+	{
+		for (int j = i + 1; j < commands.Count(); j++)
+		{
+			const RectF& a = commands[i].bounds, &b = commands[j].bounds;
+			bool overlaps = a.left < b.right && a.right > b.left && a.bottom < b.top && a.top > b.bottom;
+			if (!overlaps || commands[i].depth == commands[j].depth)
+				continue;
+
+			bool iFirst = commands[i].depth < commands[j].depth;
+			if ((drawPositions[i] < drawPositions[j]) != iFirst)
+				orderErrors++;
+		}
+	}
+
+	bool passed = statesKept && limitsKept && allDrawnOnce && orderErrors == 0;
+
+	o2Debug.Log("Draw commands batching check %sc: %i commands, %i batches, states %sc, limits %sc, drawn once %sc, "
+				"depth order errors %i", passed ? "passed" : "FAILED", commands.Count(), commandList.GetBatchesCount(),
+				statesKept ? "kept" : "broken", limitsKept ? "kept" : "broken", allDrawnOnce ? "yes" : "no",
+				orderErrors);
+}
+
+void PerformanceTestScreen::MeasureParticlesUpdate()
+{
+	const int particlesCount = 100000, measureIterations = 10;
+	const float dt = 1.0f/60.0f;
+
+	Vector<Particle> particles;
+	ParticlesBuffer particlesBuffer;
+	particlesBuffer.Reserve(particlesCount);
+
+	for (int i = 0; i < particlesCount; i++)
+	{
+		Particle particle;
+		particle.position = Vec2F(Math::Random(-500.0f, 500.0f), Math::Random(-500.0f, 500.0f));
+		particle.velocity = Vec2F(Math::Random(-50.0f, 50.0f), Math::Random(-50.0f, 50.0f));
+		particle.angle = Math::Random(0.0f, 6.28f);
+		particle.angleSpeed = Math::Random(-1.0f, 1.0f);
+		particle.size = Vec2F(10.0f, 10.0f);
+		particle.color = Color4::White();
+		particle.time = 100.0f;
+		particle.lifetime = 100.0f;
+
+		particles.Add(particle);
+		particlesBuffer.Add(particle);
+	}
+
+	Vector<Vertex2> vertices;
+	vertices.Resize(particlesCount*4);
+
+	Timer timer;
+
+	// Particles structures, updated, removed when expired and converted into quads one by one
+	for (int i = 0; i < measureIterations; i++)
+	{
+		for (auto& particle : particles)
+		{
+			particle.position += particle.velocity*dt;
+			particle.angle += particle.angleSpeed*dt;
+			particle.time -= dt;
+		}
+
+		for (int j = 0; j < particles.Count();)
+		{
+			if (particles[j].time < 0.0f)
+			{
+				particles[j] = particles.Last();
+				particles.PopBack();
+			}
+			else j++;
+		}
+
+		int vertexIdx = 0;
+		for (auto& particle : particles)
+		{
+			float sn = Math::Sin(particle.angle), cs = Math::Cos(particle.angle);
+			Vec2F hs = particle.size*0.5f;
+			Vec2F xv(cs*hs.x, sn*hs.x);
+			Vec2F yv(-sn*hs.y, cs*hs.y);
+			Vec2F o(particle.position);
+			ULong colr = particle.color.ARGB();
+
+			vertices[vertexIdx++].Set(o - xv + yv, colr, 0.0f, 1.0f);
+			vertices[vertexIdx++].Set(o + xv + yv, colr, 1.0f, 1.0f);
+			vertices[vertexIdx++].Set(o + xv - yv, colr, 1.0f, 0.0f);
+			vertices[vertexIdx++].Set(o - xv - yv, colr, 0.0f, 0.0f);
+		}
+	}
+
+	float structuresTime = timer.GetDeltaTime();
+
+	// Particles channels buffer
+	for (int i = 0; i < measureIterations; i++)
+	{
+		particlesBuffer.Integrate(dt);
+		particlesBuffer.RemoveExpired();
+		particlesBuffer.BuildQuads(vertices.Data(), RectF(0.0f, 1.0f, 1.0f, 0.0f));
+	}
+
+	float bufferTime = timer.GetDeltaTime();
+
+	o2Debug.Log("Particles update: %i particles, structures %f ms, channels buffer %f ms", particlesCount,
+				structuresTime/(float)measureIterations*1000.0f, bufferTime/(float)measureIterations*1000.0f);
+}
+
+void PerformanceTestScreen::MeasureTasksBookkeeping()
+{
+	const int tasksCount = 50000, measureIterations = 5;
+
+	Timer timer;
+	float heapStartTime = 0.0f, heapUpdateTime = 0.0f, pooledStartTime = 0.0f, pooledUpdateTime = 0.0f;
+
+	for (int i = 0; i < measureIterations; i++)
+	{
+		// Heap allocated tasks, deleted when done
+		timer.GetDeltaTime();
+		for (int j = 0; j < tasksCount; j++)
+			mnew TimeTask(0.0f);
+
+		heapStartTime += timer.GetDeltaTime();
+		o2Tasks.Update(0.1f);
+		heapUpdateTime += timer.GetDeltaTime();
+
+		// Functional tasks, returned into pool when done
+		for (int j = 0; j < tasksCount; j++)
+			o2Tasks.Run([](float dt) {}, 0.0f);
+
+		pooledStartTime += timer.GetDeltaTime();
+		o2Tasks.Update(0.1f);
+		pooledUpdateTime += timer.GetDeltaTime();
+	}
+
+	float msMultiplier = 1000.0f/(float)measureIterations;
+	o2Debug.Log("Tasks bookkeeping: %i tasks, heap tasks start %f ms, update %f ms, pooled tasks start %f ms, update %f ms",
+				tasksCount, heapStartTime*msMultiplier, heapUpdateTime*msMultiplier, pooledStartTime*msMultiplier,
+				pooledUpdateTime*msMultiplier);
+}
+
+void PerformanceTestScreen::CheckCurvesEvaluation()
+{
+	const int positionsCount = 100000, lookupTableSamples = 1024;
+	const float approximationTolerance = 0.00001f, lookupTableTolerance = 0.005f;
+
+	Curve curves[] = { Curve::EaseInOut(), Curve::Linear(),
+	                   Curve({ Vec2F(0.0f, 0.0f), Vec2F(0.3f, 1.0f), Vec2F(0.6f, -0.5f), Vec2F(1.0f, 2.0f) }) };
+
+	Vector<float> positions, values;
+	positions.Resize(positionsCount);
+	values.Resize(positionsCount);
+
+	for (auto& curve : curves)
+	{
+		Curve lookupCurve = curve;
+		lookupCurve.SetLookupTableSamples(lookupTableSamples);
+
+		float begin = curve.GetKeys()[0].position, end = curve.GetKeys().Last().position;
+		for (int i = 0; i < positionsCount; i++)
+			positions[i] = Math::Lerp(begin, end, (float)i/(float)(positionsCount - 1));
+
+		// Lookup table error is compared with values range
+		float minValue = FLT_MAX, maxValue = -FLT_MAX;
+		for (auto position : positions)
+		{
+			float value = EvaluateCurveByScan(curve, position);
+			minValue = Math::Min(minValue, value);
+			maxValue = Math::Max(maxValue, value);
+		}
+		float valuesRange = Math::Max(maxValue - minValue, 1.0f);
+
+		Timer timer;
+
+		float scanSum = 0.0f;
+		for (auto position : positions)
+			scanSum += EvaluateCurveByScan(curve, position);
+
+		float scanTime = timer.GetDeltaTime();
+
+		float approximationSum = 0.0f;
+		for (auto position : positions)
+			approximationSum += curve.Evaluate(position);
+
+		float approximationTime = timer.GetDeltaTime();
+
+		float lookupSum = 0.0f;
+		for (auto position : positions)
+			lookupSum += lookupCurve.Evaluate(position);
+
+		float lookupTime = timer.GetDeltaTime();
+
+		lookupCurve.Evaluate(positions.Data(), values.Data(), positionsCount);
+
+		float batchTime = timer.GetDeltaTime();
+
+		float approximationError = 0.0f, lookupError = 0.0f, batchError = 0.0f;
+		for (int i = 0; i < positionsCount; i++)
+		{
+			float exactValue = EvaluateCurveByScan(curve, positions[i]);
+
+			approximationError = Math::Max(approximationError, Math::Abs(curve.Evaluate(positions[i]) - exactValue));
+			lookupError = Math::Max(lookupError, Math::Abs(lookupCurve.Evaluate(positions[i]) - exactValue));
+			batchError = Math::Max(batchError, Math::Abs(values[i] - exactValue));
+		}
+
+		bool passed = approximationError <= approximationTolerance &&
+			lookupError <= lookupTableTolerance*valuesRange && batchError <= lookupTableTolerance*valuesRange;
+
+		o2Debug.Log("Curve evaluation %sc: %i keys, max error: approximation %f, lookup table %f, batch %f",
+					passed ? "passed" : "FAILED", curve.GetKeys().Count(), approximationError, lookupError, batchError);
+
+		o2Debug.Log("Curve evaluation time of %i positions: keys scan %f ms, approximation %f ms, lookup table %f ms, "
+					"batch %f ms (sums %f %f %f)", positionsCount, scanTime*1000.0f, approximationTime*1000.0f,
+					lookupTime*1000.0f, batchTime*1000.0f, scanSum, approximationSum, lookupSum);
+	}
+}
+
+void PerformanceTestScreen::CheckBinaryData()
+{
+	const int elementsCount = 20000, measureIterations = 5, nestingDepth = 1000;
+
+	DataNode data;
+	DataNode* elements = data.AddNode("Elements");
+	for (int i = 0; i < elementsCount; i++)
+	{
+		DataNode* element = elements->AddNode("Element");
+		element->AddNode("Name")->SetValue(String::Format("Element %i", i));
+		element->AddNode("Index")->SetValue(i);
+		element->AddNode("Weight")->SetValue((float)i*0.25f);
+		element->AddNode("Precise")->SetValue((double)i/3.0);
+		element->AddNode("Enabled")->SetValue(i%2 == 0);
+		element->AddNode("Position")->SetValue(Vec2F((float)i, (float)-i));
+		element->AddNode("Rect")->SetValue(RectI(0, 0, i, i*2));
+	}
+
+	UInt8* binaryData = nullptr;
+	UInt binarySize = BinaryDataFormat::SaveDataDoc(data, binaryData);
+	WString xmlData = data.SaveAsWString(DataNode::Format::Xml);
+
+	DataNode loadedData;
+	bool loaded = loadedData.LoadFromData(binaryData, binarySize);
+	bool passed = loaded && loadedData == data;
+
+	Timer timer;
+	float binaryTime = 0.0f, xmlTime = 0.0f;
+
+	for (int i = 0; i < measureIterations; i++)
+	{
+		DataNode binaryLoaded, xmlLoaded;
+
+		timer.GetDeltaTime();
+		binaryLoaded.LoadFromData(binaryData, binarySize);
+		binaryTime += timer.GetDeltaTime();
+
+		xmlLoaded.LoadFromData(xmlData);
+		xmlTime += timer.GetDeltaTime();
+	}
+
+	mfree(binaryData);
+
+	o2Debug.Log("Binary data round trip %sc: %i elements, binary %i bytes loading %f ms, xml %i characters loading %f ms",
+				passed ? "passed" : "FAILED", elementsCount, (int)binarySize, binaryTime/(float)measureIterations*1000.0f,
+				xmlData.Length(), xmlTime/(float)measureIterations*1000.0f);
+
+	// Too deep nodes nesting is rejected as corrupted data
+	DataNode deepData;
+	DataNode* deepNode = &deepData;
+	for (int i = 0; i < nestingDepth; i++)
+		deepNode = deepNode->AddNode("Child");
+
+	binarySize = BinaryDataFormat::SaveDataDoc(deepData, binaryData);
+
+	DataNode deepLoaded;
+	bool deepRejected = !deepLoaded.LoadFromData(binaryData, binarySize) && deepLoaded.GetChildNodes().IsEmpty();
+
+	mfree(binaryData);
+
+	o2Debug.Log("Binary data nesting limit %sc: %i levels data is %sc", deepRejected ? "passed" : "FAILED", nestingDepth,
+				deepRejected ? "rejected" : "loaded");
+}
+
+void PerformanceTestScreen::CheckXmlData()
+{
+	const int elementsCount = 20000, nestingDepth = 1000;
+
+	DataNode data;
+	DataNode* elements = data.AddNode("Elements");
+	for (int i = 0; i < elementsCount; i++)
+	{
+		DataNode* element = elements->AddNode("Element");
+		element->AddNode("Name")->SetValue(String::Format("Element %i", i));
+		element->AddNode("Index")->SetValue(i);
+		element->AddNode("Weight")->SetValue((float)i*0.25f);
+		element->AddNode("Position")->SetValue(Vec2F((float)i, (float)-i));
+	}
+
+	WString xmlData = data.SaveAsWString(DataNode::Format::Xml);
+	size_t xmlBytes = xmlData.Length()*sizeof(wchar_t);
+
+	// Streaming loading peak memory
+	size_t streamingPeak = 0;
+	bool passed = false;
+	{
+		o2Memory.ResetStats();
+		size_t beginBytes = o2Memory.GetTotalBytes();
+
+		DataNode loaded;
+		passed = loaded.LoadFromData(xmlData) && loaded == data;
+
+		streamingPeak = o2Memory.GetPeakBytes() - beginBytes;
+	}
+
+	// Loading through intermediate xml document, both document and nodes are alive while copying
+	auto allocate = pugi::get_memory_allocation_function();
+	auto deallocate = pugi::get_memory_deallocation_function();
+	pugi::set_memory_management_functions(&AllocateXmlMemory, &FreeXmlMemory);
+
+	size_t documentPeak = 0;
+	{
+		o2Memory.ResetStats();
+		size_t beginBytes = o2Memory.GetTotalBytes();
+
+		DataNode loaded;
+		pugi::xml_document xmlDoc;
+		if (xmlDoc.load_buffer(xmlData.Data(), xmlBytes).status == pugi::status_ok)
+		{
+			for (auto xmlNode : xmlDoc)
+			{
+				if (xmlNode.type() == pugi::node_element)
+					CopyXmlNode(xmlNode, *loaded.AddNode(xmlNode.name()));
+			}
+		}
+
+		documentPeak = o2Memory.GetPeakBytes() - beginBytes;
+	}
+
+	pugi::set_memory_management_functions(allocate, deallocate);
+
+	o2Debug.Log("Xml data streaming loading %sc: %i elements, %i bytes, peak memory: streaming %i bytes, through "
+				"document %i bytes", passed ? "passed" : "FAILED", elementsCount, (int)xmlBytes, (int)streamingPeak,
+				(int)documentPeak);
+
+	// Too deep elements nesting is rejected as in binary data
+	DataNode deepData;
+	DataNode* deepNode = &deepData;
+	for (int i = 0; i < nestingDepth; i++)
+		deepNode = deepNode->AddNode("Child");
+
+	WString deepXmlData = deepData.SaveAsWString(DataNode::Format::Xml);
+
+	DataNode deepLoaded;
+	bool deepRejected = !deepLoaded.LoadFromData(deepXmlData) && deepLoaded.GetChildNodes().IsEmpty();
+
+	o2Debug.Log("Xml data nesting limit %sc: %i levels data is %sc", deepRejected ? "passed" : "FAILED", nestingDepth,
+				deepRejected ? "rejected" : "loaded");
+}
+
+void PerformanceTestScreen::MeasureDataArena()
+{
+	const int elementsCount = 20000, measureIterations = 5;
+
+	DataNode data;
+	DataNode* elements = data.AddNode("Elements");
+	for (int i = 0; i < elementsCount; i++)
+	{
+		DataNode* element = elements->AddNode("Element");
+		element->AddNode("Name")->SetValue(String::Format("Element with long enough name %i", i));
+		element->AddNode("Index")->SetValue(i);
+		element->AddNode("Position")->SetValue(Vec2F((float)i, (float)-i));
+	}
+
+	UInt8* binaryData = nullptr;
+	UInt binarySize = BinaryDataFormat::SaveDataDoc(data, binaryData);
+
+	Timer timer;
+	float loadTime[2] = { 0.0f, 0.0f }, destroyTime[2] = { 0.0f, 0.0f };
+	int allocationsCount[2] = { 0, 0 };
+	bool passed = true;
+
+	for (int i = 0; i < measureIterations; i++)
+	{
+		for (int arena = 0; arena < 2; arena++)
+		{
+			int beginAllocations = o2Memory.GetAllocationsCount();
+			timer.GetDeltaTime();
+
+			DataNode* loaded = mnew DataNode();
+			if (arena)
+				loaded->EnableArena();
+
+			loaded->LoadFromData(binaryData, binarySize);
+
+			loadTime[arena] += timer.GetDeltaTime();
+			allocationsCount[arena] = o2Memory.GetAllocationsCount() - beginAllocations;
+			passed = passed && *loaded == data && loaded->IsArenaEnabled() == (arena == 1);
+
+			timer.GetDeltaTime();
+			delete loaded;
+			destroyTime[arena] += timer.GetDeltaTime();
+		}
+	}
+
+	mfree(binaryData);
+
+	o2Debug.Log("Data arena %sc: %i elements, separate nodes: %i allocations, loading %f ms, destroying %f ms; "
+				"arena: %i allocations, loading %f ms, destroying %f ms", passed ? "passed" : "FAILED", elementsCount,
+				allocationsCount[0], loadTime[0]/(float)measureIterations*1000.0f,
+				destroyTime[0]/(float)measureIterations*1000.0f, allocationsCount[1],
+				loadTime[1]/(float)measureIterations*1000.0f, destroyTime[1]/(float)measureIterations*1000.0f);
+}
+
+void PerformanceTestScreen::MeasureGlyphsLookup()
+{
+	const int lookupsCount = 1000000, lookupHeight = 20;
+	const int heights[] = { 12, 16, 20, 24 };
+
+	FontRef font("stdFont.ttf");
+
+	WString symbols;
+	for (wchar_t c = 32; c < 127; c++)
+		symbols += c;
+
+	for (wchar_t c = 0x410; c < 0x450; c++)
+		symbols += c;
+
+	// Keys of cached glyphs in same order, as they were scanned before indexing
+	Vector<UInt> glyphsKeys;
+	for (auto height : heights)
+	{
+		font->CheckCharacters(symbols, height);
+
+		for (int i = 0; i < symbols.Length(); i++)
+			glyphsKeys.Add((UInt)symbols[i] | ((UInt)height << 16));
+	}
+
+	WString text;
+	text.Reserve(lookupsCount + 1);
+	for (int i = 0; i < lookupsCount; i++)
+		text += symbols[i%symbols.Length()];
+
+	Timer timer;
+
+	int scanFound = 0;
+	for (int i = 0; i < lookupsCount; i++)
+	{
+		UInt key = (UInt)text[i] | ((UInt)lookupHeight << 16);
+		for (auto glyphKey : glyphsKeys)
+		{
+			if (glyphKey == key)
+			{
+				scanFound++;
+				break;
+			}
+		}
+	}
+
+	float scanTime = timer.GetDeltaTime();
+
+	float advancesSum = 0.0f;
+	for (int i = 0; i < lookupsCount; i++)
+		advancesSum += font->GetCharacter(text[i], lookupHeight).mAdvance;
+
+	float indexTime = timer.GetDeltaTime();
+
+	font->CheckCharacters(text, lookupHeight);
+
+	float checkTime = timer.GetDeltaTime();
+
+	o2Debug.Log("Glyphs lookup: %i glyphs cached, %i lookups: keys scan %f ms, hash index %f ms, cached text check %f ms "
+				"(found %i, advances %f)", glyphsKeys.Count(), lookupsCount, scanTime*1000.0f, indexTime*1000.0f,
+				checkTime*1000.0f, scanFound, advancesSum);
+}
+
+void PerformanceTestScreen::MeasureGlyphsInsertion()
+{
+	const int heights[] = { 16, 32, 48 };
+	const int bucketSize = 100;
+
+	WString symbols;
+	for (wchar_t c = 32; c < 127; c++)
+		symbols += c;
+
+	for (wchar_t c = 0x400; c < 0x500; c++)
+		symbols += c;
+
+	// Separate font, so glyphs cached by other measurements don't affect insertion
+	FontRef sharedFont("stdFont.ttf");
+	VectorFont font(sharedFont->GetFileName());
+
+	Vector<float> insertionTimes;
+	Timer timer;
+
+	for (auto height : heights)
+	{
+		for (int i = 0; i < symbols.Length(); i++)
+		{
+			WString symbol;
+			symbol += symbols[i];
+
+			timer.GetDeltaTime();
+			font.CheckCharacters(symbol, height);
+			insertionTimes.Add(timer.GetDeltaTime());
+		}
+	}
+
+	float firstTime = 0.0f, lastTime = 0.0f, summaryTime = 0.0f;
+	for (int i = 0; i < insertionTimes.Count(); i++)
+	{
+		summaryTime += insertionTimes[i];
+
+		if (i < bucketSize)
+			firstTime += insertionTimes[i];
+		else if (i >= insertionTimes.Count() - bucketSize)
+			lastTime += insertionTimes[i];
+	}
+
+	int pagesCount = 0;
+	for (auto height : heights)
+	{
+		for (int i = 0; i < symbols.Length(); i++)
+			pagesCount = Math::Max(pagesCount, font.GetCharacter(symbols[i], height).mPage + 1);
+	}
+
+	o2Debug.Log("Glyphs insertion: %i glyphs on %i pages, summary %f ms, average of first %i %f ms, last %i %f ms",
+				insertionTimes.Count(), pagesCount, summaryTime*1000.0f, bucketSize,
+				firstTime/(float)bucketSize*1000.0f, bucketSize, lastTime/(float)bucketSize*1000.0f);
+}
+
+void PerformanceTestScreen::MeasureTextUpdate()
+{
+	const int labelsCount = 300, measureIterations = 30;
+
+	FontRef font("stdFont.ttf");
+
+	Vector<Text*> labels;
+	for (int i = 0; i < labelsCount; i++)
+	{
+		Text* label = mnew Text(font);
+		label->SetHeight(14);
+		label->SetWordWrap(true);
+		label->SetSize(Vec2F(200.0f, 40.0f));
+		label->SetPosition(Vec2F((float)(i%10)*100.0f, (float)(i/10)*20.0f));
+		label->SetText(WString::Format("Animated label number %i with a few words", i));
+		labels.Add(label);
+	}
+
+	Timer timer;
+
+	// Transformation and color changes keep laid out symbols
+	for (int i = 0; i < measureIterations; i++)
+	{
+		for (auto label : labels)
+		{
+			label->SetPosition(label->GetPosition() + Vec2F(1.0f, 0.5f));
+			label->SetAngle((float)i*0.01f);
+			label->SetTransparency((float)(i%10)*0.1f);
+		}
+	}
+
+	float transformTime = timer.GetDeltaTime();
+
+	// Area changes require laying out symbols again
+	for (int i = 0; i < measureIterations; i++)
+	{
+		for (auto label : labels)
+			label->SetSize(Vec2F(i%2 == 0 ? 190.0f : 200.0f, 40.0f));
+	}
+
+	float relayoutTime = timer.GetDeltaTime();
+
+	for (auto label : labels)
+		delete label;
+
+	o2Debug.Log("Text update: %i labels, moving, rotating and fading %f ms, resizing area %f ms per frame", labelsCount,
+				transformTime/(float)measureIterations*1000.0f, relayoutTime/(float)measureIterations*1000.0f);
+}
+
+void PerformanceTestScreen::MeasureCursorListenersSearch()
+{
+	const int listenersCountX = 40, listenersCountY = 50, wideListenersCount = 5, pointsCount = 1000;
+
+	// Rectangle listener, like list item or button
+	struct RectListener: public CursorAreaEventsListener
+	{
+		RectF rect;
+
+		bool IsUnderPoint(const Vec2F& point) override { return rect.IsInside(point); }
+		RectF GetCursorAreaBounds() const override { return rect; }
+	};
+
+	Vec2F resolution = (Vec2I)o2Render.resolution;
+	Vec2F cellSize = resolution/Vec2F((float)listenersCountX, (float)listenersCountY);
+	Vec2F origin = resolution*(-0.5f);
+
+	// Small listeners covering screen and few wide panels over them, drawn in depth order
+	Vector<RectListener*> listeners;
+	for (int x = 0; x < listenersCountX; x++)
+	{
+		for (int y = 0; y < listenersCountY; y++)
+		{
+			Vec2F leftBottom = origin + cellSize*Vec2F((float)x, (float)y);
+			RectListener* listener = mnew RectListener();
+			listener->rect = RectF(leftBottom.x, leftBottom.y + cellSize.y, leftBottom.x + cellSize.x, leftBottom.y);
+			listeners.Add(listener);
+		}
+	}
+
+	for (int i = 0; i < wideListenersCount; i++)
+	{
+		RectListener* listener = mnew RectListener();
+		listener->rect = RectF(origin.x, -origin.y - (float)i*10.0f, -origin.x, origin.y + (float)i*10.0f);
+		listeners.Add(listener);
+	}
+
+	for (auto listener : listeners)
+		listener->OnDrawn();
+
+	Vector<Vec2F> points;
+	for (int i = 0; i < pointsCount; i++)
+		points.Add(Vec2F(Math::Random(origin.x, -origin.x), Math::Random(origin.y, -origin.y)));
+
+	Timer timer;
+
+	int indexedFound = 0;
+	Vector<EventSystem::CursorAreaEventsListenersVec> indexedResults;
+	for (auto& point : points)
+	{
+		indexedResults.Add(o2Events.GetAllCursorListenersUnderPoint(point));
+		indexedFound += indexedResults.Last().Count();
+	}
+
+	float indexedTime = timer.GetDeltaTime();
+
+	int scannedFound = 0;
+	bool sameResults = true;
+	for (int i = 0; i < pointsCount; i++)
+	{
+		int underPointCount = 0;
+		for (auto listener : listeners)
+		{
+			if (!listener->IsUnderPoint(points[i]))
+				continue;
+
+			underPointCount++;
+			sameResults = sameResults && indexedResults[i].Contains(listener);
+		}
+
+		sameResults = sameResults && underPointCount == indexedResults[i].Count();
+		scannedFound += underPointCount;
+	}
+
+	float scanTime = timer.GetDeltaTime();
+
+	for (auto listener : listeners)
+		delete listener;
+
+	o2Debug.Log("Cursor listeners search: %i listeners, %i points, found %i, index %f ms, scan %f ms", listeners.Count(),
+				pointsCount, indexedFound, indexedTime*1000.0f, scanTime*1000.0f);
+
+	o2Debug.Log("Cursor listeners search check %sc", sameResults && indexedFound == scannedFound ? "passed" : "FAILED");
+}
+
+float PerformanceTestScreen::EvaluateCurveByScan(const Curve& curve, float position)
+{
+	const Curve::KeysVec& keys = curve.GetKeys();
+
+	if (keys.Count() == 0)
+		return 0.0f;
+	else if (keys.Count() == 1)
+		return keys[0].value;
+
+	int endKey = 1;
+	while (endKey < keys.Count() - 1 && keys[endKey].position <= position)
+		endKey++;
+
+	const Vec2F* points = keys[endKey].GetApproximatedPoints();
+	int pointsCount = keys[endKey].GetApproximatedPointsCount();
+
+	int segmentEnd = 1;
+	while (segmentEnd < pointsCount - 1 && points[segmentEnd].x <= position)
+		segmentEnd++;
+
+	Vec2F segmentBegin = points[segmentEnd - 1], segmentEndPoint = points[segmentEnd];
+	return Math::Lerp(segmentBegin.y, segmentEndPoint.y, (position - segmentBegin.x)/(segmentEndPoint.x - segmentBegin.x));
+}
+
+void PerformanceTestScreen::MeasureWidgetsLayout()
+{
+	const int rowsCounts[] = { 250, 500, 1000 };
+	const float rowHeight = 20.0f;
+
+	for (int rowsCount : rowsCounts)
+	{
+		Timer timer;
+
+		// Building panel: rows adding only marks layouts dirty, single layout pass arranges them
+		UIVerticalLayout* panel = mnew UIVerticalLayout();
+		panel->baseCorner = BaseCorner::Top;
+		panel->expandWidth = true;
+		panel->expandHeight = false;
+		panel->layout.size = Vec2F(300.0f, rowHeight*(float)rowsCount);
+		o2UI.AddWidget(panel);
+
+		Vector<UIWidget*> rows;
+		for (int i = 0; i < rowsCount; i++)
+		{
+			UIWidget* row = mnew UIWidget();
+			row->layout.minHeight = rowHeight;
+			panel->AddChild(row);
+			rows.Add(row);
+		}
+
+		o2UI.UpdateLayouts();
+
+		float buildTime = timer.GetDeltaTime();
+
+		// Changing every row
+		for (auto row : rows)
+			row->layout.minHeight = rowHeight*0.5f;
+
+		o2UI.UpdateLayouts();
+
+		float rowsChangeTime = timer.GetDeltaTime();
+
+		// Changing only panel
+		panel->layout.width = 400.0f;
+
+		o2UI.UpdateLayouts();
+
+		float panelChangeTime = timer.GetDeltaTime();
+
+		bool arranged = true;
+		for (int i = 1; i < rowsCount; i++)
+		{
+			arranged = arranged && rows[i]->layout.GetAbsoluteRect().top <= rows[i - 1]->layout.GetAbsoluteRect().bottom &&
+				Math::Equals(rows[i]->layout.GetAbsoluteRect().Width(), 400.0f);
+		}
+
+		o2UI.RemoveWidget(panel);
+
+		o2Debug.Log("Widgets layout %sc: %i rows panel building %f ms, changing all rows %f ms, changing panel %f ms",
+					arranged ? "passed" : "FAILED", rowsCount, buildTime*1000.0f, rowsChangeTime*1000.0f,
+					panelChangeTime*1000.0f);
+	}
+}
+
+void PerformanceTestScreen::CopyXmlNode(const pugi::xml_node& xmlNode, DataNode& dataNode)
+{
+	dataNode.SetValue((wchar_t*)xmlNode.child_value());
+
+	for (auto attribute = xmlNode.attributes_begin(); attribute != xmlNode.attributes_end(); ++attribute)
+		dataNode.AddNode(attribute->name())->SetValue((wchar_t*)attribute->value());
+
+	for (auto child : xmlNode)
+	{
+		if (child.type() == pugi::node_element)
+			CopyXmlNode(child, *dataNode.AddNode(child.name()));
+	}
+}
+
+void* PerformanceTestScreen::AllocateXmlMemory(size_t size)
+{
+	return mmalloc(size);
+}
+
+void PerformanceTestScreen::FreeXmlMemory(void* memory)
+{
+	mfree(memory);
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "ITestScreen.h"
+#include "Render/Sprite.h"
+#include "Render/TextureRef.h"
+#include "Utils/Data/XmlDataFormat.h"
+#include "Utils/Math/Curve.h"
+
+// --------------------------------------------------------------------------------
+// Performance test screen. Runs engine measurements and checks at loading and logs
+// results. Draws sprites stress scene, draw commands recording switches by 'B' key
+// --------------------------------------------------------------------------------
+class PerformanceTestScreen: public ITestScreen
+{
+public:
+	PerformanceTestScreen(TestApplication* application);
+	~PerformanceTestScreen();
+
+	void Load();
+	void Unload();
+
+	void Update(float dt);
+	void Draw();
+	String GetId() const;
+
+protected:
+	typedef Vector<Sprite*> SpritesVec;
+
+	TextureRef mTextureA;            // First texture for batching measurement
+	TextureRef mTextureB;            // Second texture for batching measurement
+	SpritesVec mSprites;             // Stress scene sprites with interleaved textures
+	float      mFramesTime = 0.0f;   // Summary frames time from last log
+	int        mFramesCount = 0;     // Frames count from last log
+
+protected:
+	// Checks hash dictionary with colliding keys, rehashing, removing and adding removed keys back. Measures
+	// removing keys with keeping order
+	void CheckHashDictionary();
+
+	// Records interleaved textures quads into commands list and compares draw calls count and time
+	// without and with batching
+	void MeasureDrawCommandsBatching();
+
+	// Checks that batched random overlapping commands are drawn by increasing depth and batches keep commands states
+	void CheckDrawCommandsBatching();
+
+	// Updates and builds quads for many particles stored by structures and stored in channels buffer, compares time
+	void MeasureParticlesUpdate();
+
+	// Starts and completes many short-lived heap allocated and pooled tasks, compares time
+	void MeasureTasksBookkeeping();
+
+	// Checks curves evaluation by binary search and lookup table against linear keys scan, compares time
+	void CheckCurvesEvaluation();
+
+	// Checks data saving into binary format and loading back, compares binary and xml loading time. Checks that
+	// too deep binary data isn't loaded
+	void CheckBinaryData();
+
+	// Checks xml data streaming loading, compares peak memory with loading through intermediate xml document.
+	// Checks that too deep xml data isn't loaded
+	void CheckXmlData();
+
+	// Loads and destroys data nodes tree with separately allocated nodes and in arena document, compares allocations
+	// count and time
+	void MeasureDataArena();
+
+	// Looks up font glyphs by hash index and by linear scan of cached glyphs keys, compares time
+	void MeasureGlyphsLookup();
+
+	// Inserts new glyphs into vector font one by one, compares insertion time of first and last glyphs
+	void MeasureGlyphsInsertion();
+
+	// Moves, rotates and fades many text labels, compares time with changing labels areas, which requires laying
+	// out symbols again
+	void MeasureTextUpdate();
+
+	// Searches many drawn cursor listeners under random points through event system index, compares results and time
+	// with scanning all listeners
+	void MeasureCursorListenersSearch();
+
+	// Builds vertical layout panels with different rows count, changes rows and panel size and measures deferred
+	// layout passes time. Checks that rows are arranged
+	void MeasureWidgetsLayout();
+
+	// Returns curve value by linear scan of keys and approximation points
+	static float EvaluateCurveByScan(const Curve& curve, float position);
+
+	// Copies xml element with attributes and children into data node, as xml data was loaded through document
+	static void CopyXmlNode(const pugi::xml_node& xmlNode, DataNode& dataNode);
+
+	// Allocates xml document memory with managed malloc, so it is counted by memory manager
+	static void* AllocateXmlMemory(size_t size);
+
+	// Frees xml document memory, allocated by AllocateXmlMemory
+	static void FreeXmlMemory(void* memory);
+};
@@ -4,6 +4,7 @@
 #include FT_FREETYPE_H
 #include "Assets\VectorFontAsset.h"
 #include "MainTestScreen.h"
+#include "PerformanceTestScreen.h"
 #include "Render\Camera.h"
 #include "Render\Render.h"
 #include "Render\VectorFontEffects.h"
@@ -20,10 +21,12 @@ void TestApplication::OnStarted()
 	mTestScreens.Add(mnew TextTestScreen(this));
 	mTestScreens.Add(mnew UITestScreen(this));
 	mTestScreens.Add(mnew MainTestScreen(this));
+	mTestScreens.Add(mnew PerformanceTestScreen(this));
 
 	//GoToScreen("MainTestScreen");
 	GoToScreen("UITestScreen");
 	//GoToScreen("TextTestScreen");
+	//GoToScreen("PerformanceTestScreen");
 }
 
 void TestApplication::OnUpdate(float dt)